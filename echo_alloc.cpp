@@ -0,0 +1,85 @@
+// echo_alloc.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "echo_platform.h"
+#include "echo_alloc.h"
+
+#include <cstdlib>
+#include <new>
+
+/// The capture writer and the pools allocate on other threads, so the counters are atomic where we can
+#if __cplusplus >= 201103L
+	#include <atomic>
+	
+	typedef std::atomic<unsigned long> alloc_counter;
+	#define ALLOC_ADD(counter, n)	((counter).fetch_add((n), std::memory_order_relaxed))
+	#define ALLOC_GET(counter)		((counter).load(std::memory_order_relaxed))
+#else
+	typedef unsigned long alloc_counter;
+	#define ALLOC_ADD(counter, n)	((counter) += (n))
+	#define ALLOC_GET(counter)		(counter)
+#endif
+
+/// Number of calls to operator new/new[] so far
+static alloc_counter alloc_count(0);
+/// Number of bytes asked for through operator new/new[] so far
+static alloc_counter alloc_bytes(0);
+
+unsigned long echo_alloc_count()
+{
+	return(ALLOC_GET(alloc_count));
+}
+unsigned long echo_alloc_bytes()
+{
+	return(ALLOC_GET(alloc_bytes));
+}
+
+#ifndef ECHO_NDS
+/** Counts the allocation, then hands it off to malloc.
+ * @param size Number of bytes requested
+ * @return The new block; throws std::bad_alloc if malloc fails
+ */
+static void* counted_alloc(size_t size)
+{
+	ALLOC_ADD(alloc_count, 1);
+	ALLOC_ADD(alloc_bytes, size);
+	/// malloc(0) is allowed to return NULL, but new isn't
+	void* ret = std::malloc(size ? size : 1);
+	if(ret == NULL)
+		throw std::bad_alloc();
+	return(ret);
+}
+
+void* operator new(size_t size)
+{
+	return(counted_alloc(size));
+}
+void* operator new[](size_t size)
+{
+	return(counted_alloc(size));
+}
+void operator delete(void* ptr) throw()
+{
+	std::free(ptr);
+}
+void operator delete[](void* ptr) throw()
+{
+	std::free(ptr);
+}
+#endif
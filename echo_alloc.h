@@ -0,0 +1,37 @@
+// echo_alloc.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "echo_platform.h"
+
+#ifndef __ECHO_ALLOC__
+#define __ECHO_ALLOC__
+/** Gets the number of times the global operator new (or new[]) has been
+ * called since the program started.  Take the difference between two calls
+ * to see how many heap allocations happened in between (e.g. in one frame).\n
+ * The NDS build doesn't replace operator new, so this is always 0 there.
+ * @return The number of heap allocations made through new so far
+ */
+unsigned long echo_alloc_count();
+/** Gets the number of bytes asked for through the global operator new (or new[])
+ * since the program started; like echo_alloc_count, take the difference between
+ * two calls.  Always 0 on the NDS.
+ * @return The number of bytes allocated through new so far
+ */
+unsigned long echo_alloc_bytes();
+#endif
@@ -0,0 +1,987 @@
+// echo_bench.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "echo_platform.h"
+#include "echo_sys.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_math.h"
+#include "echo_alloc.h"
+#include "echo_loader.h"
+#include "echo_stage.h"
+#include "echo_ns.h"
+#include "echo_gfx.h"
+#include "echo_glext.h"
+#include "echo_mesh.h"
+#include "echo_crowd.h"
+#include "echo_outline.h"
+#include "echo_offscreen.h"
+#include "echo_thread.h"
+#include "echo_world.h"
+#include "echo_clip.h"
+#include "echo_bench.h"
+
+#include <vector>
+#include <cstddef>
+
+#ifndef ECHO_NDS
+
+#ifdef ECHO_WIN
+	#include <windows.h>
+#else
+	#include <sys/time.h>
+	#include <time.h>
+#endif
+
+#ifdef ECHO_OSX
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// Size of the offscreen frame of echo_bench_render (the window's default size)
+#define RENDER_WIDTH		640
+#define RENDER_HEIGHT		480
+/// echo_bench_render turns the camera one step every this many frames
+#define RENDER_TURN_EVERY	8
+/// ...by this many degrees (like the arrow keys)
+#define RENDER_TURN			5
+/// Camera pitch echo_bench_render starts at, so the grids are seen from above
+#define RENDER_PITCH		30
+/// Distance between the mannequins of echo_bench_crowd
+#define CROWD_SPACING		1.5f
+/// echo_bench_walkers turns the camera one step every this many updates, so the paths change now and then
+#define WALKERS_TURN_EVERY	50
+/// Updates echo_bench_walkers plays before it starts timing, so the walkers have landed
+#define WALKERS_WARM_UP		60
+/** How far (degrees) echo_bench_stride lets the arms and thighs stray from the trigonometry;
+ * the clip steps by whole degrees just like it, so only rounding
+ */
+#define STRIDE_TOLERANCE		0.01f
+/// ...and the knees, which lerp the knee table between its ends
+#define STRIDE_KNEE_TOLERANCE	0.1f
+/** echo_bench_pick leaves out pixels this close to where the reference id changes, where
+ * the two rasterize the same edge from different triangles
+ */
+#define PICK_MARGIN			2
+/// Yaws echo_bench_pick picks at (with RENDER_PITCH)
+#define PICK_NUM_YAWS		2
+static const float pick_yaws[PICK_NUM_YAWS] = {0, 45};
+
+/** Gets the time from a monotonic clock, for timing the benchmarks
+ * @return Seconds since some arbitrary point
+ */
+double echo_bench_now()
+{
+#ifdef ECHO_WIN
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return((double)count.QuadPart / (double)freq.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return(ts.tv_sec + ts.tv_nsec * 1e-9);
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return(tv.tv_sec + tv.tv_usec * 1e-6);
+#endif
+}
+
+/// State of bench_rand
+static unsigned int bench_seed = 1;
+/** Small LCG so the benchmark data is the same on every platform
+ * @return Pseudo-random float in [-range, range)
+ */
+static float bench_rand(float range)
+{
+	bench_seed = bench_seed * 1664525u + 1013904223u;
+	return(((bench_seed >> 8) / 16777216.0f * 2 - 1) * range);
+}
+
+/** Micro-benchmark of lineSeg_intersect_batch against calling lineSeg_intersect
+ * once per edge; also checks that they agree on every edge.
+ * @param num_edges Number of random edges each segment is tested against
+ * @param passes Number of segments to test
+ * @return 0 if both agree, 1 otherwise (usable as an exit code)
+ */
+int echo_bench_edges(int num_edges, int passes)
+{
+	/// Edges like a stage's: short, scattered over a 100x100 screen
+	vector3f* pts1 = new vector3f[num_edges];
+	vector3f* pts2 = new vector3f[num_edges];
+	float* x1 = new float[num_edges];
+	float* y1 = new float[num_edges];
+	float* x2 = new float[num_edges];
+	float* y2 = new float[num_edges];
+	unsigned char* hits = new unsigned char[num_edges];
+	CHKPTR(pts1);
+	CHKPTR(pts2);
+	CHKPTR(x1);
+	CHKPTR(y1);
+	CHKPTR(x2);
+	CHKPTR(y2);
+	CHKPTR(hits);
+	bench_seed = 1;
+	int each = 0;
+	while(each < num_edges)
+	{
+		x1[each] = bench_rand(50);
+		y1[each] = bench_rand(50);
+		x2[each] = x1[each] + bench_rand(1);
+		y2[each] = y1[each] + bench_rand(1);
+		pts1[each].set(x1[each], y1[each], 0);
+		pts2[each].set(x2[each], y2[each], 0);
+		each++;
+	}
+	/// Falling segments: mostly vertical, a frame's worth of distance
+	vector3f* seg1 = new vector3f[passes];
+	vector3f* seg2 = new vector3f[passes];
+	CHKPTR(seg1);
+	CHKPTR(seg2);
+	each = 0;
+	while(each < passes)
+	{
+		seg1[each].set(bench_rand(50), bench_rand(50), 0);
+		seg2[each].set(seg1[each].x + bench_rand(0.1f), seg1[each].y - 10, 0);
+		each++;
+	}
+	
+	/// The function used until now: one pair at a time through pointers
+	int scalar_hits = 0;
+	double start = echo_bench_now();
+	int pass = 0;
+	while(pass < passes)
+	{
+		each = 0;
+		while(each < num_edges)
+		{
+			scalar_hits += lineSeg_intersect(&seg1[pass], &seg2[pass], &pts1[each], &pts2[each]);
+			each++;
+		}
+		pass++;
+	}
+	const double scalar_time = echo_bench_now() - start;
+	
+	int batch_hits = 0;
+	start = echo_bench_now();
+	pass = 0;
+	while(pass < passes)
+	{
+		batch_hits += lineSeg_intersect_batch(&seg1[pass], &seg2[pass], x1, y1, x2, y2, hits, num_edges);
+		pass++;
+	}
+	const double batch_time = echo_bench_now() - start;
+	
+	/// Check every single answer (not timed)
+	int mismatches = 0;
+	pass = 0;
+	while(pass < passes)
+	{
+		lineSeg_intersect_batch(&seg1[pass], &seg2[pass], x1, y1, x2, y2, hits, num_edges);
+		each = 0;
+		while(each < num_edges)
+		{
+			if(hits[each] != (lineSeg_intersect(&seg1[pass], &seg2[pass], &pts1[each], &pts2[each]) ? 1 : 0))
+				mismatches++;
+			each++;
+		}
+		pass++;
+	}
+	
+	const double total = (double)num_edges * passes;
+#ifdef ECHO_SSE
+	ECHO_PRINT("lineSeg_intersect_batch (SSE) vs lineSeg_intersect, %i edges x %i segments\n", num_edges, passes);
+#else
+	ECHO_PRINT("lineSeg_intersect_batch (scalar) vs lineSeg_intersect, %i edges x %i segments\n", num_edges, passes);
+#endif
+	ECHO_PRINT("\tlineSeg_intersect:       %10.2f Medges/s (%i hits)\n", total / scalar_time / 1e6, scalar_hits);
+	ECHO_PRINT("\tlineSeg_intersect_batch: %10.2f Medges/s (%i hits)\n", total / batch_time / 1e6, batch_hits);
+	ECHO_PRINT("\tspeedup: %.2fx, mismatches: %i\n", scalar_time / batch_time, mismatches);
+	
+	delete[] pts1;
+	delete[] pts2;
+	delete[] x1;
+	delete[] y1;
+	delete[] x2;
+	delete[] y2;
+	delete[] hits;
+	delete[] seg1;
+	delete[] seg2;
+	return(mismatches == 0 && scalar_hits == batch_hits ? 0 : 1);
+}
+
+/** Loads (and deletes) a stage over and over, and prints how long a load takes,
+ * and how many heap allocations and bytes a load makes
+ * @param file_name The stage file
+ * @param passes Number of times to load it
+ * @return 0 if the stage loaded, 1 otherwise (usable as an exit code)
+ */
+int echo_bench_load(char* file_name, int passes)
+{
+	double load_time = 0;
+	/// Heap allocations (and bytes) made by one load, the loader's temporaries included
+	unsigned long load_allocs = 0, load_bytes = 0;
+	int num_grids = 0;
+	int pass = 0;
+	while(pass < passes)
+	{
+		const unsigned long allocs = echo_alloc_count();
+		const unsigned long bytes = echo_alloc_bytes();
+		const double start = echo_bench_now();
+		stage* st = load_stage(file_name);
+		load_time += echo_bench_now() - start;
+		if(st == NULL)
+		{
+			ECHO_PRINT("couldn't load %s\n", file_name);
+			return(1);
+		}
+		load_allocs = echo_alloc_count() - allocs;
+		load_bytes = echo_alloc_bytes() - bytes;
+		num_grids = (int)st->get_num_grids();
+		delete st;
+		pass++;
+	}
+	ECHO_PRINT("%s: %i top-level grids, %i loads\n", file_name, num_grids, passes);
+	ECHO_PRINT("\tload time:   %10.2f ms\n", load_time / passes * 1000);
+	ECHO_PRINT("\tallocations: %10lu per load\n", load_allocs);
+	ECHO_PRINT("\tbytes:       %10lu per load\n", load_bytes);
+	return(0);
+}
+
+/// Are GL times from timer queries (or glFinish)?
+static int timer = 0;
+/// The timer query
+static unsigned int query = 0;
+
+/** Makes the offscreen context, with the state main.cpp's init sets up
+ * @return WIN if there is a context
+ */
+static STATUS render_begin()
+{
+	if(offscreen_init(RENDER_WIDTH, RENDER_HEIGHT) == FAIL)
+		return(FAIL);
+	glViewport(0, 0, RENDER_WIDTH, RENDER_HEIGHT);
+	glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+	glClearDepth(1.0);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glEnable(GL_LINE_SMOOTH);
+	glLineWidth(2.5);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	mesh_init();
+	if(gfx_screen_outline_init() == WIN)
+		gfx_set_outline_mode(OUTLINE_SCREEN);
+	
+	/// Without timer queries, the GL time is how long glFinish waits
+	timer = echo_glext_has_timer();
+	if(timer)
+	{
+		echo_glGenQueries(1, &query);
+		/// Some drivers (llvmpipe) report nonsense for a query's first use
+		unsigned long long elapsed = 0;
+		echo_glBeginQuery(GL_TIME_ELAPSED, query);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		echo_glEndQuery(GL_TIME_ELAPSED);
+		echo_glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+	}
+	return(WIN);
+}
+/// Frees what render_begin made
+static void render_end()
+{
+	if(query)
+		echo_glDeleteQueries(1, &query);
+	query = 0;
+	crowd_free();
+	gfx_screen_outline_free();
+	mesh_free();
+	mesh_set_path(MESH_PATH_BUFFER);
+	offscreen_free();
+}
+/** Sets an orthogonal projection like main.cpp's resize
+ * @param height Half the height of the view
+ * @param depth Half the depth of the view
+ */
+static void render_projection(float height, float depth)
+{
+	const float width = height * RENDER_WIDTH / RENDER_HEIGHT;
+	gfx_screen_outline_resize(RENDER_WIDTH, RENDER_HEIGHT, depth);
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glOrtho(-width, width, -height, height, -depth, depth);
+	glMatrixMode(GL_MODELVIEW);
+	mesh_set_pixel_scale(RENDER_HEIGHT / (2 * height));
+	gfx_set_view(width, height);
+}
+/// Starts timing a frame; returns the CPU time it started at
+static double frame_begin()
+{
+	const double start = echo_bench_now();
+	if(timer)
+		echo_glBeginQuery(GL_TIME_ELAPSED, query);
+	return(start);
+}
+/** Stops timing a frame, and swaps
+ * @param start What frame_begin returned
+ * @param cpu Where to put the time spent submitting the frame
+ * @param gl Where to put the time the GL spent on it
+ */
+static void frame_end(double start, double* cpu, double* gl)
+{
+	if(timer)
+		echo_glEndQuery(GL_TIME_ELAPSED);
+	*cpu = echo_bench_now() - start;
+	if(timer)
+	{
+		unsigned long long elapsed = 0;
+		echo_glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+		*gl = elapsed * 1e-9;
+	}
+	else
+	{
+		start = echo_bench_now();
+		glFinish();
+		*gl = echo_bench_now() - start;
+	}
+	offscreen_swap();
+}
+
+/// Draws a frame like main.cpp's display does (without the HUD)
+static void render_frame()
+{
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glLoadIdentity();
+	gfx_rotatef(-echo_ns::angle.x, 1, 0, 0);
+	gfx_rotatef(-echo_ns::angle.y, 0, 1, 0);
+	gfx_screen_outline_begin();
+	echo_ns::advance(WAIT);
+	echo_ns::draw();
+	if(gfx_screen_outline_end())
+		echo_ns::draw_goals();
+}
+
+/** Plays the stage in an offscreen context (see echo_offscreen.h), turning the
+ * camera now and then, and prints the CPU time and GL time of a frame, and
+ * how many grids were drawn and culled
+ * @param file_name The stage file
+ * @param frames Number of frames to draw
+ * @param path How to draw the meshes (a MESH_PATH_ constant), or -1 for each in turn
+ * @param zoom How much closer than main.cpp the projection is (1 shows the whole stage)
+ * @return 0 if it ran, 1 if there is no offscreen context or the stage didn't load
+ */
+int echo_bench_render(char* file_name, int frames, int path, float zoom)
+{
+	if(render_begin() == FAIL)
+		return(1);
+	ECHO_PRINT("%s: %i frames at %ix%i, zoom %.2f, %s outline, GL time from %s\n", file_name, frames
+		, RENDER_WIDTH, RENDER_HEIGHT, zoom
+		, gfx_get_outline_mode() == OUTLINE_SCREEN ? "screen-space" : "two-pass"
+		, timer ? "timer queries" : "glFinish");
+	ECHO_PRINT("\tpath       first frame   cpu mean    cpu max    gl mean     gl max  (ms)   drawn culled\n");
+	
+	int ret = 0;
+	int each_path = path < 0 ? 0 : path;
+	const int last_path = path < 0 ? MESH_NUM_PATHS - 1 : path;
+	while(each_path <= last_path)
+	{
+		/// A fresh stage for each path, so each bakes (and compiles) from scratch
+		stage* st = load_stage(file_name);
+		if(st == NULL)
+		{
+			ECHO_PRINT("couldn't load %s\n", file_name);
+			ret = 1;
+			break;
+		}
+		mesh_set_path(each_path);
+		echo_ns::init(st);
+		echo_ns::start();
+		echo_ns::angle.set(RENDER_PITCH, 0, 0);
+		/// The projection main.cpp's resize makes for the stage
+		const float depth = st->get_farthest() + 2.8f;
+		render_projection(depth / zoom, depth);
+		
+		/// The first frame bakes, uploads and compiles, so it is kept apart
+		double first = 0, cpu_total = 0, cpu_max = 0, gl_total = 0, gl_max = 0;
+		/// Grids drawn and culled, over all the frames
+		long drawn = 0, culled = 0;
+		int frame = 0;
+		while(frame < frames)
+		{
+			if(frame % RENDER_TURN_EVERY == RENDER_TURN_EVERY - 1)
+			{
+				echo_ns::angle.y += RENDER_TURN;
+				if(echo_ns::angle.y > 180)
+					echo_ns::angle.y -= 360;
+			}
+			double cpu = 0, gl = 0;
+			const double start = frame_begin();
+			render_frame();
+			frame_end(start, &cpu, &gl);
+			drawn += st->get_num_drawn();
+			culled += st->get_num_culled();
+			if(frame == 0)
+				first = cpu + gl;
+			else
+			{
+				cpu_total += cpu;
+				gl_total += gl;
+				if(cpu > cpu_max)
+					cpu_max = cpu;
+				if(gl > gl_max)
+					gl_max = gl;
+			}
+			frame++;
+		}
+		const int rest = frames > 1 ? frames - 1 : 1;
+		ECHO_PRINT("\t%-9s  %10.3f %10.3f %10.3f %10.3f %10.3f %10.1f %6.1f\n", mesh_path_name(each_path)
+			, first * 1000, cpu_total / rest * 1000, cpu_max * 1000
+			, gl_total / rest * 1000, gl_max * 1000
+			, (double)drawn / frames, (double)culled / frames);
+		if(glGetError() != GL_NO_ERROR)
+			ECHO_PRINT("\t(the GL reported an error)\n");
+		echo_ns::deallocate();
+		each_path++;
+	}
+	render_end();
+	return(ret);
+}
+
+/** Gets the id echo_bench_pick drew at a pixel of the reference
+ * @param ref The reference, as read back (rows from the bottom)
+ * @param x Window x-coordinate, from the left
+ * @param y Window y-coordinate, from the top
+ * @return The id (index of the grid in the view + 1, 0 for none)
+ */
+static int pick_ref_id(const unsigned char* ref, int x, int y)
+{
+	const unsigned char* px = ref + 4 * ((RENDER_HEIGHT - 1 - y) * RENDER_WIDTH + x);
+	return(px[0] | (px[1] << 8) | (px[2] << 16));
+}
+/** Is the pixel of the reference PICK_MARGIN or more away from any other id?
+ * @param ref The reference, as read back
+ * @param x Window x-coordinate, from the left
+ * @param y Window y-coordinate, from the top
+ */
+static int pick_ref_inside(const unsigned char* ref, int x, int y)
+{
+	const int id = pick_ref_id(ref, x, y);
+	int dy = -PICK_MARGIN;
+	while(dy <= PICK_MARGIN)
+	{
+		int dx = -PICK_MARGIN;
+		while(dx <= PICK_MARGIN)
+		{
+			if(x + dx >= 0 && y + dy >= 0 && x + dx < RENDER_WIDTH && y + dy < RENDER_HEIGHT
+				&& pick_ref_id(ref, x + dx, y + dy) != id)
+				return(0);
+			dx++;
+		}
+		dy++;
+	}
+	return(1);
+}
+/** Picks pixels of the stage in an offscreen context (stage::pick, on the GPU), and
+ * checks them against an id image drawn independently, as plain quads of each grid's
+ * cached points; also prints the CPU time of a pick call
+ * @param file_name The stage file
+ * @param pixels Number of pixels to pick at each angle
+ * @param zoom How much closer than main.cpp the projection is (1 shows the whole stage)
+ * @return 0 if every pick matched, 1 otherwise (or if there is no offscreen context, the stage didn't load or no grid was drawn big enough)
+ */
+int echo_bench_pick(char* file_name, int pixels, float zoom)
+{
+	if(render_begin() == FAIL)
+		return(1);
+	stage* st = load_stage(file_name);
+	if(st == NULL)
+	{
+		ECHO_PRINT("couldn't load %s\n", file_name);
+		render_end();
+		return(1);
+	}
+	echo_ns::current_stage = st;
+	const float depth = st->get_farthest() + 2.8f;
+	render_projection(depth / zoom, depth);
+	ECHO_PRINT("%s: %i pixels at %ix%i, zoom %.2f, at each of %i angles\n", file_name, pixels
+		, RENDER_WIDTH, RENDER_HEIGHT, zoom, PICK_NUM_YAWS);
+	ECHO_PRINT("\tangle       picked    empty   stairs      bad   us/pick\n");
+	
+	unsigned char* ref = new unsigned char[4 * RENDER_WIDTH * RENDER_HEIGHT];
+	int ret = 0;
+	int each_yaw = 0;
+	while(each_yaw < PICK_NUM_YAWS)
+	{
+		vector3f angle(RENDER_PITCH, pick_yaws[each_yaw], 0);
+		echo_ns::angle = angle;
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glLoadIdentity();
+		gfx_rotatef(-angle.x, 1, 0, 0);
+		gfx_rotatef(-angle.y, 0, 1, 0);
+		/// The draw makes the mesh pick reads from
+		st->draw(angle);
+		
+		/// The reference: each grid the view draws, as a quad in its index's color (stairs have no points)
+		const stage_view* view = st->get_view(angle);
+		glPushAttrib(GL_ALL_ATTRIB_BITS);
+		glClearColor(0, 0, 0, 0);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		glDisable(GL_BLEND);
+		glDisable(GL_DITHER);
+		glBegin(GL_QUADS);
+		int each = 0;
+		while(each < view->get_size())
+		{
+			grid* g = view->get_active(each);
+			vector3f* points = g != NULL && view->should_draw(each) ? g->get_points() : NULL;
+			if(points != NULL && g->get_kind() != GRID_KIND_STAIR)
+			{
+				const int id = each + 1;
+				glColor3ub(id & 255, (id >> 8) & 255, (id >> 16) & 255);
+				int corner = 0;
+				while(corner < 4)
+				{
+					glVertex3f(points[corner].x, points[corner].y, points[corner].z);
+					corner++;
+				}
+			}
+			each++;
+		}
+		glEnd();
+		glReadPixels(0, 0, RENDER_WIDTH, RENDER_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, ref);
+		glPopAttrib();
+		
+		/// The grids cover little of the frame, so the pixels are drawn from those on grids and those on none
+		std::vector<int> on, off;
+		each = 0;
+		while(each < RENDER_WIDTH * RENDER_HEIGHT)
+		{
+			const int x = each % RENDER_WIDTH, y = each / RENDER_WIDTH;
+			if(pick_ref_inside(ref, x, y))
+				(pick_ref_id(ref, x, y) ? on : off).push_back(each);
+			each++;
+		}
+		if(on.empty())
+		{
+			ECHO_PRINT("\tno grid drawn %i pixels across at %.0f, %.0f (try zooming in)\n", 2 * PICK_MARGIN + 1, angle.x, angle.y);
+			ret = 1;
+		}
+		
+		/// Three in four on grids
+		int picked = 0, empty = 0, stairs = 0, bad = 0, calls = 0;
+		double pick_time = 0;
+		while(!on.empty() && picked < pixels)
+		{
+			const std::vector<int>& from = picked % 4 == 3 && !off.empty() ? off : on;
+			int pixel = (int)((bench_rand(0.5f) + 0.5f) * from.size());
+			if(pixel >= (int)from.size())
+				pixel = from.size() - 1;
+			const int x = from[pixel] % RENDER_WIDTH, y = from[pixel] / RENDER_WIDTH;
+			const int id = pick_ref_id(ref, x, y);
+			/// The read is a call behind: the first call starts it, the second gets it
+			grid* got = NULL;
+			int call = 0;
+			while(call < 2)
+			{
+				const double start = echo_bench_now();
+				got = st->pick(x, y, angle);
+				pick_time += echo_bench_now() - start;
+				calls++;
+				glFinish();
+				call++;
+			}
+			/// A stair on top of a grid is picked, but the reference leaves stairs out
+			if(got != NULL && got->get_kind() == GRID_KIND_STAIR)
+			{
+				stairs++;
+				picked++;
+				continue;
+			}
+			grid* want = id ? view->get_active(id - 1) : NULL;
+			if(want == NULL)
+				empty++;
+			if(got != want)
+			{
+				if(bad < 5)
+					ECHO_PRINT("\tat %i, %i: picked grid %i, drew grid %i (-1 for none)\n", x, y
+						, got != NULL ? got->get_stage_index() : -1
+						, want != NULL ? want->get_stage_index() : -1);
+				bad++;
+			}
+			picked++;
+		}
+		ECHO_PRINT("\t%5.0f %5.0f %8i %8i %8i %8i %9.3f\n", angle.x, angle.y, picked, empty, stairs, bad
+			, calls ? pick_time / calls * 1e6 : 0);
+		if(bad)
+			ret = 1;
+		each_yaw++;
+	}
+	delete[] ref;
+	echo_ns::current_stage = NULL;
+	delete st;
+	render_end();
+	ECHO_PRINT("%s\n", ret ? "MISMATCH" : "OK");
+	return(ret);
+}
+
+/// Ways echo_bench_crowd draws the mannequins; the last is instanced without the levels of detail
+enum { CROWD_STACK, CROWD_POSE, CROWD_INSTANCED, CROWD_FULL_DETAIL, CROWD_NUM_WAYS };
+static const char* crowd_way_names[CROWD_NUM_WAYS] = {"stack", "pose", "instanced", "full mesh"};
+
+/** Joints of a mannequin walking in place (the swings of
+ * echo_char::grid_mode_joints, with a knee bend instead of the grids' IK)
+ * @param joints Where to put them
+ * @param cycle Where in the stride it is (degrees)
+ */
+static void crowd_walk(echo_char_joints* joints, float cycle)
+{
+	int each = 0;
+	while(each < NUM_VALUES)
+	{
+		joints->value[each] = 0;
+		each++;
+	}
+	const float swing = echo_sin(cycle);
+	joints->rshoulder_swing = -20 * swing;
+	joints->lshoulder_swing = 20 * swing;
+	joints->rarm_bend = -10 * swing - 20;
+	joints->larm_bend = 10 * swing - 20;
+	joints->rthigh_lift = 35 * swing - 15;
+	joints->lthigh_lift = -35 * swing - 15;
+	joints->rleg_bend = 20 + 15 * swing;
+	joints->lleg_bend = 20 - 15 * swing;
+}
+
+/// The mannequins of echo_bench_crowd, drawn one way
+static void crowd_frame(int way, int num, int side, int frame)
+{
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glLoadIdentity();
+	gfx_rotatef(-RENDER_PITCH, 1, 0, 0);
+	gfx_rotatef(-0.5f * frame, 0, 1, 0);
+	gfx_screen_outline_begin();
+	
+	echo_char_joints joints;
+	if(way != CROWD_STACK)
+	{
+		crowd_set_instancing(way >= CROWD_INSTANCED);
+		crowd_clear();
+		int each = 0;
+		while(each < num)
+		{
+			crowd_walk(&joints, 23.0f * each + 12.0f * frame);
+			crowd_add(CROWD_SPACING * (each % side - (side - 1) * 0.5f), 0
+				, CROWD_SPACING * (each / side - (side - 1) * 0.5f), 37.0f * each, &joints);
+			each++;
+		}
+	}
+	/// Both passes of the two-pass outline, like echo_char::draw
+	int pass = gfx_outline_start() ? 0 : 1;
+	while(pass < 2)
+	{
+		if(pass == 1)
+			gfx_outline_mid();
+		if(way == CROWD_STACK)
+		{
+			int each = 0;
+			while(each < num)
+			{
+				crowd_walk(&joints, 23.0f * each + 12.0f * frame);
+				gfx_push_matrix();
+				gfx_translatef(CROWD_SPACING * (each % side - (side - 1) * 0.5f), 0
+					, CROWD_SPACING * (each / side - (side - 1) * 0.5f));
+				gfx_rotatef(37.0f * each, 0, 1, 0);
+				draw_character(&joints);
+				gfx_pop_matrix();
+				each++;
+			}
+		}
+		else
+			crowd_draw();
+		pass++;
+	}
+	gfx_outline_end();
+	gfx_screen_outline_end();
+}
+
+/** Draws a square of walking mannequins in an offscreen context, each way
+ * there is to draw them (draw_character on the matrix stack, char_pose with
+ * one draw per part, and instanced, with and without the levels of detail),
+ * and prints the CPU time and GL time of a frame
+ * @param num Number of mannequins
+ * @param frames Number of frames to draw each way
+ * @return 0 if it ran, 1 if there is no offscreen context
+ */
+int echo_bench_crowd(int num, int frames)
+{
+	if(render_begin() == FAIL)
+		return(1);
+	int side = 1;
+	while(side * side < num)
+		side++;
+	const float half = side * CROWD_SPACING * 0.5f + 2.5f;
+	render_projection(half, 2 * half);
+	const float scale = mesh_set_pixel_scale(0);
+	mesh_set_pixel_scale(scale);
+	/// Which level of detail the head gets, for the record
+	int level = 0;
+	const echo_mesh* head = &head_mesh;
+	while(head != mesh_lod(&head_mesh))
+	{
+		head = head->coarser;
+		level++;
+	}
+	ECHO_PRINT("%i mannequins, %i frames at %ix%i (%.1f pixels per unit, head at level of detail %i)"
+		", %s outline, GL time from %s\n", num, frames, RENDER_WIDTH, RENDER_HEIGHT, scale, level
+		, gfx_get_outline_mode() == OUTLINE_SCREEN ? "screen-space" : "two-pass"
+		, timer ? "timer queries" : "glFinish");
+	ECHO_PRINT("\tway          cpu mean    cpu max    gl mean     gl max   (ms)      fps\n");
+	int way = 0;
+	while(way < CROWD_NUM_WAYS)
+	{
+		mesh_set_pixel_scale(way == CROWD_FULL_DETAIL ? 0 : scale);
+		double cpu_total = 0, cpu_max = 0, gl_total = 0, gl_max = 0;
+		int frame = 0;
+		/// One frame more than asked; the first one uploads and compiles
+		while(frame <= frames)
+		{
+			double cpu = 0, gl = 0;
+			const double start = frame_begin();
+			crowd_frame(way, num, side, frame);
+			frame_end(start, &cpu, &gl);
+			if(frame > 0)
+			{
+				cpu_total += cpu;
+				gl_total += gl;
+				if(cpu > cpu_max)
+					cpu_max = cpu;
+				if(gl > gl_max)
+					gl_max = gl;
+			}
+			frame++;
+		}
+		/// The CPU and the GL work at the same time, so the slower one sets the frame rate
+		const double slower = cpu_total > gl_total ? cpu_total : gl_total;
+		ECHO_PRINT("\t%-9s  %10.3f %10.3f %10.3f %10.3f %10.1f\n", crowd_way_names[way]
+			, cpu_total / frames * 1000, cpu_max * 1000, gl_total / frames * 1000, gl_max * 1000
+			, slower > 0 ? frames / slower : 0);
+		if(glGetError() != GL_NO_ERROR)
+			ECHO_PRINT("\t(the GL reported an error)\n");
+		way++;
+	}
+	mesh_set_pixel_scale(scale);
+	crowd_set_instancing(1);
+	crowd_clear();
+	render_end();
+	return(0);
+}
+
+/** Loads the stage and spreads the walkers over the grids they can land on (at the
+ * camera angle the walk starts at); every other one runs
+ * @param world The world to set up
+ * @param file_name The stage file
+ * @param walkers Number of characters, the main character included
+ * @return WIN if the stage loaded and has somewhere to stand
+ */
+static STATUS walkers_begin(echo_world* world, char* file_name, int walkers)
+{
+	stage* st = load_stage(file_name);
+	if(st == NULL)
+		return(FAIL);
+	world->init(st);
+	world->angle.set(RENDER_PITCH, 0, 0);
+	const stage_view* view = st->get_view(world->angle);
+	std::vector<grid*> spots;
+	int each = 0;
+	while(each < view->get_size())
+	{
+		if(view->should_land(each) && view->get_active(each) != NULL)
+			spots.push_back(view->get_active(each));
+		each++;
+	}
+	if(spots.empty())
+		return(FAIL);
+	/// Spread them out over the stage rather than piling them on the first grids
+	const int stride = spots.size() > 7 && spots.size() % 7 ? 7 : 1;
+	each = 1;
+	while(each < walkers)
+	{
+		world->add_character(spots[(each * stride) % spots.size()]);
+		each++;
+	}
+	each = 0;
+	while(each < walkers)
+	{
+		if(each % 2)
+			world->get_character(each)->toggle_run();
+		each++;
+	}
+	world->start();
+	return(WIN);
+}
+/** Plays the stage with a crowd of characters walking on their own, without the GL,
+ * with 1, 2, 4... threads up to the number given, and prints the time per update
+ * of each; also checks that every number of threads plays the same
+ * @param file_name The stage file
+ * @param walkers Number of characters
+ * @param ticks Number of updates to play
+ * @param threads Most threads to try
+ * @return 0 if it ran and every number of threads played the same, 1 otherwise
+ */
+int echo_bench_walkers(char* file_name, int walkers, int ticks, int threads)
+{
+	ECHO_PRINT("%s: %i walkers, %i updates, %i CPUs\n", file_name, walkers, ticks, echo_cpu_count());
+	ECHO_PRINT("\tthreads   time (s)    us/update   ns/walker   speed-up   goals    hash\n");
+	int ret = 0;
+	double one_time = 0;
+	unsigned int one_hash = 0;
+	int num = 1;
+	while(num <= threads)
+	{
+		echo_world* world = new echo_world();
+		if(walkers_begin(world, file_name, walkers) == FAIL)
+		{
+			ECHO_PRINT("couldn't load %s, or it has nowhere to stand\n", file_name);
+			delete world;
+			return(1);
+		}
+		echo_pool pool;
+		/// The calling thread is one of the threads
+		echo_pool_start(&pool, num - 1);
+		world->set_pool(&pool);
+		unsigned int hash = 2166136261u;
+		double start = echo_bench_now();
+		int tick = -WALKERS_WARM_UP;
+		while(tick < ticks)
+		{
+			if(tick == 0)
+				start = echo_bench_now();
+			if(tick % WALKERS_TURN_EVERY == WALKERS_TURN_EVERY - 1)
+				world->angle.y += RENDER_TURN;
+			world->update();
+			tick++;
+		}
+		const double time = echo_bench_now() - start;
+		hash = world->hash_state(hash);
+		echo_pool_stop(&pool);
+		if(num == 1)
+		{
+			one_time = time;
+			one_hash = hash;
+		}
+		ECHO_PRINT("\t%7i %10.3f %12.1f %11.1f %9.2fx %7i   %08x %s\n", num, time, time / ticks * 1e6
+			, time / ticks / walkers * 1e9, time > 0 ? one_time / time : 0
+			, world->num_goals_reached(), hash, hash == one_hash ? "" : "DIFFERENT");
+		if(hash != one_hash)
+			ret = 1;
+		delete world;
+		/// 1, 2, 4... and then the number asked for
+		if(num < threads && num * 2 > threads)
+			num = threads;
+		else
+			num *= 2;
+	}
+	return(ret);
+}
+/** Plays the stage with a crowd of walkers like echo_bench_walkers, and checks the
+ * joints grid_mode_joints gets from the stride clip against the trigonometry the clip
+ * was baked from (echo_char#stride_reference)
+ * @param file_name The stage file
+ * @param walkers Number of characters
+ * @param ticks Number of updates to play
+ * @return 0 if the joints are within STRIDE_TOLERANCE (and the knees within
+ * STRIDE_KNEE_TOLERANCE), 1 otherwise
+ */
+int echo_bench_stride(char* file_name, int walkers, int ticks)
+{
+	echo_world* world = new echo_world();
+	if(walkers_begin(world, file_name, walkers) == FAIL)
+	{
+		ECHO_PRINT("couldn't load %s, or it has nowhere to stand\n", file_name);
+		delete world;
+		return(1);
+	}
+	const int knees[] = { (int)(offsetof(echo_char_joints, rleg_bend) / sizeof(float))
+				, (int)(offsetof(echo_char_joints, lleg_bend) / sizeof(float)) };
+	/// The joints before each update, and whether the character was walking
+	std::vector<echo_char_joints> before(walkers);
+	std::vector<int> walking(walkers);
+	double worst = 0, worst_knee = 0, knee_total = 0;
+	long checked = 0, knees_checked = 0;
+	int tick = -WALKERS_WARM_UP;
+	while(tick < ticks)
+	{
+		int each = 0;
+		while(each < walkers)
+		{
+			echo_char* ch = world->get_character(each);
+			before[each] = *ch->get_joints();
+			walking[each] = ch->is_walking();
+			each++;
+		}
+		if(tick % WALKERS_TURN_EVERY == WALKERS_TURN_EVERY - 1)
+			world->angle.y += RENDER_TURN;
+		world->update();
+		each = 0;
+		while(tick >= 0 && each < walkers)
+		{
+			echo_char* ch = world->get_character(each);
+			/// Only updates that stayed in Grid Mode; the others set the joints some other way too
+			if(walking[each] && ch->is_walking())
+			{
+				echo_char_joints reference = before[each];
+				ch->stride_reference(&reference);
+				const echo_char_joints* joints = ch->get_joints();
+				int channel = 0;
+				while(channel < CLIP_NUM_JOINTS)
+				{
+					const int value = stride_clip.joint[channel];
+					const double off = ABS(joints->value[value] - reference.value[value]);
+					if(off > worst)
+						worst = off;
+					channel++;
+				}
+				int knee = 0;
+				while(knee < 2)
+				{
+					const double off = ABS(joints->value[knees[knee]] - reference.value[knees[knee]]);
+					if(off > worst_knee)
+						worst_knee = off;
+					knee_total += off;
+					knees_checked++;
+					knee++;
+				}
+				checked++;
+			}
+			each++;
+		}
+		tick++;
+	}
+	delete world;
+	const int pass = checked > 0 && worst <= STRIDE_TOLERANCE && worst_knee <= STRIDE_KNEE_TOLERANCE;
+	ECHO_PRINT("%s: %i walkers, %i updates, %li poses checked against the trigonometry\n", file_name, walkers, ticks, checked);
+	ECHO_PRINT("\tarms and thighs: worst %.3f degrees (tolerance %.2f)\n", worst, STRIDE_TOLERANCE);
+	ECHO_PRINT("\tknees:           mean %.3f, worst %.3f degrees (tolerance %.2f)\n"
+		, knees_checked > 0 ? knee_total / knees_checked : 0, worst_knee, STRIDE_KNEE_TOLERANCE);
+	ECHO_PRINT("\t%s\n", pass ? "OK" : "FAILED");
+	return(pass ? 0 : 1);
+}
+#endif
@@ -0,0 +1,92 @@
+// echo_bench.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "echo_platform.h"
+
+#ifndef __ECHO_BENCH__
+#define __ECHO_BENCH__
+#ifndef ECHO_NDS
+	/** Gets the time from a monotonic clock, for timing the benchmarks
+	 * @return Seconds since some arbitrary point
+	 */
+	double echo_bench_now();
+	/** Micro-benchmark of lineSeg_intersect_batch against calling lineSeg_intersect
+	 * once per edge; also checks that they agree on every edge.
+	 * @param num_edges Number of random edges each segment is tested against
+	 * @param passes Number of segments to test
+	 * @return 0 if both agree, 1 otherwise (usable as an exit code)
+	 */
+	int echo_bench_edges(int num_edges, int passes);
+	/** Loads (and deletes) a stage over and over, and prints how long a load takes,
+	 * and how many heap allocations and bytes a load makes
+	 * @param file_name The stage file
+	 * @param passes Number of times to load it
+	 * @return 0 if the stage loaded, 1 otherwise (usable as an exit code)
+	 */
+	int echo_bench_load(char* file_name, int passes);
+	/** Plays the stage in an offscreen context (see echo_offscreen.h), turning the
+	 * camera now and then, and prints the CPU time and GL time of a frame, and
+	 * how many grids were drawn and culled
+	 * @param file_name The stage file
+	 * @param frames Number of frames to draw
+	 * @param path How to draw the meshes (a MESH_PATH_ constant), or -1 for each in turn
+	 * @param zoom How much closer than main.cpp the projection is (1 shows the whole stage)
+	 * @return 0 if it ran, 1 if there is no offscreen context or the stage didn't load
+	 */
+	int echo_bench_render(char* file_name, int frames, int path, float zoom);
+	/** Picks pixels of the stage in an offscreen context (stage::pick, on the GPU), and
+	 * checks them against an id image drawn independently, as plain quads of each grid's
+	 * cached points.  Pixels within PICK_MARGIN of another id, and pixels a stair is picked at
+	 * (the reference has no stairs), are left out.
+	 * @param file_name The stage file
+	 * @param pixels Number of pixels to pick at each angle
+	 * @param zoom How much closer than main.cpp the projection is (1 shows the whole stage)
+	 * @return 0 if every pick matched, 1 otherwise (or if there is no offscreen context, the stage didn't load or no grid was drawn big enough)
+	 */
+	int echo_bench_pick(char* file_name, int pixels, float zoom);
+	/** Draws a square of walking mannequins in an offscreen context, each way
+	 * there is to draw them (draw_character on the matrix stack, char_pose with
+	 * one draw per part, and instanced), and prints the CPU time and GL time of a frame
+	 * @param num Number of mannequins
+	 * @param frames Number of frames to draw each way
+	 * @return 0 if it ran, 1 if there is no offscreen context
+	 */
+	int echo_bench_crowd(int num, int frames);
+	/** Plays the stage with a crowd of characters walking on their own, without the GL,
+	 * with 1, 2, 4... threads up to the number given, and prints the time per update
+	 * of each; also checks that every number of threads plays the same
+	 * @param file_name The stage file
+	 * @param walkers Number of characters
+	 * @param ticks Number of updates to play
+	 * @param threads Most threads to try
+	 * @return 0 if it ran and every number of threads played the same, 1 otherwise
+	 */
+	int echo_bench_walkers(char* file_name, int walkers, int ticks, int threads);
+	/** Plays the stage with a crowd of walkers like echo_bench_walkers, and checks the
+	 * joints grid_mode_joints gets from the stride clip against the trigonometry the clip
+	 * was baked from (echo_char#stride_reference)
+	 * @param file_name The stage file
+	 * @param walkers Number of characters
+	 * @param ticks Number of updates to play
+	 * @return 0 if the joints are within STRIDE_TOLERANCE (and the knees within
+	 * STRIDE_KNEE_TOLERANCE), 1 otherwise
+	 */
+	int echo_bench_stride(char* file_name, int walkers, int ticks);
+#endif
+#endif
@@ -0,0 +1,594 @@
+// echo_capture.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cstdio>
+#include <cstring>
+
+#include "echo_platform.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_glext.h"
+#include "echo_thread.h"
+#include "echo_bench.h"
+#include "echo_capture.h"
+
+#ifndef ECHO_NDS
+
+#ifdef ECHO_OSX
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// Pixel buffers in the ring; the oldest is read a frame or two after it was queued
+#define CAPTURE_PBOS		3
+/// Frames read back but not yet written, waiting for the thread
+#define CAPTURE_QUEUE		8
+/// Largest stored deflate block of the PNGs
+#define PNG_BLOCK			65535
+/// Bytes the Adler-32 sums can take before they have to be reduced (zlib's NMAX)
+#define ADLER_RUN			5552
+
+/// Is it capturing?; CAPTURE_ constant; size of a frame; frames per second
+static int capturing = 0, format = CAPTURE_PNG, width = 0, height = 0, rate = 0;
+/// Number in the file names
+static int session = 0;
+/// Frames seen by capture_frame, dropped since the GPU or the thread was behind, written by the thread
+static int frames = 0, dropped = 0, written = 0;
+/// Time spent in capture_frame, in seconds
+static double frame_time = 0;
+/// Read back through pixel buffers?; know when they are done through fences?
+static int use_pbo = 0, use_sync = 0;
+
+/// The ring of pixel buffers
+static GLuint pbos[CAPTURE_PBOS];
+/// Signaled once the read into the pixel buffer is done (if use_sync)
+static echo_sync_t fences[CAPTURE_PBOS];
+/// Frame number each pixel buffer holds
+static int pbo_frame[CAPTURE_PBOS];
+/// Index of the oldest pixel buffer that was read into; how many were
+static int pbo_oldest = 0, pbo_pending = 0;
+
+/// Frames waiting for the thread (BGRA, bottom row first), and their numbers
+static unsigned char* queue[CAPTURE_QUEUE];
+static int queue_frame[CAPTURE_QUEUE];
+/// Index of the oldest frame in the queue; how many there are; should the thread stop once it's empty?
+static int queue_head = 0, queue_count = 0, stopping = 0;
+/// Guards the queue
+static echo_lock lock;
+/// Writes the queue
+static echo_thread writer;
+
+/// The video (CAPTURE_Y4M)
+static FILE* video = NULL;
+/// Space for a converted frame, only touched by the thread
+static unsigned char* scratch = NULL;
+/// Number of the frame last written to the video
+static int last_written = -1;
+
+const char* capture_format_name(int format)
+{
+	switch(format)
+	{
+		case CAPTURE_PNG:
+			return("png");
+		case CAPTURE_Y4M:
+			return("y4m");
+	}
+	return("?");
+}
+
+int capture_active()
+{
+	return(capturing);
+}
+
+/// Does the file exist?
+static int exists(const char* name)
+{
+	FILE* f = fopen(name, "rb");
+	if(f)
+		fclose(f);
+	return(f != NULL);
+}
+
+// ----PNG----
+
+/// CRC-32 table of the PNG chunks
+static unsigned int crc_table[256];
+
+static void make_crc_table()
+{
+	unsigned int n = 0;
+	while(n < 256)
+	{
+		unsigned int c = n;
+		int k = 0;
+		while(k < 8)
+		{
+			c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			k++;
+		}
+		crc_table[n] = c;
+		n++;
+	}
+}
+
+static unsigned int crc(unsigned int c, const unsigned char* data, size_t len)
+{
+	size_t each = 0;
+	while(each < len)
+	{
+		c = crc_table[(c ^ data[each]) & 0xFF] ^ (c >> 8);
+		each++;
+	}
+	return(c);
+}
+
+/// Stores n big-endian
+static void put32(unsigned char* at, unsigned int n)
+{
+	at[0] = (unsigned char)(n >> 24);
+	at[1] = (unsigned char)(n >> 16);
+	at[2] = (unsigned char)(n >> 8);
+	at[3] = (unsigned char)n;
+}
+
+/// Writes a chunk of the PNG; type is 4 characters
+static void write_chunk(FILE* f, const char* type, const unsigned char* data, unsigned int len)
+{
+	unsigned char head[8];
+	put32(head, len);
+	memcpy(head + 4, type, 4);
+	unsigned char tail[4];
+	put32(tail, ~crc(crc(0xFFFFFFFFu, head + 4, 4), data, len));
+	fwrite(head, 1, 8, f);
+	fwrite(data, 1, len, f);
+	fwrite(tail, 1, 4, f);
+}
+
+/// Size of the zlib stream of a frame, stored (not compressed)
+static size_t png_stream_size()
+{
+	const size_t raw = (size_t)height * (1 + 3 * width);
+	return(2 + raw + 5 * ((raw + PNG_BLOCK - 1) / PNG_BLOCK) + 4);
+}
+
+/** Writes a frame as an RGB PNG.  The deflate stream only has stored blocks,
+ * so there is no zlib to link to; the files are as big as the pixels.
+ */
+static void write_png(const unsigned char* bgra, int frame)
+{
+	char name[64];
+	sprintf(name, "capture_%i_%05i.png", session, frame);
+	FILE* f = fopen(name, "wb");
+	if(!f)
+	{
+		ECHO_PRINT("capture: couldn't open %s\n", name);
+		return;
+	}
+	static const unsigned char signature[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+	fwrite(signature, 1, 8, f);
+	unsigned char header[13];
+	put32(header, width);
+	put32(header + 4, height);
+	header[8] = 8;		//bits per channel
+	header[9] = 2;		//RGB
+	header[10] = header[11] = header[12] = 0;
+	write_chunk(f, "IHDR", header, 13);
+	
+	/// zlib header, then stored blocks of the rows (filter 0 first), then the Adler-32
+	unsigned char* out = scratch;
+	*out++ = 0x78;
+	*out++ = 0x01;
+	const size_t raw = (size_t)height * (1 + 3 * width);
+	size_t block_left = 0, raw_left = raw;
+	unsigned int a = 1, b = 0, run = 0;
+	int y = 0;
+	while(y < height)
+	{
+		/// The frame is bottom row first
+		const unsigned char* src = bgra + (size_t)(height - 1 - y) * width * 4;
+		int x = -1;
+		while(x < width)
+		{
+			unsigned char px[3];
+			int n = 3;
+			if(x < 0)
+			{
+				px[0] = 0;
+				n = 1;
+			}
+			else
+			{
+				px[0] = src[x * 4 + 2];
+				px[1] = src[x * 4 + 1];
+				px[2] = src[x * 4];
+			}
+			int each = 0;
+			while(each < n)
+			{
+				if(block_left == 0)
+				{
+					block_left = raw_left < PNG_BLOCK ? raw_left : PNG_BLOCK;
+					raw_left -= block_left;
+					*out++ = raw_left == 0 ? 1 : 0;
+					*out++ = (unsigned char)block_left;
+					*out++ = (unsigned char)(block_left >> 8);
+					*out++ = (unsigned char)~block_left;
+					*out++ = (unsigned char)(~block_left >> 8);
+				}
+				*out++ = px[each];
+				a += px[each];
+				b += a;
+				if(++run == ADLER_RUN)
+				{
+					a %= 65521;
+					b %= 65521;
+					run = 0;
+				}
+				block_left--;
+				each++;
+			}
+			x++;
+		}
+		y++;
+	}
+	put32(out, ((b % 65521) << 16) | (a % 65521));
+	out += 4;
+	write_chunk(f, "IDAT", scratch, (unsigned int)(out - scratch));
+	write_chunk(f, "IEND", NULL, 0);
+	fclose(f);
+}
+
+// ----Y4M----
+
+/// Size of the chroma planes
+#define CHROMA_WIDTH	((width + 1) / 2)
+#define CHROMA_HEIGHT	((height + 1) / 2)
+
+/// BT.601 limited range, in 8.8 fixed point
+#define LUMA(r, g, b)	(unsigned char)(16 + ((66 * (r) + 129 * (g) + 25 * (b) + 128) >> 8))
+#define CB(r, g, b)		(unsigned char)(128 + ((-38 * (r) - 74 * (g) + 112 * (b) + 128) >> 8))
+#define CR(r, g, b)		(unsigned char)(128 + ((112 * (r) - 94 * (g) - 18 * (b) + 128) >> 8))
+
+/** Converts a frame to 4:2:0 YUV and writes it to the video.  If frames were
+ * dropped in between, it is written that many more times, so the video keeps time.
+ */
+static void write_y4m(const unsigned char* bgra, int frame)
+{
+	unsigned char* luma = scratch;
+	unsigned char* cb = luma + width * height;
+	unsigned char* cr = cb + CHROMA_WIDTH * CHROMA_HEIGHT;
+	int y = 0;
+	while(y < height)
+	{
+		const unsigned char* src = bgra + (size_t)(height - 1 - y) * width * 4;
+		int x = 0;
+		while(x < width)
+		{
+			luma[y * width + x] = LUMA(src[x * 4 + 2], src[x * 4 + 1], src[x * 4]);
+			x++;
+		}
+		y++;
+	}
+	/// Each chroma sample is the mean of (up to) 2x2 pixels
+	y = 0;
+	while(y < CHROMA_HEIGHT)
+	{
+		int x = 0;
+		while(x < CHROMA_WIDTH)
+		{
+			int r = 0, g = 0, b = 0, n = 0, dy = 0;
+			while(dy < 2 && y * 2 + dy < height)
+			{
+				const unsigned char* src = bgra + (size_t)(height - 1 - (y * 2 + dy)) * width * 4;
+				int dx = 0;
+				while(dx < 2 && x * 2 + dx < width)
+				{
+					const unsigned char* px = src + (x * 2 + dx) * 4;
+					r += px[2];
+					g += px[1];
+					b += px[0];
+					n++;
+					dx++;
+				}
+				dy++;
+			}
+			r /= n;
+			g /= n;
+			b /= n;
+			cb[y * CHROMA_WIDTH + x] = CB(r, g, b);
+			cr[y * CHROMA_WIDTH + x] = CR(r, g, b);
+			x++;
+		}
+		y++;
+	}
+	const size_t size = (size_t)width * height + 2 * CHROMA_WIDTH * CHROMA_HEIGHT;
+	int times = last_written < 0 ? 1 : frame - last_written;
+	while(times > 0)
+	{
+		fputs("FRAME\n", video);
+		fwrite(scratch, 1, size, video);
+		times--;
+	}
+	last_written = frame;
+}
+
+// ----THREAD----
+
+/// Writes the frames of the queue as they come, until capture_stop
+static void write_frames(void* arg)
+{
+	echo_lock_lock(&lock);
+	while(1)
+	{
+		while(queue_count == 0 && !stopping)
+			echo_lock_wait(&lock);
+		if(queue_count == 0)
+			break;
+		const int index = queue_head;
+		echo_lock_unlock(&lock);
+		
+		/// The main thread doesn't touch the head of the queue until it's let go of
+		if(format == CAPTURE_Y4M)
+			write_y4m(queue[index], queue_frame[index]);
+		else
+			write_png(queue[index], queue_frame[index]);
+		
+		echo_lock_lock(&lock);
+		queue_head = (queue_head + 1) % CAPTURE_QUEUE;
+		queue_count--;
+		written++;
+	}
+	echo_lock_unlock(&lock);
+}
+
+/** Gets the space for the next frame of the queue
+ * @return The space, or NULL if the queue is full
+ */
+static unsigned char* queue_tail()
+{
+	echo_lock_lock(&lock);
+	unsigned char* ret = queue_count < CAPTURE_QUEUE ? queue[(queue_head + queue_count) % CAPTURE_QUEUE] : NULL;
+	echo_lock_unlock(&lock);
+	return(ret);
+}
+
+/// Hands the frame in queue_tail to the thread
+static void queue_push(int frame)
+{
+	echo_lock_lock(&lock);
+	queue_frame[(queue_head + queue_count) % CAPTURE_QUEUE] = frame;
+	queue_count++;
+	echo_lock_wake(&lock);
+	echo_lock_unlock(&lock);
+}
+
+/** Moves the pixel buffers that are done to the queue, oldest first
+ * @param wait Wait for the ones that aren't done?
+ */
+static void collect(int wait)
+{
+	while(pbo_pending > 0)
+	{
+		const int each = pbo_oldest;
+		int ready = wait;
+		if(!ready)
+		{
+			/// Without fences, a buffer that old is most likely done
+			if(use_sync)
+			{
+				const GLenum status = echo_glClientWaitSync(fences[each], 0, 0);
+				ready = (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+			}
+			else
+				ready = (pbo_pending >= CAPTURE_PBOS - 1);
+		}
+		if(!ready)
+			return;
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[each]);
+		const unsigned char* pixels = (const unsigned char*)echo_glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+		unsigned char* tail = queue_tail();
+		if(pixels && tail)
+		{
+			memcpy(tail, pixels, (size_t)width * height * 4);
+			queue_push(pbo_frame[each]);
+		}
+		else
+			dropped++;
+		if(pixels)
+			echo_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		if(use_sync)
+			echo_glDeleteSync(fences[each]);
+		pbo_oldest = (pbo_oldest + 1) % CAPTURE_PBOS;
+		pbo_pending--;
+	}
+}
+
+// ----CAPTURE----
+
+/// Frees the queue, the pixel buffers and the video
+static void release()
+{
+	int each = 0;
+	while(each < CAPTURE_QUEUE)
+	{
+		delete[] queue[each];
+		queue[each] = NULL;
+		each++;
+	}
+	delete[] scratch;
+	scratch = NULL;
+	if(use_pbo)
+		echo_glDeleteBuffers(CAPTURE_PBOS, pbos);
+	if(video)
+	{
+		fclose(video);
+		video = NULL;
+	}
+}
+
+STATUS capture_start(int my_format, int w, int h, int fps)
+{
+	if(capturing || w <= 0 || h <= 0)
+		return(FAIL);
+	format = my_format;
+	width = w;
+	height = h;
+	rate = fps;
+	
+	/// The first number that isn't taken
+	char name[64];
+	session = 0;
+	do
+	{
+		session++;
+		if(format == CAPTURE_Y4M)
+			sprintf(name, "capture_%i.y4m", session);
+		else
+			sprintf(name, "capture_%i_%05i.png", session, 0);
+	} while(exists(name));
+	if(format == CAPTURE_Y4M)
+	{
+		video = fopen(name, "wb");
+		if(!video)
+		{
+			ECHO_PRINT("capture: couldn't open %s\n", name);
+			return(FAIL);
+		}
+		fprintf(video, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C420\n", width, height, rate);
+	}
+	else
+		make_crc_table();
+	
+	const size_t frame_size = (size_t)width * height * 4;
+	int each = 0;
+	while(each < CAPTURE_QUEUE)
+	{
+		queue[each] = new unsigned char[frame_size];
+		CHKPTR(queue[each]);
+		each++;
+	}
+	const size_t y4m_size = (size_t)width * height + 2 * CHROMA_WIDTH * CHROMA_HEIGHT;
+	scratch = new unsigned char[format == CAPTURE_Y4M ? y4m_size : png_stream_size()];
+	CHKPTR(scratch);
+	queue_head = queue_count = stopping = 0;
+	frames = dropped = written = 0;
+	frame_time = 0;
+	last_written = -1;
+	
+	echo_glext_init();
+	use_pbo = echo_glext_has_pbo();
+	use_sync = use_pbo && echo_glext_has_sync();
+	if(use_pbo)
+	{
+		echo_glGenBuffers(CAPTURE_PBOS, pbos);
+		each = 0;
+		while(each < CAPTURE_PBOS)
+		{
+			echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[each]);
+			echo_glBufferData(GL_PIXEL_PACK_BUFFER, frame_size, NULL, GL_STREAM_READ);
+			each++;
+		}
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+	pbo_oldest = pbo_pending = 0;
+	
+	echo_lock_init(&lock);
+	if(echo_thread_start(&writer, write_frames, NULL) == FAIL)
+	{
+		ECHO_PRINT("capture: couldn't start the thread\n");
+		echo_lock_free(&lock);
+		release();
+		return(FAIL);
+	}
+	capturing = 1;
+	ECHO_PRINT("capture: %s at %ix%i, read back %s\n", name, width, height
+		, use_sync ? "through pixel buffers and fences" : (use_pbo ? "through pixel buffers" : "right away"));
+	return(WIN);
+}
+
+void capture_frame(int w, int h)
+{
+	if(!capturing)
+		return;
+	if(w != width || h != height)
+	{
+		ECHO_PRINT("capture: the window is %ix%i now; stopping\n", w, h);
+		capture_stop();
+		return;
+	}
+	const double start = echo_bench_now();
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	if(use_pbo)
+	{
+		collect(0);
+		/// Every pixel buffer is still being read into; the GPU is that far behind
+		if(pbo_pending == CAPTURE_PBOS)
+			dropped++;
+		else
+		{
+			const int each = (pbo_oldest + pbo_pending) % CAPTURE_PBOS;
+			echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[each]);
+			glReadPixels(0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, NULL);
+			echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			if(use_sync)
+				fences[each] = echo_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			pbo_frame[each] = frames;
+			pbo_pending++;
+		}
+	}
+	else
+	{
+		/// No pixel buffers: this waits on the GPU, but still not on the disk
+		unsigned char* tail = queue_tail();
+		if(tail)
+		{
+			glReadPixels(0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, tail);
+			queue_push(frames);
+		}
+		else
+			dropped++;
+	}
+	frames++;
+	frame_time += echo_bench_now() - start;
+}
+
+void capture_stop()
+{
+	if(!capturing)
+		return;
+	if(use_pbo)
+		collect(1);
+	echo_lock_lock(&lock);
+	stopping = 1;
+	echo_lock_wake(&lock);
+	echo_lock_unlock(&lock);
+	echo_thread_join(&writer);
+	echo_lock_free(&lock);
+	capturing = 0;
+	release();
+	ECHO_PRINT("capture: %i of %i frames written, %i dropped, %.3f ms a frame in capture_frame\n"
+		, written, frames, dropped, frames > 0 ? frame_time / frames * 1000 : 0);
+}
+
+#endif
@@ -0,0 +1,62 @@
+// echo_capture.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+
+#ifndef __ECHO_CAPTURE__
+#define __ECHO_CAPTURE__
+
+/// Numbered PNG screenshots, one per frame
+#define CAPTURE_PNG			0
+/// One raw YUV4MPEG2 (4:2:0) video
+#define CAPTURE_Y4M			1
+#define CAPTURE_NUM_FORMATS	2
+
+#ifndef ECHO_NDS
+/** The name of a CAPTURE_ constant, as -c takes it
+ * @param format A CAPTURE_ constant
+ */
+const char* capture_format_name(int format);
+/** Starts capturing the frames of the window to capture_<n>.y4m or
+ * capture_<n>_<frame>.png, with the first free n.  The frames are read back
+ * through a ring of pixel buffers a frame or two behind, and a thread writes
+ * them, so capture_frame doesn't wait on the GPU or the disk.
+ * @param format A CAPTURE_ constant
+ * @param w Width of the window
+ * @param h Height of the window
+ * @param fps Frames per second (for the video)
+ * @return WIN if it started
+ */
+STATUS capture_start(int format, int w, int h, int fps);
+/** Queues the back buffer, and hands the frames that have been read back to
+ * the thread.  Call after drawing, before the swap.  Frames are dropped (and
+ * counted) instead of waiting if the GPU or the disk falls behind.
+ * @param w Width of the window; the capture stops if it isn't the size it started at
+ * @param h Height of the window
+ */
+void capture_frame(int w, int h);
+/// Writes what is still queued, stops the thread and prints how it went
+void capture_stop();
+/// Is it capturing?
+int capture_active();
+#endif
+
+#endif
@@ -34,3 +34,24 @@ int reset_joints(echo_char_joints* joints)
 		joints->value[each] = 0;
 	return(WIN);
 }
+/** Interpolate between two sets of joints, along the shorter way around for each angle
+ * @param from Joints at alpha = 0
+ * @param to Joints at alpha = 1
+ * @param alpha How far from "from" to "to"
+ * @param out Where to store the result (may be from or to)
+ */
+void lerp_joints(const echo_char_joints* from, const echo_char_joints* to, float alpha, echo_char_joints* out)
+{
+	int each = 0;
+	while(each < NUM_VALUES)
+	{
+		float diff = to->value[each] - from->value[each];
+		/// The falling spin wraps from 360 to 0; don't turn all the way back
+		if(diff > 180)
+			diff -= 360;
+		else if(diff < -180)
+			diff += 360;
+		out->value[each] = from->value[each] + diff * alpha;
+		each++;
+	}
+}
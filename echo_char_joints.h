@@ -127,4 +127,11 @@ union echo_char_joints
  * @param joints Joints to set to zero
  */
 int reset_joints(echo_char_joints* joints);
+/** Interpolate between two sets of joints, along the shorter way around for each angle
+ * @param from Joints at alpha = 0
+ * @param to Joints at alpha = 1
+ * @param alpha How far from "from" to "to"
+ * @param out Where to store the result (may be from or to)
+ */
+void lerp_joints(const echo_char_joints* from, const echo_char_joints* to, float alpha, echo_char_joints* out);
 #endif
@@ -18,12 +18,9 @@
 */
 
 /** Your standard libraries
- * typeinfo is used to find if the grid is a hole, so the character can fall
- * through the hole if the first grid is one.
  */
 #include <cstdlib>
 #include <iostream>
-#include <typeinfo>
 #include <cmath>
 #include <cfloat>
 
@@ -34,29 +31,30 @@
 #include "echo_gfx.h"
 #include "echo_debug.h"
 #include "echo_math.h"
-#include "echo_ns.h"
+#include "echo_world.h"
 #include "echo_character.h"
 #include "echo_char_joints.h"
+#include "echo_clip.h"
 #include "echo_stage.h"
 
-/** Grids; just launchers and holes are discriminated against, because
+/** Grids; just launchers and holes are discriminated against (by their kind), because
  * the character is responsible for flying and falling
  */
 #include "launcher.h"
 #include "grid.h"
 #include "hole.h"
+#include "grid_kind.h"
 
 /// Need to measure the body sizes in order to do IK correctly
 #include "gen/gen.h"
 
-/// Convenience macro to draw at a particular vector3f
-#define DRAW_VEC(vec)		draw((vec)->x, (vec)->y, (vec)->z)
-
 /// The acceleration constant (Units / s^2)
 #define ACCEL					15.0f
 
 /// How high above the start grid does the character start?
 #define STARTY					10
+/// Room for this many grids arrived at between goal merges, so updates don't allocate
+#define GOALS_HIT_RESERVE		4
 
 const float CHARACTER_SPEEDS[] = { 0.07f, 0.25f, 0.00f, -0.50f, 14.4913767f, 0.00f };
 	
@@ -64,36 +62,26 @@ const float CHARACTER_SPEEDS[] = { 0.07f, 0.25f, 0.00f, -0.50f, 14.4913767f, 0.0
 const float LAUNCH_INIT_X = CHARACTER_SPEEDS[LAUNCH] / 7;
 
 /** Initialize, and prepare to fall to that grid.
+ * @param my_world The world the character is in
  * @param g1 The initial grid on which to spawn
  */
-echo_char::echo_char(grid* g1)
+echo_char::echo_char(echo_world* my_world, grid* g1)
 {
+	world = my_world;
+	fall_spin = 0;
 	/// num_goals is the total number of goals this character has passed; shouldn't be reset
 	num_goals = 0;
-	/// Set fall_position to NULL, or else init/land will attempt to delete it.
-	fall_position = NULL;
-	/// Set fly_direction to NULL, or else next_grid will attempt to delete it.
-	fly_direction = NULL;
+	goals_hit.reserve(GOALS_HIT_RESERVE);
 	/// initialize
 	init(g1);
 }
 /// Destructor
 echo_char::~echo_char()
 {
-	/// fall_position is the only dynamically constructed member
-	if(fall_position != NULL)
-	{
-		delete fall_position;
-		fall_position = NULL;
-	}
-	if(fly_direction != NULL)
-	{
-		delete fly_direction;
-		fly_direction = NULL;
-	}
+	/// fall_position and fly_direction are held by value, so there is nothing to free
 }
 
-/** @return If the character is paused; should actually relegate to echo_ns.
+/** @return If the character is paused; should actually relegate to echo_world.
  */
 int echo_char::is_paused()
 {
@@ -116,16 +104,16 @@ void echo_char::initialize_falling(vector3f* pos)
 	if(pos != NULL)
 	{
 		/// fall_position is used as the position if the camera angle is (0, 0, 0)
-		fall_position = pos->neg_rotate_yx(echo_ns::angle);
+		fall_position = world->get_basis().neg_rotate_yx(*pos);
 	}
 	else if(grid1 != NULL)
 	{
-		/// Get the info
-		grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-		if(i1 != NULL)
+		/// Get the position
+		vector3f* pos1 = grid_pos(grid1);
+		if(pos1 != NULL)
 		{
 			/// fall_position is used as the position if the camera angle is (0, 0, 0)
-			fall_position = i1->pos->neg_rotate_yx(echo_ns::angle);
+			fall_position = world->get_basis().neg_rotate_yx(*pos1);
 		}
 	}
 	else
@@ -167,23 +155,23 @@ void echo_char::initialize_falling(vector3f* pos)
  * v_oy / 7 = v_ox
  * 
  * @param pos An arbitrary position to launch from.  If this is NULL, then grid1's position will be used
- * @param direction Direction to launch towards laterally (on the xz-plane).  If this is NULL, then get_direction will be used.  WILL BE DELETED!!!
+ * @param direction Direction to launch towards laterally (on the xz-plane).  If this is NULL, then fly_direction will be used.
  */
 void echo_char::initialize_launching(vector3f* pos, vector3f* direction)
 {
 	if(pos != NULL)
 	{
 		/// fall_position is used as the position if the camera angle is (0, 0, 0)
-		fall_position = pos->neg_rotate_yx(echo_ns::angle);
+		fall_position = world->get_basis().neg_rotate_yx(*pos);
 	}
 	else if(grid1 != NULL)
 	{
-		/// Get the info
-		grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-		if(i1 != NULL)
+		/// Get the position
+		vector3f* pos1 = grid_pos(grid1);
+		if(pos1 != NULL)
 		{
 			/// fall_position is used as the position if the camera angle is (0, 0, 0)
-			fall_position = i1->pos->neg_rotate_yx(echo_ns::angle);
+			fall_position = world->get_basis().neg_rotate_yx(*pos1);
 		}
 	}
 	else
@@ -191,10 +179,7 @@ void echo_char::initialize_launching(vector3f* pos, vector3f* direction)
 	
 	/// Initialize direction if it isn't already
 	if(direction == NULL)
-	{
-		direction = new vector3f(fly_direction->x, fly_direction->y, fly_direction->z);
-		
-	}
+		direction = &fly_direction;
 	/// Get the length of the direction...
 	const float dir_length = sqrt(direction->x * direction->x + direction->z * direction->z);
 	/// And normalize the 
@@ -203,7 +188,6 @@ void echo_char::initialize_launching(vector3f* pos, vector3f* direction)
 	ECHO_PRINT("x_speed: %f\n", x_speed);
 	ECHO_PRINT("y_speed: %f\n", CHARACTER_SPEEDS[LAUNCH]);
 	ECHO_PRINT("z_speed: %f\n", z_speed);
-	delete direction;
 	
 	/// Set the mode to launch
 	mode = LAUNCH;
@@ -219,20 +203,16 @@ void echo_char::initialize_fall_from_sky()
 {
 	if(grid1 != NULL)
 	{
-		/// Get the info
-		grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-		if(i1 != NULL)
+		/// Get the position
+		vector3f* pos1 = grid_pos(grid1);
+		if(pos1 != NULL)
 		{
 			/// Set the target level to grid1's y-coordinate
-			target_y = i1->pos->y;
-			/// Clear fall_position first
-			if(fall_position != NULL)
-				delete fall_position;
+			target_y = pos1->y;
 			/// Copy the position of grid1
-			fall_position = new vector3f();
-			fall_position->set(i1->pos);
+			fall_position.set(pos1);
 			/// But also put fall_position above grid1
-			fall_position->y += STARTY;
+			fall_position.y += STARTY;
 		}
 	}
 	else
@@ -248,13 +228,13 @@ void echo_char::change_speed()
 	if(grid1 != NULL)
 	{
 		/// First grid is an hole, and there is no second grid (no esc) -> Fall into hole
-		if(typeid(*grid1) == typeid(hole) && grid2 == NULL)
+		if(grid1->get_kind() == GRID_KIND_HOLE && grid2 == NULL)
 		{
 			ECHO_PRINT("falling into hole...\n");
 			initialize_falling(NULL);
 		}
 		/// First grid is a launcher, and there is no second grid (no esc) -> Launched
-		else if(typeid(*grid1) == typeid(launcher) && grid2 == NULL)
+		else if(grid1->get_kind() == GRID_KIND_LAUNCHER && grid2 == NULL)
 		{
 			ECHO_PRINT("being launched!\n");
 			initialize_launching(NULL, NULL);
@@ -316,6 +296,8 @@ void echo_char::init(grid* g1)
 	land(g1, false);
 	/// Initialize the landing sequence
 	initialize_fall_from_sky();
+	/// Nothing to interpolate from yet
+	save_pose(&prev_pose);
 }
 /** Makes the character land on the grid
  * @param g1 Where to land on
@@ -328,12 +310,7 @@ void echo_char::land(grid* g1, int do_change_speed)
 	/// Set its first grid to g1
 	grid1 = g1;
 	/// Set its next grid to g1's next if we can, or just NULL
-	grid2 = g1 ? grid1->get_next(echo_ns::angle, grid1) : NULL;
-	/// Assume that the character is in Grid Mode, and clear fall_position
-	if(fall_position != NULL)
-		delete fall_position;
-	fall_position = NULL;
-	
+	grid2 = g1 ? grid1->tag_get_next(world->angle, grid1) : NULL;
 	/// The character hasn't started walking yet
 	grid1per = 1;
 	
@@ -363,22 +340,50 @@ void echo_char::reset()
 {
 	init(start);
 }
-/** Checks if the grid given is a goal, and if it is, the character
- * will toggle the goal, set it as its new spawn spot, and add to the goal count
+/** Notes the grid as arrived at; if it's a goal, it's reached at merge_goals
  * @param g Grid to check
  */
 void echo_char::check_goal(grid* g)
 {
-	/// Is the grid given a goal?
-	if(g->is_goal(echo_ns::angle))
+	goals_hit.push_back(g);
+}
+/** For each grid arrived at since the last call that is (still) a goal: toggles the goal,
+ * sets it as the new spawn spot, and adds to the goal count.  echo_world::update calls it for
+ * each character in turn after all of them have moved, so they all move through the same stage
+ */
+void echo_char::merge_goals()
+{
+	std::vector<grid*>::iterator it = goals_hit.begin();
+	while(it != goals_hit.end())
 	{
-		/// Set our next spawn spot at that goal
-		start = g;
-		/// Toggle the goal
-		g->toggle_goal(echo_ns::angle);
-		/// Increment the character's goal count
-		num_goals++;
+		grid* g = *it;
+		/// Is the grid given a goal? (another character may have just taken it)
+		const stage_view* view = world->current_stage ? world->current_stage->get_view(world->angle) : NULL;
+		const int index = view ? view->index_of(g) : -1;
+		if(index >= 0 ? view->is_goal(index) : g->is_goal(world->angle))
+		{
+			/// Set our next spawn spot at that goal
+			start = g;
+			/// Toggle the goal
+			g->toggle_goal(world->angle);
+			/// The goal (and whatever it triggered) changed
+			if(world->current_stage)
+				world->current_stage->invalidate_view();
+			/// Increment the character's goal count
+			num_goals++;
+		}
+		it++;
 	}
+	/// Keeps the memory for the next update
+	goals_hit.clear();
+}
+/** Is the character falling through a hole or flying from a launcher? Then its update
+ * looks for grids to land on with stage::get_grid_intersection, which isn't safe to share between threads
+ * @return If the character is falling or flying
+ */
+int echo_char::is_falling()
+{
+	return(mode == FALL || mode == LAUNCH);
 }
 
 /// Forces the character to go the next grid (and trigger the goal there, if any)
@@ -390,16 +395,14 @@ void echo_char::next_grid()
 		/// Check if the grid this character just arrived at is a goal
 		check_goal(grid2);
 		
-		/// Clear fly_direction
-		if(fly_direction != NULL)
-			delete fly_direction;
 		/// Save the direction in case grid2 is a launcher
-		fly_direction = get_direction();
+		if(get_direction(&fly_direction) == FAIL)
+			fly_direction.set(0, 0, 0);
 		
 		/// Save the pointer to grid2
 		grid* temp = grid2;
 		/// Get the next-next grid, and store that into grid2
-		grid2 = grid2->get_next(echo_ns::angle, grid1);
+		grid2 = grid2->tag_get_next(world->angle, grid1);
 		/// Store the next grid (was grid2) into grid1
 		grid1 = temp;
 		/// Adjust the speed/mode as needed
@@ -410,29 +413,38 @@ void echo_char::next_grid()
 	grid1per = 1;
 }
 
-/// Take one step in animation and movement; call each frame
-void echo_char::step()
+/** Advances the movement and animation; echo_world::update calls it at a fixed rate
+ * @param dt Time to advance, in milliseconds (WAIT is the tick the speeds were tuned for)
+ */
+void echo_char::update(float dt)
+{
+	/// Keep where the character was, for render to interpolate from
+	save_pose(&prev_pose);
+	advance(dt);
+	mode_joints();
+}
+/** Moves the character without saving the pose (update does that)
+ * @param dt Time to advance, in milliseconds
+ */
+void echo_char::advance(float dt)
 {
-	/// Set the color to white
-	gfx_color3f(1, 1, 1);
 	/// If the character is (re)spawning...
 	if(mode == FALL_FROM_SKY)
 	{
-		/// Draw the fall_position (which is absolute in this case), even if the character is paused
-		DRAW_VEC(fall_position);
+		/// fall_position is absolute in this case
 		if(!paused)
 		{
 			/// Fall by decreasing the y
-			fall_position->y += speed * WAIT / 1000;
+			fall_position.y += speed * dt / 1000;
 			/// The character is accelerating
-			speed -= ACCEL * WAIT / 1000;
+			speed -= ACCEL * dt / 1000;
 			/// If the character is below the target...
-			if(fall_position->y < target_y)
+			if(fall_position.y < target_y)
 			{
 				/// ...and if the character's target is a hole...
-				if(typeid(*grid1) == typeid(hole))
+				if(grid1->get_kind() == GRID_KIND_HOLE)
 					/// ...fall into the hole so that there isn't an weird and unnecessary shift between fall_position and grid1's position.
-					initialize_falling(fall_position);
+					initialize_falling(&fall_position);
 				
 				/// ...and if the character's target is not a hole...
 				else
@@ -445,13 +457,12 @@ void echo_char::step()
 	else if(mode == FALL)
 	{
 		/// Get the abolute position from the relative position stored inside fall_position
-		vector3f* absolute_pos = fall_position->rotate_xy(echo_ns::angle);
-		/// Draw it
-		DRAW_VEC(absolute_pos);
+		const camera_basis& basis = world->get_basis();
+		const vector3f absolute_pos = basis.rotate_xy(fall_position);
 		if(!paused)
 		{
 			/// If the character fell off the stage (defined as 5 units lower than the lowest level)...
-			if(absolute_pos->y < echo_ns::get_lowest_level() - 5)
+			if(absolute_pos.y < world->get_lowest_level() - 5)
 			{
 				/// Reset
 				reset();
@@ -460,9 +471,9 @@ void echo_char::step()
 			else
 			{
 				/// Get the character's next position; same as the current absolute position, but moved downwards
-				vector3f* next_absolute_pos = new vector3f(absolute_pos->x,
-									absolute_pos->y + speed * WAIT / 1000,
-									absolute_pos->z);
+				const vector3f next_absolute_pos(absolute_pos.x,
+									absolute_pos.y + speed * dt / 1000,
+									absolute_pos.z);
 				
 				
 				/// Checking for grids to fall on
@@ -470,52 +481,39 @@ void echo_char::step()
 				/** Get the projected equivalents of the absolute grids;
 				 * it's neg_rotate_xy because that's what the display function in main does
 				 */
-				vector3f* p1 = absolute_pos->neg_rotate_xy(echo_ns::angle);
-				vector3f* p2 = next_absolute_pos->neg_rotate_xy(echo_ns::angle);
+				vector3f p1 = basis.neg_rotate_xy(absolute_pos);
+				vector3f p2 = basis.neg_rotate_xy(next_absolute_pos);
 				/// Get the fall_grid, if any
-				grid* fall_grid = echo_ns::current_stage->get_grid_intersection(p1, p2, echo_ns::angle);
-				/// Clean up
-				delete p1;
-				delete p2;
+				grid* fall_grid = world->current_stage->get_grid_intersection(&p1, &p2, basis);
 				
 				/** If there is a grid to fall on and it isn't a hole
 				 * (otherwise, the character will keep falling through the same hole)
 				 */
-				if(fall_grid != NULL && typeid(*fall_grid) != typeid(hole))
+				if(fall_grid != NULL && fall_grid->get_kind() != GRID_KIND_HOLE)
 				{
-					/// Clear fall_position (don't need to check for NULL, because it'll be too slow, and it won't happen)
-					delete fall_position;
-					fall_position = NULL;
 					/// Land on that grid
 					land(fall_grid, true);
 				}
 				else 
 				{
 					/// Accelerate
-					speed -= ACCEL * WAIT / 1000;
-					/// Clear fall_position (don't need to check for NULL, because it'll be too slow, and it won't happen)
-					delete fall_position;
+					speed -= ACCEL * dt / 1000;
 					/// Get the next fall_position by rotating the next absolute position back
-					fall_position = next_absolute_pos->neg_rotate_yx(echo_ns::angle);
+					fall_position = basis.neg_rotate_yx(next_absolute_pos);
 				}
-				/// Clean up
-				delete next_absolute_pos;
 			}
 		}
-		/// Clean up
-		delete absolute_pos;
 	}
 	/// If the character was launched...
 	else if(mode == LAUNCH)
 	{
 		/// Get the abolute position from the relative position stored inside fall_position
-		vector3f* absolute_pos = fall_position->rotate_xy(echo_ns::angle);
-		/// Draw it
-		DRAW_VEC(absolute_pos);
+		const camera_basis& basis = world->get_basis();
+		const vector3f absolute_pos = basis.rotate_xy(fall_position);
 		if(!paused)
 		{
 			/// If the character fell off the stage (defined as 5 units lower than the lowest level)...
-			if(absolute_pos->y < echo_ns::get_lowest_level() - 5)
+			if(absolute_pos.y < world->get_lowest_level() - 5)
 			{
 				/// Reset
 				reset();
@@ -524,9 +522,9 @@ void echo_char::step()
 			else
 			{
 				/// Get the character's next position; same as the current absolute position, but moved downwards
-				vector3f* next_absolute_pos = new vector3f(absolute_pos->x + x_speed * WAIT / 1000,
-									absolute_pos->y + speed * WAIT / 1000,
-									absolute_pos->z + z_speed * WAIT / 1000);
+				const vector3f next_absolute_pos(absolute_pos.x + x_speed * dt / 1000,
+									absolute_pos.y + speed * dt / 1000,
+									absolute_pos.z + z_speed * dt / 1000);
 				
 				
 				grid* fall_grid = NULL;
@@ -539,41 +537,29 @@ void echo_char::step()
 					/** Get the projected equivalents of the absolute grids;
 					 * it's neg_rotate_xy because that's what the display function in main does
 					 */
-					vector3f* p1 = absolute_pos->neg_rotate_xy(echo_ns::angle);
-					vector3f* p2 = next_absolute_pos->neg_rotate_xy(echo_ns::angle);
+					vector3f p1 = basis.neg_rotate_xy(absolute_pos);
+					vector3f p2 = basis.neg_rotate_xy(next_absolute_pos);
 					/// Get the fall_grid, if any
-					fall_grid = echo_ns::current_stage->get_grid_intersection(p1, p2, echo_ns::angle);
-					/// Clean up
-					delete p1;
-					delete p2;
+					fall_grid = world->current_stage->get_grid_intersection(&p1, &p2, basis);
 				}
 				
 				/** If there is a grid to fall on and it isn't a hole
 				 * (otherwise, the character will keep falling through the same hole)
 				 */
-				if(fall_grid != NULL && typeid(*fall_grid) != typeid(hole))
+				if(fall_grid != NULL && fall_grid->get_kind() != GRID_KIND_HOLE)
 				{
-					/// Clear fall_position (don't need to check for NULL, because it'll be too slow, and it won't happen)
-					delete fall_position;
-					fall_position = NULL;
 					/// Land on that grid
 					land(fall_grid, true);
 				}
 				else 
 				{
 					/// Accelerate
-					speed -= ACCEL * WAIT / 1000;
-					/// Clear fall_position (don't need to check for NULL, because it'll be too slow, and it won't happen)
-					delete fall_position;
+					speed -= ACCEL * dt / 1000;
 					/// Get the next fall_position by rotating the next absolute position back
-					fall_position = next_absolute_pos->neg_rotate_yx(echo_ns::angle);
+					fall_position = basis.neg_rotate_yx(next_absolute_pos);
 				}
-				/// Clean up
-				delete next_absolute_pos;
 			}
 		}
-		/// Clean up
-		delete absolute_pos;
 	}
 	/// Else, it's just Grid Mode (requires both grids)
 	else if(grid1 != NULL)
@@ -582,169 +568,216 @@ void echo_char::step()
 		if(grid2 != NULL)
 		{
 			/// Get the positions of the grids...
-			grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-			if(i1 != NULL)
+			vector3f* pos1 = grid_pos(grid1);
+			if(pos1 != NULL)
 			{
-				vector3f* pos1 = i1->pos;
-				grid_info_t* i2 = grid2->get_info(echo_ns::angle);
-				if(i2 != NULL)
+				vector3f* pos2 = grid_pos(grid2);
+				/// If the character is not paused...
+				if(pos2 != NULL && !paused)
 				{
-					vector3f* pos2 = i2->pos;
-					/// If the character is not paused...
-					if(!paused)
+					/// The Grid Mode speeds are per tick of WAIT
+					const float step_speed = speed * (dt / WAIT);
+					/// Step through the animation cycle
+					dist_traveled += step_speed * 2;		/// Slightly inflated
+					dist_traveled_cyclic += step_speed * 180;
+					/// Cycle back if the variables have reached the end
+					if(dist_traveled_cyclic > 360)
 					{
-						/// Step through the animation cycle
-						dist_traveled += speed * 2;		/// Slightly inflated
-						dist_traveled_cyclic += speed * 180;
-						/// Cycle back if the variables have reached the end
-						if(dist_traveled_cyclic > 360)
-						{
-							dist_traveled -= 4;	
-							dist_traveled_cyclic -= 360;
-						}
-						/// Cache the distance between grids
-						dist = pos1->dist(pos2);
-						/** Make the walking slightly more realistic by having the character accelerate/decelerate 
-						 * This particular walk cycle is similar to one here:
-						 * http://www.idleworm.com/how/anm/02w/walk1.shtml
-						 */
-						if(dist_traveled > 0.5f && dist_traveled <= 1)
-							grid1per -= (1 + 1 * echo_cos(90 * dist_traveled - 22.5f)) * speed / dist;
-						else if(dist_traveled > 2.5f && dist_traveled <= 3)
-							grid1per -= (1 + 1 * echo_cos(90 * dist_traveled + 67.5f)) * speed / dist;
-						else
-							grid1per -= speed / dist;
-						
-						/// If the character reached the end of its walk cycle
-						if(grid1per <= 0)
-						{
-							/// Go on to the next grid
-							next_grid();
-							/// Shift the positions over
-							pos1 = pos2;
-							/// Get the new grid2's position
-							if(grid2 != NULL)
-							{
-								i2 = grid2->get_info(echo_ns::angle);
-								if(i2 != NULL)
-								{
-									pos2 = i2->pos;
-								}
-							}
-						}
+						dist_traveled -= 4;	
+						dist_traveled_cyclic -= 360;
 					}
-					/// Draw the character at a weighted average of the positions
-					draw(pos1->x * grid1per + pos2->x * (1 - grid1per),
-							pos1->y * grid1per + pos2->y * (1 - grid1per),
-							pos1->z * grid1per + pos2->z * (1 - grid1per));
+					/// Cache the distance between grids
+					dist = pos1->dist(pos2);
+					/** Make the walking slightly more realistic by having the character accelerate/decelerate 
+					 * This particular walk cycle is similar to one here:
+					 * http://www.idleworm.com/how/anm/02w/walk1.shtml
+					 */
+					if(dist_traveled > 0.5f && dist_traveled <= 1)
+						grid1per -= (1 + 1 * echo_cos(90 * dist_traveled - 22.5f)) * step_speed / dist;
+					else if(dist_traveled > 2.5f && dist_traveled <= 3)
+						grid1per -= (1 + 1 * echo_cos(90 * dist_traveled + 67.5f)) * step_speed / dist;
+					else
+						grid1per -= step_speed / dist;
+					
+					/// If the character reached the end of its walk cycle, go on to the next grid
+					if(grid1per <= 0)
+						next_grid();
 				}
-				/// If grid2's position could not be acquired...
-				else
-					/// Just draw the character at grid1
-					DRAW_VEC(i1->pos);
 			}
 		}
 		/// If there isn't a second grid...
 		else
 		{
 			/// Attempt to acquired one (perhaps grid1 shifted an esc over?)
-			grid2 = grid1->get_next(echo_ns::angle, grid1);
-			/// If there still isn't a second grid...
-			if(grid2 == NULL)
-			{
-				/// Just draw the character at grid1
-				grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-				if(i1 != NULL)
-					DRAW_VEC(i1->pos);
-			}
-			/// Else, we need to change speed and step again (hopefully no recursion stuff...?)
-			else
+			grid2 = grid1->tag_get_next(world->angle, grid1);
+			/// If there is one now, we need to change speed and step again (hopefully no recursion stuff...?)
+			if(grid2 != NULL)
 			{
 				change_speed();
-				step();
+				advance(dt);
 			}
 		}
 	}
 }
+/** Draws the character between the poses of the last two updates
+ * @param alpha How far from the previous pose to the current one, in [0, 1]
+ */
+void echo_char::render(float alpha)
+{
+	/// Set the color to white
+	gfx_color3f(1, 1, 1);
+	echo_char_pose pose;
+	save_pose(&pose);
+	vector3f pos;
+	if(pose_position(&pose, &pos) == WIN)
+	{
+		vector3f prev_pos;
+		/** Only interpolate within the same kind of motion; across a reset, a landing
+		 * or a jump the positions aren't in the same frame of reference
+		 */
+		const int grid_mode = pose.mode != FALL && pose.mode != FALL_FROM_SKY && pose.mode != LAUNCH;
+		const int prev_grid_mode = prev_pose.mode != FALL && prev_pose.mode != FALL_FROM_SKY
+						&& prev_pose.mode != LAUNCH;
+		if((pose.mode == prev_pose.mode || (grid_mode && prev_grid_mode))
+			&& pose_position(&prev_pose, &prev_pos) == WIN)
+		{
+			pos = prev_pos + (pos - prev_pos) * alpha;
+			lerp_joints(&prev_pose.joints, &pose.joints, alpha, &pose.joints);
+		}
+		draw(pos.x, pos.y, pos.z, &pose.joints);
+	}
+}
+/** Copies the current state into a pose
+ * @param pose Where to store it
+ */
+void echo_char::save_pose(echo_char_pose* pose)
+{
+	pose->mode = mode;
+	pose->grid1 = grid1;
+	pose->grid2 = grid2;
+	pose->grid1per = grid1per;
+	pose->fall_position = fall_position;
+	pose->joints = joints;
+}
+/** Gets where a pose puts the character at the current camera angle
+ * @param pose The pose
+ * @param out Where to store the position
+ * @return WIN if the position could be found, FAIL otherwise (out is left untouched)
+ */
+STATUS echo_char::pose_position(const echo_char_pose* pose, vector3f* out)
+{
+	/// fall_position is absolute when falling from the sky...
+	if(pose->mode == FALL_FROM_SKY)
+	{
+		*out = pose->fall_position;
+		return(WIN);
+	}
+	/// ...and relative to the camera when falling or flying
+	else if(pose->mode == FALL || pose->mode == LAUNCH)
+	{
+		*out = world->get_basis().rotate_xy(pose->fall_position);
+		return(WIN);
+	}
+	/// Grid Mode: a weighted average of the grids' positions, or just grid1's
+	else if(pose->grid1 != NULL)
+	{
+		vector3f* pos1 = grid_pos(pose->grid1);
+		if(pos1 != NULL)
+		{
+			vector3f* pos2 = pose->grid2 != NULL ? grid_pos(pose->grid2) : NULL;
+			if(pos2 != NULL)
+				*out = *pos1 * pose->grid1per + *pos2 * (1 - pose->grid1per);
+			else
+				*out = *pos1;
+			return(WIN);
+		}
+	}
+	return(FAIL);
+}
+/** Gets where a grid is at the current camera angle; from the stage's view, if the grid is in it
+ * @param g The grid
+ * @return The grid's position, or NULL if it has none
+ */
+vector3f* echo_char::grid_pos(grid* g)
+{
+	if(world->current_stage != NULL)
+	{
+		const stage_view* view = world->current_stage->get_view(world->angle);
+		const int index = view->index_of(g);
+		if(index >= 0)
+			return(view->get_pos(index));
+	}
+	grid_info_t* info = g->tag_get_info(world->angle);
+	return(info ? info->pos : NULL);
+}
 /** Get the current direction of the character.
- * @return The current direction of the character, or grid2's position - grid1's
+ * @param out Where to store grid2's position - grid1's
+ * @return WIN if the direction could be found, FAIL otherwise (out is left untouched)
  */
-vector3f* echo_char::get_direction()
+STATUS echo_char::get_direction(vector3f* out)
 {
 	/// If the character has both grids...
 	if(grid1 != NULL && grid2 != NULL)
 	{
 		/// Get grid1's position
-		grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-		if(i1 != NULL)
+		vector3f* pos1 = grid_pos(grid1);
+		if(pos1 != NULL)
 		{
 			/// Get grid2's position
-			grid_info_t* i2 = grid2->get_info(echo_ns::angle);
-			if(i2 != NULL)
-				/// Return their subtraction
-				return(*(i2->pos) - i1->pos);
+			vector3f* pos2 = grid_pos(grid2);
+			if(pos2 != NULL)
+			{
+				/// Store their subtraction
+				*out = *pos2 - *pos1;
+				return(WIN);
+			}
 		}
 	}
 	/// Failed
-	return(NULL);
+	return(FAIL);
 }
 /** Draws the character at (x,y,z)
  * @param x X-coordinate of the character
  * @param y Y-coordinate of the character
  * @param z Z-coordinate of the character
+ * @param pose_joints The joint values to draw with
  */
-void echo_char::draw(float x, float y, float z)
+void echo_char::draw(float x, float y, float z, echo_char_joints* pose_joints)
 {
 	/// Push a matrix so the following operations won't screw up the rotation matrix
 	gfx_push_matrix();
 	{
-		if(mode == RUN || mode == STEP)
-		{
-			grid_mode_joints(y);
-		}
-		else if(mode == LANDING)
-		{
-			landing_mode_joints();
-		}
-		else if(mode == STANDING_UP)
-		{
-			standing_up_joints();
-		}
-		else
-		{
-			falling_mode_joints();
-		}
 		/// Actually translate the character to the position...
 		gfx_translatef(x, y, z);
 		/// But before actually drawing the character, rotate the character so that it faces where it goes
 		if(mode == LAUNCH)
 		{
-			gfx_rotatef(90 - TO_DEG(atan2(fly_direction->z, fly_direction->x))
+			gfx_rotatef(90 - TO_DEG(atan2(fly_direction.z, fly_direction.x))
 				, 0, 1, 0);
 		}
 		else if(grid1 != NULL && grid2 != NULL)
 		{
-			grid_info_t* i1 = grid1->get_info(echo_ns::angle);
-			if(i1 != NULL)
+			vector3f* pos1 = grid_pos(grid1);
+			if(pos1 != NULL)
 			{
-				grid_info_t* i2 = grid2->get_info(echo_ns::angle);
-				if(i2 != NULL)
+				vector3f* pos2 = grid_pos(grid2);
+				if(pos2 != NULL)
 				{
-					gfx_rotatef(90 - TO_DEG(atan2(i2->pos->z - i1->pos->z, i2->pos->x - i1->pos->x))
+					gfx_rotatef(90 - TO_DEG(atan2(pos2->z - pos1->z, pos2->x - pos1->x))
 						, 0, 1, 0);
 				}
 			}
 		}
 #ifndef ECHO_NDS
 		/// Need to draw the character twice for the outline
-		gfx_outline_start();
-		draw_character(&joints);
+		if(gfx_outline_start())
+			draw_character(pose_joints);
 		gfx_outline_mid();
-		draw_character(&joints);
+		draw_character(pose_joints);
 		gfx_outline_end();
 #else
 		/// draw_character already sets the polyIDs, so no need to draw twice
-		draw_character(&joints);
+		draw_character(pose_joints);
 #endif
 	}
 	/// Pop the "tainted" matrix
@@ -757,6 +790,115 @@ float echo_char::get_speed()
 {
 	return(speed);
 }
+/** Folds some bytes into an FNV-1a hash
+ * @param hash The hash so far
+ * @param data The bytes
+ * @param size How many
+ * @return The new hash
+ */
+static unsigned int hash_bytes(unsigned int hash, const void* data, int size)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	int each = 0;
+	while(each < size)
+	{
+		hash = (hash ^ bytes[each]) * 16777619u;
+		each++;
+	}
+	return(hash);
+}
+/** Folds the movement state into a hash (FNV-1a), so two runs can be checked to play the same
+ * @param hash The hash so far
+ * @return The new hash
+ */
+unsigned int echo_char::hash_state(unsigned int hash)
+{
+	const int ints[] = { mode, paused, is_running, num_goals };
+	hash = hash_bytes(hash, ints, sizeof(ints));
+	const float floats[] = { grid1per, speed, dist_traveled, fall_position.x, fall_position.y, fall_position.z };
+	hash = hash_bytes(hash, floats, sizeof(floats));
+	/// The grids by where they are, since their addresses change from run to run
+	grid* grids[] = { grid1, grid2 };
+	int each = 0;
+	while(each < 2)
+	{
+		vector3f* pos = grids[each] != NULL ? grid_pos(grids[each]) : NULL;
+		if(pos != NULL)
+		{
+			const float coords[] = { pos->x, pos->y, pos->z };
+			hash = hash_bytes(hash, coords, sizeof(coords));
+		}
+		each++;
+	}
+	return(hash);
+}
+/// Is the character walking or running across grids (so grid_mode_joints sets its joints)?
+int echo_char::is_walking()
+{
+	return(mode == RUN || mode == STEP);
+}
+/// @return The joint values of the last update
+const echo_char_joints* echo_char::get_joints()
+{
+	return(&joints);
+}
+/** Works out the Grid Mode joints from the trigonometry the stride clip is baked
+ * from (see echo_clip.h), for checking the clip against (see echo_bench_stride)
+ * @param out The joints before the last update; the arms, thighs and knees are set
+ * (a knee that can't reach keeps its bend, like in grid_mode_joints)
+ */
+void echo_char::stride_reference(echo_char_joints* out)
+{
+	out->rshoulder_swing = -20 * echo_sin(dist_traveled_cyclic);
+	out->lshoulder_swing = 20 * echo_sin(dist_traveled_cyclic);
+	out->rarm_bend = -10 * echo_sin(dist_traveled_cyclic) - 20;
+	out->larm_bend = 10 * echo_sin(dist_traveled_cyclic) - 20;
+	out->rthigh_lift = 35 * echo_sin(dist_traveled_cyclic) - 15;
+	out->lthigh_lift = -35 * echo_sin(dist_traveled_cyclic) - 15;
+	
+	/// The same main grid as grid_mode_joints
+	float main_per = -1;
+	if(grid1 != NULL && grid1per >= 0.5f)
+		main_per = grid1per;
+	else if(grid2 != NULL && grid1per <= 0.5f)
+		main_per = 1 - grid1per;
+	if(main_per >= 0)
+	{
+		const float vshift = 0.05f * echo_cos(360 * main_per) - 0.05f;
+		float right_dist_foot = 0;
+		float left_dist_foot = 0;
+		vector3f foot_vec;
+		if(get_direction(&foot_vec) == WIN)
+		{
+			const float dir_angle = foot_vec.scalar_angle_with_up();
+			right_dist_foot = (vshift + 0.825f) * echo_sin(abs(out->rthigh_lift)) / echo_sin(dir_angle);
+			left_dist_foot = (vshift + 0.825f) * echo_sin(abs(out->lthigh_lift)) / echo_sin(dir_angle);
+		}
+		else
+		{
+			right_dist_foot = (vshift + 1.175f) / echo_cos(out->rthigh_lift);
+			left_dist_foot = (vshift + 1.175f) / echo_cos(out->lthigh_lift);
+		}
+		const float rtemp = fmod(IK_angle(0.5f, 0.65f, right_dist_foot), 90);
+		if(rtemp != 0 && rtemp == rtemp)
+			out->rleg_bend = rtemp;
+		const float ltemp = fmod(IK_angle(0.5f, 0.65f, left_dist_foot), 90);
+		if(ltemp != 0 && ltemp == ltemp)
+			out->lleg_bend = ltemp;
+	}
+}
+/// Calculates the joint values for the current mode
+void echo_char::mode_joints()
+{
+	if(mode == RUN || mode == STEP)
+		grid_mode_joints();
+	else if(mode == LANDING)
+		landing_mode_joints();
+	else if(mode == STANDING_UP)
+		standing_up_joints();
+	else
+		falling_mode_joints();
+}
 /// Initializes the joints for falling mode
 void echo_char::initialize_falling_mode()
 {
@@ -774,21 +916,19 @@ void echo_char::initialize_falling_mode()
 /// Calculate joint values for a character in the air (Falling Mode)
 void echo_char::falling_mode_joints()
 {
-	static float rotation = 0;
-	
-	joints.body_turn = 30 * echo_sin(rotation);
-	joints.lshoulder_swing = rotation;
-	joints.rshoulder_swing = -rotation;
-	joints.rarm_bend = 45 * echo_sin(rotation / 2);
+	joints.body_turn = 30 * echo_sin(fall_spin);
+	joints.lshoulder_swing = fall_spin;
+	joints.rshoulder_swing = -fall_spin;
+	joints.rarm_bend = 45 * echo_sin(fall_spin / 2);
 	joints.larm_bend = joints.rarm_bend;
-	joints.lthigh_lift = 45 * echo_sin(rotation);
+	joints.lthigh_lift = 45 * echo_sin(fall_spin);
 	joints.rthigh_lift = -joints.lthigh_lift;
-	joints.lleg_bend = 30 * echo_sin(rotation) + 30;
-	joints.rleg_bend = 30 * echo_sin(rotation + 90) + 30;
+	joints.lleg_bend = 30 * echo_sin(fall_spin) + 30;
+	joints.rleg_bend = 30 * echo_sin(fall_spin + 90) + 30;
 	
-	rotation += 10;
-	if(rotation > 360)
-		rotation = 0;
+	fall_spin += 10;
+	if(fall_spin > 360)
+		fall_spin = 0;
 }
 /// Joint calculation for a character just landing
 void echo_char::landing_mode_joints()
@@ -799,15 +939,12 @@ void echo_char::standing_up_joints()
 {
 }
 /// Step through joint calculations for walking (used in Grid Mode)
-void echo_char::grid_mode_joints(float y)
-{
-	/// Shift the joints (should probably LERP these suckers)
-	joints.rshoulder_swing = -20 * echo_sin(dist_traveled_cyclic);
-	joints.lshoulder_swing = 20 * echo_sin(dist_traveled_cyclic);
-	joints.rarm_bend = -10 * echo_sin(dist_traveled_cyclic) - 20;
-	joints.larm_bend = 10 * echo_sin(dist_traveled_cyclic) - 20;
-	joints.rthigh_lift = 35 * echo_sin(dist_traveled_cyclic) - 15;
-	joints.lthigh_lift = -35 * echo_sin(dist_traveled_cyclic) - 15;
+void echo_char::grid_mode_joints()
+{
+	/// Shift the joints to where the stride is in its cycle
+	float stride[CLIP_NUM_CHANNELS];
+	clip_sample(&stride_clip, dist_traveled_cyclic, stride);
+	clip_apply(&stride_clip, stride, &joints);
 	
 	/// main_grid is the grid the character is on right now (if it's just two normal grids) 
 	grid* main_grid = NULL;
@@ -828,42 +965,30 @@ void echo_char::grid_mode_joints(float y)
 	{
 		/// ...then there is a vertical shift, which is a cos function
 		float vshift = 0.05f * echo_cos(360 * main_per) - 0.05f;
-		/// Shift y up
-		y += vshift;
 		/// rdf is the distance from hip to right leg
 		float right_dist_foot = 0;
 		/// ldf is the distance from hip to left leg
 		float left_dist_foot = 0;
 		/// Need to know which direction the character is moving in...
-		vector3f* foot_vec = get_direction();
-		if(foot_vec != NULL)
+		vector3f foot_vec;
+		/// ...for how much longer the slope is than the ground under it
+		float stretch = 0;
+		if(get_direction(&foot_vec) == WIN && clip_slope(&foot_vec, &stretch) == WIN)
 		{
-			/// Get the angle the direction vector has with the up vector <0, 1, 0>
-			const float dir_angle = foot_vec->scalar_angle_with_up();
 			/// Get the approximate distance the right leg has with the ground (0.825f is arbitrary)
-			right_dist_foot = (vshift + 0.825f) * echo_sin(abs(joints.rthigh_lift)) 
-										/ echo_sin(dir_angle);
+			right_dist_foot = (vshift + 0.825f) * stride[CLIP_RREACH] * stretch;
 			/// Do the same things with the right leg
-			left_dist_foot = (vshift + 0.825f) * echo_sin(abs(joints.lthigh_lift)) 
-										/ echo_sin(dir_angle);
+			left_dist_foot = (vshift + 0.825f) * stride[CLIP_LREACH] * stretch;
 		}
 		/// If the character can't figure out the direction it's going, just use assume that the ground is flat
 		else
 		{
-			right_dist_foot = (vshift + 1.175f) / echo_cos(joints.rthigh_lift);
-			left_dist_foot = (vshift + 1.175f) / echo_cos(joints.lthigh_lift);
+			right_dist_foot = (vshift + 1.175f) * stride[CLIP_RREACH_FLAT];
+			left_dist_foot = (vshift + 1.175f) * stride[CLIP_LREACH_FLAT];
 		}
 		
-		/// Get the results, mod it under 90
-		const float rtemp = fmod(IK_angle(0.5f, 0.65f, right_dist_foot), 90);
-		/// If the result is not 0 and not NaN, save it
-		if(rtemp != 0 && rtemp == rtemp)
-			joints.rleg_bend = rtemp;
-		
-		/// Do the same thing with left leg
-		const float ltemp = fmod(IK_angle(0.5f, 0.65f, left_dist_foot), 90);
-		if(ltemp != 0 && ltemp == ltemp)
-			joints.lleg_bend = ltemp;
-		delete foot_vec;
+		/// Bend the knees to reach; if a leg can't, it keeps its bend
+		clip_knee(right_dist_foot, &joints.rleg_bend);
+		clip_knee(left_dist_foot, &joints.lleg_bend);
 	}
 }
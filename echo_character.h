@@ -17,6 +17,8 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <vector>
+
 #include "echo_math.h"
 #include "grid.h"
 #include "echo_stage.h"
@@ -32,6 +34,27 @@
 
 #ifndef __ECHO_CHARACTER__
 #define __ECHO_CHARACTER__
+class echo_world;
+
+/** @brief Where an echo_char was after an update; render draws between the last two,
+ * so the character moves smoothly at any frame rate
+ */
+struct echo_char_pose
+{
+	/// The mode the character was in
+	enum CHARACTER_SPEED mode;
+	/// echo_char#grid1 (Grid Mode)
+	grid* grid1;
+	/// echo_char#grid2 (Grid Mode)
+	grid* grid2;
+	/// echo_char#grid1per (Grid Mode)
+	float grid1per;
+	/// echo_char#fall_position (Falling Mode)
+	vector3f fall_position;
+	/// The joint values
+	echo_char_joints joints;
+};
+
 /** @brief echo_char represent an active mannequin (i.e., not a goal, or an "echo")\n
  * Usually the main character, echo_chars can also be antagonist characters
  * that sap a bit of the character's health if they collide.
@@ -51,6 +74,8 @@
 class echo_char
 {
 	protected:
+		/// The world the character is in; where it gets the stage and the camera angle from
+		echo_world* world;
 		/// Where the character should be spawned
 		grid* start;
 		/// The first grid, the one this character is "departing" from
@@ -98,12 +123,12 @@ class echo_char
 		 *      The character needs to land on the target, so he has to\n
 		 *      be attached to the world's rotation.\n
 		 */
-		vector3f* fall_position;
+		vector3f fall_position;
 		
 		/** Save the direction of the character before changing grids, so
 		 * that if the new grid1 is a launcher it can access the last direction.
 		 */
-		vector3f* fly_direction;
+		vector3f fly_direction;
 		
 		/// Lateral component of the character's flight (after launched by a launcher)
 		float x_speed;
@@ -112,12 +137,20 @@ class echo_char
 		
 		/// The y of the target grid (used if falling from the sky)
 		float target_y;
+		
+		/// The pose before the last update; render interpolates from it to the current one
+		echo_char_pose prev_pose;
+		/// Where the arms and legs are in their spin while falling (degrees)
+		float fall_spin;
+		/// The grids arrived at since the last merge_goals, in order; they might be goals
+		std::vector<grid*> goals_hit;
 	public:
 		
 		/** Initialize, and prepare to fall to that grid.
+		 * @param my_world The world the character is in
 		 * @param g1 The initial grid on which to spawn
 		 */
-		echo_char(grid* g1);
+		echo_char(echo_world* my_world, grid* g1);
 		/// Destructor
 		virtual ~echo_char();
 		/** Reinitializes the grid; spawns on g1
@@ -132,8 +165,14 @@ class echo_char
 		/// Respawns; same as init(start); 
 		void reset();
 		
-		/// Take one step in animation and movement; call each frame
-		void step();
+		/** Advances the movement and animation; echo_world::update calls it at a fixed rate
+		 * @param dt Time to advance, in milliseconds (WAIT is the tick the speeds were tuned for)
+		 */
+		void update(float dt);
+		/** Draws the character between the poses of the last two updates
+		 * @param alpha How far from the previous pose to the current one, in [0, 1]
+		 */
+		void render(float alpha);
 		/// Forces the character to go the next grid (and trigger the goal there, if any)
 		void next_grid();
 		/// Changes the mode and speed of the character according to the grids it's at.
@@ -148,9 +187,10 @@ class echo_char
 		void toggle_run();
 		
 		/** Get the current direction of the character.
-		 * @return The current direction of the character, or grid2's position - grid1's
+		 * @param out Where to store grid2's position - grid1's
+		 * @return WIN if the direction could be found, FAIL otherwise (out is left untouched)
 		 */
-		vector3f* get_direction();
+		STATUS get_direction(vector3f* out);
 		
 		/// Pause if running, or unpause if paused
 		void toggle_pause();
@@ -166,19 +206,63 @@ class echo_char
 		 * @return "speed" (see speed attribute)
 		 */
 		float get_speed();
+		/** Folds the movement state into a hash (FNV-1a), so two runs can be checked to play the same
+		 * @param hash The hash so far
+		 * @return The new hash
+		 */
+		unsigned int hash_state(unsigned int hash);
+		/** Is the character falling through a hole or flying from a launcher? Then its update
+		 * looks for grids to land on with stage::get_grid_intersection, which isn't safe to share between threads
+		 * @return If the character is falling or flying
+		 */
+		int is_falling();
+		/// Is the character walking or running across grids (so grid_mode_joints sets its joints)?
+		int is_walking();
+		/// @return The joint values of the last update
+		const echo_char_joints* get_joints();
+		/** Works out the Grid Mode joints from the trigonometry the stride clip is baked
+		 * from (see echo_clip.h), for checking the clip against (see echo_bench_stride)
+		 * @param out The joints before the last update; the arms, thighs and knees are set
+		 * (a knee that can't reach keeps its bend, like in grid_mode_joints)
+		 */
+		void stride_reference(echo_char_joints* out);
+		/** For each grid arrived at since the last call that is (still) a goal: toggles the goal,
+		 * sets it as the new spawn spot, and adds to the goal count.  echo_world::update calls it for
+		 * each character in turn after all of them have moved, so they all move through the same stage
+		 */
+		void merge_goals();
 	
 	protected:
-		/** Checks if the grid given is a goal, and if it is, the character
-		 * will toggle the goal, set it as its new spawn spot, and add to the goal count
+		/** Notes the grid as arrived at; if it's a goal, it's reached at merge_goals
 		 * @param g Grid to check
 		 */
 		void check_goal(grid* g);
+		/** Gets where a grid is at the current camera angle; from the stage's view, if the grid is in it
+		 * @param g The grid
+		 * @return The grid's position, or NULL if it has none
+		 */
+		vector3f* grid_pos(grid* g);
+		/** Moves the character without saving the pose (update does that)
+		 * @param dt Time to advance, in milliseconds
+		 */
+		void advance(float dt);
+		/** Copies the current state into a pose
+		 * @param pose Where to store it
+		 */
+		void save_pose(echo_char_pose* pose);
+		/** Gets where a pose puts the character at the current camera angle
+		 * @param pose The pose
+		 * @param out Where to store the position
+		 * @return WIN if the position could be found, FAIL otherwise (out is left untouched)
+		 */
+		STATUS pose_position(const echo_char_pose* pose, vector3f* out);
 		/** Draws the character at (x,y,z)
 		 * @param x X-coordinate of the character
 		 * @param y Y-coordinate of the character
 		 * @param z Z-coordinate of the character
+		 * @param pose_joints The joint values to draw with
 		 */
-		void draw(float x, float y, float z);
+		void draw(float x, float y, float z, echo_char_joints* pose_joints);
 		
 		/** Start falling from the given position, or where grid1 is.
 		 * @param pos An arbitrary position to fall from.  If this is NULL, then grid1's position will be used
@@ -216,7 +300,7 @@ class echo_char
 		 * v_oy / 7 = v_ox
 		 * 
 		 * @param pos An arbitrary position to launch from.  If this is NULL, then grid1's position will be used
-		 * @param direction Direction to launch towards laterally (on the xz-plane).  If this is NULL, then get_direction will be used.  WILL BE DELETED!!!
+		 * @param direction Direction to launch towards laterally (on the xz-plane).  If this is NULL, then fly_direction will be used.
 		 */
 		void initialize_launching(vector3f* pos, vector3f* direction);
 		/** Initialize the landing sequence; doesn't actually call
@@ -231,7 +315,9 @@ class echo_char
 		/// Joint calculation for a character standing up right after a landing
 		void standing_up_joints();
 		/// Step through joint calculations for walking (used in Grid Mode)
-		void grid_mode_joints(float y);
+		void grid_mode_joints();
+		/// Calculates the joint values for the current mode
+		void mode_joints();
 		/// Initializes the joints for falling mode
 		void initialize_falling_mode();
 };
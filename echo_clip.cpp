@@ -0,0 +1,193 @@
+// echo_clip.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+#include "echo_math.h"
+#include "echo_char_joints.h"
+#include "echo_clip.h"
+
+#include <cstddef>
+#include <cmath>
+
+/// Lengths of the thigh and the shin, for the knee's IK
+#define CLIP_THIGH			0.5f
+#define CLIP_SHIN			0.65f
+/// Steps in the slope table: whole degrees of the angle with up, 0 to 180
+#define CLIP_SLOPES			180
+/// What clip_slope gives for straight up or down, where no foot can reach
+#define CLIP_SLOPE_VERTICAL	1000.0f
+/** Intervals in the knee table (over the squared distance from hip to foot); the first and
+ * last are worked out, since the acos is too steep there to lerp
+ */
+#define CLIP_KNEES			1024
+
+echo_clip stride_clip;
+/// 1 / sin of the angle with up, over whole degrees of that angle
+static float slope_table[CLIP_SLOPES + 1];
+/// The cosine of each whole degree, to find the degree a cosine is in without the acos
+static double slope_cos[CLIP_SLOPES + 1];
+/// IK_angle of the thigh and shin, over the squared distance from hip to foot
+static float knee_table[CLIP_KNEES + 1];
+/// The squared distances the knee table covers
+static const float knee_min = (CLIP_SHIN - CLIP_THIGH) * (CLIP_SHIN - CLIP_THIGH);
+static const float knee_max = (CLIP_SHIN + CLIP_THIGH) * (CLIP_SHIN + CLIP_THIGH);
+
+/** Bakes the stride: the arms and thighs swing with the sine of the cycle
+ * (the walk cycle of http://www.idleworm.com/how/anm/02w/walk1.shtml)
+ * @param clip Where to bake it
+ */
+static void bake_stride(echo_clip* clip)
+{
+	clip->joint[CLIP_RSHOULDER_SWING] = offsetof(echo_char_joints, rshoulder_swing) / sizeof(float);
+	clip->joint[CLIP_LSHOULDER_SWING] = offsetof(echo_char_joints, lshoulder_swing) / sizeof(float);
+	clip->joint[CLIP_RARM_BEND] = offsetof(echo_char_joints, rarm_bend) / sizeof(float);
+	clip->joint[CLIP_LARM_BEND] = offsetof(echo_char_joints, larm_bend) / sizeof(float);
+	clip->joint[CLIP_RTHIGH_LIFT] = offsetof(echo_char_joints, rthigh_lift) / sizeof(float);
+	clip->joint[CLIP_LTHIGH_LIFT] = offsetof(echo_char_joints, lthigh_lift) / sizeof(float);
+	int deg = 0;
+	while(deg <= CLIP_SAMPLES)
+	{
+		const float swing = echo_sin(deg);
+		const float rlift = 35 * swing - 15;
+		const float llift = -35 * swing - 15;
+		clip->channel[CLIP_RSHOULDER_SWING][deg] = -20 * swing;
+		clip->channel[CLIP_LSHOULDER_SWING][deg] = 20 * swing;
+		clip->channel[CLIP_RARM_BEND][deg] = -10 * swing - 20;
+		clip->channel[CLIP_LARM_BEND][deg] = 10 * swing - 20;
+		clip->channel[CLIP_RTHIGH_LIFT][deg] = rlift;
+		clip->channel[CLIP_LTHIGH_LIFT][deg] = llift;
+		clip->channel[CLIP_RREACH][deg] = echo_sin(ABS(rlift));
+		clip->channel[CLIP_LREACH][deg] = echo_sin(ABS(llift));
+		clip->channel[CLIP_RREACH_FLAT][deg] = 1 / echo_cos(rlift);
+		clip->channel[CLIP_LREACH_FLAT][deg] = 1 / echo_cos(llift);
+		deg++;
+	}
+}
+/// Bakes the clips and the slope and knee tables; call once at the start, after init_math
+void init_clips()
+{
+	bake_stride(&stride_clip);
+	int each = 0;
+	while(each <= CLIP_SLOPES)
+	{
+		slope_table[each] = each > 0 && each < CLIP_SLOPES ? 1 / echo_sin(each) : CLIP_SLOPE_VERTICAL;
+		slope_cos[each] = cos(each / 180.0 * PI);
+		each++;
+	}
+	each = 0;
+	while(each <= CLIP_KNEES)
+	{
+		const float dist_sq = knee_min + (knee_max - knee_min) * each / CLIP_KNEES;
+		knee_table[each] = IK_angle(CLIP_THIGH, CLIP_SHIN, sqrt(dist_sq));
+		each++;
+	}
+}
+/** Samples every channel of a clip, at the whole degree of the cycle (echo_sin steps
+ * by whole degrees too, so this is the trigonometry the clip was baked from)
+ * @param clip The clip
+ * @param cycle Where in the cycle (degrees, in [0, 360])
+ * @param out Where to store the CLIP_NUM_CHANNELS values
+ */
+void clip_sample(const echo_clip* clip, float cycle, float* out)
+{
+	int index = (int)cycle;
+	if(index < 0)
+		index = 0;
+	else if(index > CLIP_SAMPLES)
+		index = CLIP_SAMPLES;
+	int each = 0;
+	while(each < CLIP_NUM_CHANNELS)
+	{
+		out[each] = clip->channel[each][index];
+		each++;
+	}
+}
+/** Copies the joint channels of a sample into the joints
+ * @param clip The clip sampled
+ * @param sample From clip_sample
+ * @param joints Where to store them
+ */
+void clip_apply(const echo_clip* clip, const float* sample, echo_char_joints* joints)
+{
+	int each = 0;
+	while(each < CLIP_NUM_JOINTS)
+	{
+		joints->value[clip->joint[each]] = sample[each];
+		each++;
+	}
+}
+/** Gets how much longer a slope is than the ground it covers, from a table over the
+ * whole degrees of the angle with up (the degree echo_sin would round it to)
+ * @param dir The direction along the slope (not necessarily normalized)
+ * @param stretch Where to store 1 / sin of the angle dir has with up
+ * @return WIN, or FAIL if dir is zero (stretch is left untouched)
+ */
+STATUS clip_slope(const vector3f* dir, float* stretch)
+{
+	const float length = dir->length();
+	if(length == 0)
+		return(FAIL);
+	/// The cosine of the angle with up, worked out like vector3f#scalar_angle_with_up so it lands in the same degree
+	const float distance = dir->dist_with_up();
+	const float ratio = (length * length + 1 - distance * distance) / (2 * length);
+	/// The whole degree echo_sin would take that angle as: the last one whose cosine is still at least the ratio
+	int low = 0, high = CLIP_SLOPES;
+	while(low < high)
+	{
+		const int mid = (low + high + 1) / 2;
+		if(ratio <= slope_cos[mid])
+			low = mid;
+		else
+			high = mid - 1;
+	}
+	*stretch = slope_table[low];
+	return(WIN);
+}
+/** Gets the knee bend that reaches a foot that far from the hip, from a table
+ * (IK_angle of the thigh and shin, folded under 90 like the mannequin expects)
+ * @param dist Distance from hip to foot
+ * @param bend Where to store the bend (degrees)
+ * @return WIN, or FAIL if the leg can't reach (bend is left untouched)
+ */
+STATUS clip_knee(float dist, float* bend)
+{
+	const float pos = (dist * dist - knee_min) / (knee_max - knee_min) * CLIP_KNEES;
+	float angle = 0;
+	/// The acos heads off to infinity at both ends too fast to lerp (written so NaN doesn't lerp either)
+	if(pos >= 1 && pos < CLIP_KNEES - 1)
+	{
+		const int index = (int)pos;
+		/// The bend is folded under 90, so the interval 90 is in doesn't lerp either
+		if(knee_table[index] >= 90 && knee_table[index + 1] <= 90)
+			angle = IK_angle(CLIP_THIGH, CLIP_SHIN, dist);
+		else
+			angle = knee_table[index] + (knee_table[index + 1] - knee_table[index]) * (pos - index);
+	}
+	/// Out of reach too, so it fails just like IK_angle
+	else
+		angle = IK_angle(CLIP_THIGH, CLIP_SHIN, dist);
+	angle = fmod(angle, 90);
+	/// Like a leg that can't reach (IK_angle gives 0, or NaN too close to the hip)
+	if(angle == 0 || angle != angle)
+		return(FAIL);
+	*bend = angle;
+	return(WIN);
+}
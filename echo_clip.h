@@ -0,0 +1,87 @@
+// echo_clip.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+#include "echo_math.h"
+#include "echo_char_joints.h"
+
+#ifndef __ECHO_CLIP__
+#define __ECHO_CLIP__
+/// Samples in a cycle of a clip: one per degree of echo_char#dist_traveled_cyclic
+#define CLIP_SAMPLES		360
+
+/// Channels of the stride clip; the first CLIP_NUM_JOINTS are joint values
+enum
+{
+	CLIP_RSHOULDER_SWING, CLIP_LSHOULDER_SWING, CLIP_RARM_BEND, CLIP_LARM_BEND
+	, CLIP_RTHIGH_LIFT, CLIP_LTHIGH_LIFT, CLIP_NUM_JOINTS
+	/// How far the foot reaches down for each unit from hip to ground, along the slope (sin of the thigh lift)
+	, CLIP_RREACH = CLIP_NUM_JOINTS, CLIP_LREACH
+	/// ...and straight down, if the slope isn't known (1 / cos of the thigh lift)
+	, CLIP_RREACH_FLAT, CLIP_LREACH_FLAT, CLIP_NUM_CHANNELS
+};
+
+/** @brief An animation cycle baked into tables (see init_clips).\n
+ * The samples are stored one channel after the other, so sampling a clip runs
+ * the same copy down every channel.
+ */
+typedef struct echo_clip
+{
+	/// The channels over the cycle; sample CLIP_SAMPLES is the end of the cycle, which echo_char#dist_traveled_cyclic can reach
+	float channel[CLIP_NUM_CHANNELS][CLIP_SAMPLES + 1];
+	/// Which echo_char_joints#value each of the first CLIP_NUM_JOINTS channels goes to
+	int joint[CLIP_NUM_JOINTS];
+} echo_clip;
+
+/** The stride of walking and running (see echo_char#grid_mode_joints); the two only
+ * differ in how fast they go through it
+ */
+extern echo_clip stride_clip;
+
+/// Bakes the clips and the slope and knee tables; call once at the start, after init_math
+void init_clips();
+/** Samples every channel of a clip, at the whole degree of the cycle (like echo_sin)
+ * @param clip The clip
+ * @param cycle Where in the cycle (degrees, in [0, 360])
+ * @param out Where to store the CLIP_NUM_CHANNELS values
+ */
+void clip_sample(const echo_clip* clip, float cycle, float* out);
+/** Copies the joint channels of a sample into the joints
+ * @param clip The clip sampled
+ * @param sample From clip_sample
+ * @param joints Where to store them
+ */
+void clip_apply(const echo_clip* clip, const float* sample, echo_char_joints* joints);
+/** Gets how much longer a slope is than the ground it covers, from a table over the
+ * whole degrees of the angle with up (the degree echo_sin would round it to)
+ * @param dir The direction along the slope (not necessarily normalized)
+ * @param stretch Where to store 1 / sin of the angle dir has with up
+ * @return WIN, or FAIL if dir is zero (stretch is left untouched)
+ */
+STATUS clip_slope(const vector3f* dir, float* stretch);
+/** Gets the knee bend that reaches a foot that far from the hip, from a table
+ * (IK_angle of the thigh and shin, folded under 90 like the mannequin expects)
+ * @param dist Distance from hip to foot
+ * @param bend Where to store the bend (degrees)
+ * @return WIN, or FAIL if the leg can't reach (bend is left untouched)
+ */
+STATUS clip_knee(float dist, float* bend);
+#endif
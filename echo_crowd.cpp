@@ -0,0 +1,373 @@
+// echo_crowd.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include "echo_platform.h"
+
+#ifndef ECHO_NDS
+
+#include "echo_debug.h"
+#include "echo_math.h"
+#include "echo_glext.h"
+#include "echo_mesh.h"
+#include "echo_char_joints.h"
+#include "echo_crowd.h"
+
+#ifdef ECHO_OSX	//OS X
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// The meshes a mannequin is made of
+static echo_mesh* const kinds[] = 
+{
+	&body_mesh, &head_mesh, &lower_body_mesh, &limb_mesh, &left_hand_mesh
+	, &right_hand_mesh, &foot_mesh, &sphere_point1_mesh, &sphere_pointzero75_mesh
+};
+#define NUM_KINDS		(int)(sizeof(kinds) / sizeof(kinds[0]))
+enum { BODY, HEAD, LOWER_BODY, LIMB, LEFT_HAND, RIGHT_HAND, FOOT, SPHERE_POINT1, SPHERE_POINTZERO75 };
+
+/// Index of a joint value in echo_char_joints::value
+#define JOINT(name)		(int)(offsetof(echo_char_joints, name) / sizeof(float))
+/// No joint
+#define NONE			-1
+
+/** A part of the mannequin: its matrix is the parent's, translated by pre,
+ * rotated about x, y then z by the joints (plus the fixed angles), then
+ * translated by post; the same calls draw_character makes
+ */
+typedef struct
+{
+	/// Index of the parent part, or -1 for the mannequin itself
+	int parent;
+	/// Which of kinds is drawn
+	int kind;
+	float pre[3];
+	/// Joints turning the part about x, y and z (or NONE)
+	int joint[3];
+	/// Fixed angles added to the joints
+	float fixed[3];
+	float post[3];
+} char_part;
+
+/// The parts, in draw_character's order (parents come before their children)
+static const char_part parts[CHAR_NUM_PARTS] = 
+{
+	/// Body
+	{-1, BODY, {0, 1.875f, 0}, {JOINT(body_x), JOINT(body_y), JOINT(body_z)}, {0, 0, 0}, {0, 0, 0}},
+	/// Neck, head
+	{0, SPHERE_POINTZERO75, {0, 0.3f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{1, HEAD, {0, 0, 0}, {JOINT(head_x), JOINT(head_y), JOINT(head_z)}, {0, 0, 0}, {0, 0.3f, 0}},
+	/// Left shoulder, upper arm, elbow, arm, wrist, hand
+	{0, SPHERE_POINTZERO75, {0.2f, 0.2f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{3, LIMB, {0, 0, 0}, {JOINT(lshoulder_x), JOINT(lshoulder_y), JOINT(lshoulder_z)}, {0, 0, 12}, {0, -0.05f, 0}},
+	{4, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{5, LIMB, {0, 0, 0}, {JOINT(larm_x), JOINT(larm_y), NONE}, {0, 0, -12}, {0, -0.05f, 0}},
+	{6, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{7, LEFT_HAND, {0, 0, 0}, {JOINT(lhand_x), NONE, NONE}, {0, 0, 0}, {-0.03f, -0.06f, 0}},
+	/// Right shoulder, upper arm, elbow, arm, wrist, hand
+	{0, SPHERE_POINTZERO75, {-0.2f, 0.2f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{9, LIMB, {0, 0, 0}, {JOINT(rshoulder_x), JOINT(rshoulder_y), JOINT(rshoulder_z)}, {0, 0, -12}, {0, -0.05f, 0}},
+	{10, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{11, LIMB, {0, 0, 0}, {JOINT(rarm_x), JOINT(rarm_y), NONE}, {0, 0, 12}, {0, -0.05f, 0}},
+	{12, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{13, RIGHT_HAND, {0, 0, 0}, {JOINT(rhand_x), NONE, NONE}, {0, 0, 0}, {0.03f, -0.06f, 0}},
+	/// Hip, lower body
+	{0, SPHERE_POINT1, {0, -0.32f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{15, LOWER_BODY, {0, 0, 0}, {JOINT(waist_x), JOINT(waist_y), NONE}, {0, 0, 0}, {0, -0.32f, 0}},
+	/// Left buttock, thigh, knee, leg, ankle, foot
+	{16, SPHERE_POINTZERO75, {0.1f, -0.06f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{17, LIMB, {0, 0, 0}, {JOINT(lthigh_x), JOINT(lthigh_y), JOINT(lthigh_z)}, {0, 0, 0}, {0, -0.05f, 0}},
+	{18, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{19, LIMB, {0, 0, 0}, {JOINT(lleg_x), NONE, NONE}, {0, 0, 0}, {0, -0.05f, 0}},
+	{20, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{21, FOOT, {0, 0, 0}, {JOINT(lfoot_x), NONE, NONE}, {0, 0, 0}, {0.01f, -0.15f, 0.025f}},
+	/// Right buttock, thigh, knee, leg, ankle, foot
+	{16, SPHERE_POINTZERO75, {-0.1f, -0.06f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{23, LIMB, {0, 0, 0}, {JOINT(rthigh_x), JOINT(rthigh_y), JOINT(rthigh_z)}, {0, 0, 0}, {0, -0.05f, 0}},
+	{24, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{25, LIMB, {0, 0, 0}, {JOINT(rleg_x), NONE, NONE}, {0, 0, 0}, {0, -0.05f, 0}},
+	{26, SPHERE_POINTZERO75, {0, -0.45f, 0}, {NONE, NONE, NONE}, {0, 0, 0}, {0, 0, 0}},
+	{27, FOOT, {0, 0, 0}, {JOINT(rfoot_x), NONE, NONE}, {0, 0, 0}, {-0.01f, -0.15f, 0.025f}},
+};
+
+/// Like glTranslatef on the matrix m
+static void translate(float* m, const float* t)
+{
+	if(t[0] == 0 && t[1] == 0 && t[2] == 0)
+		return;
+	int each = 0;
+	while(each < 3)
+	{
+		m[12 + each] += m[each] * t[0] + m[4 + each] * t[1] + m[8 + each] * t[2];
+		each++;
+	}
+}
+/** Like glRotatef about an axis on the matrix m
+ * @param a The column that turns towards b
+ * @param b The other column
+ */
+static void rotate(float* m, int a, int b, float deg)
+{
+	if(deg == 0)
+		return;
+	const float c = cosf(TO_RAD(deg)), s = sinf(TO_RAD(deg));
+	int each = 0;
+	while(each < 3)
+	{
+		const float ma = m[4 * a + each], mb = m[4 * b + each];
+		m[4 * a + each] = ma * c + mb * s;
+		m[4 * b + each] = mb * c - ma * s;
+		each++;
+	}
+}
+
+void char_pose(const echo_char_joints* joints, const float* base, float* out)
+{
+	static const float identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+	int each = 0;
+	while(each < CHAR_NUM_PARTS)
+	{
+		const char_part* part = parts + each;
+		float* m = out + 16 * each;
+		memcpy(m, part->parent < 0 ? (base ? base : identity) : out + 16 * part->parent, 16 * sizeof(float));
+		translate(m, part->pre);
+		float angle[3];
+		int axis = 0;
+		while(axis < 3)
+		{
+			angle[axis] = part->fixed[axis];
+			if(joints && part->joint[axis] != NONE)
+				angle[axis] += joints->value[part->joint[axis]];
+			axis++;
+		}
+		/// About x turns y towards z, about y turns z towards x, about z turns x towards y
+		rotate(m, 1, 2, angle[0]);
+		rotate(m, 2, 0, angle[1]);
+		rotate(m, 0, 1, angle[2]);
+		translate(m, part->post);
+		each++;
+	}
+}
+
+/// The matrices of every instance of each kind
+static std::vector<float> instances[NUM_KINDS];
+static int num_chars = 0;
+/// Is the instanced draw wanted?
+static int instancing = 1;
+/// Has the instanced draw been set up (or found impossible)?
+static int tried = 0;
+/// The instanced draw's shader, its matrix columns, and the buffer of matrices
+static GLuint program = 0;
+static GLint column[4] = {-1, -1, -1, -1};
+static GLuint instance_buffer = 0;
+
+/// The part's matrix comes in as four columns, one set per instance
+static const char* vertex_source =
+	"attribute vec4 part_x;\n"
+	"attribute vec4 part_y;\n"
+	"attribute vec4 part_z;\n"
+	"attribute vec4 part_w;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position = gl_ModelViewProjectionMatrix * (mat4(part_x, part_y, part_z, part_w) * gl_Vertex);\n"
+	"	gl_FrontColor = gl_Color;\n"
+	"}\n";
+
+void crowd_clear()
+{
+	int each = 0;
+	while(each < NUM_KINDS)
+	{
+		instances[each].clear();
+		each++;
+	}
+	num_chars = 0;
+}
+
+void crowd_add(float x, float y, float z, float turn, const echo_char_joints* joints)
+{
+	static float pose[16 * CHAR_NUM_PARTS];
+	float base[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, x, y, z, 1};
+	rotate(base, 2, 0, turn);
+	char_pose(joints, base, pose);
+	int each = 0;
+	while(each < CHAR_NUM_PARTS)
+	{
+		std::vector<float>& list = instances[parts[each].kind];
+		list.insert(list.end(), pose + 16 * each, pose + 16 * (each + 1));
+		each++;
+	}
+	num_chars++;
+}
+
+int crowd_size()
+{
+	return(num_chars);
+}
+
+int crowd_set_instancing(int on)
+{
+	const int prev = instancing;
+	instancing = on;
+	return(prev);
+}
+
+/// Sets up the instanced draw the first time; can it be used now?
+static int can_instance()
+{
+	if(!tried)
+	{
+		tried = 1;
+		echo_glext_init();
+		if(echo_glext_has_instancing())
+			program = echo_glext_program(vertex_source, NULL, "crowd");
+		if(program)
+		{
+			const char* names[4] = {"part_x", "part_y", "part_z", "part_w"};
+			int each = 0;
+			while(each < 4)
+			{
+				column[each] = echo_glGetAttribLocation(program, names[each]);
+				if(column[each] < 0)
+				{
+					echo_glDeleteProgram(program);
+					program = 0;
+					break;
+				}
+				each++;
+			}
+		}
+		if(program)
+			echo_glGenBuffers(1, &instance_buffer);
+		else
+			ECHO_PRINT("no instancing; mannequins are drawn one part at a time\n");
+	}
+	return(program && instancing && mesh_get_path() == MESH_PATH_BUFFER && body_mesh.buffers[0]);
+}
+
+/// Draws every instance of each kind with one call
+static void draw_instanced()
+{
+	int total = 0;
+	int kind = 0;
+	while(kind < NUM_KINDS)
+	{
+		total += instances[kind].size();
+		kind++;
+	}
+	echo_glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+	/// A fresh store every draw, so the GL needn't wait on the last one
+	echo_glBufferData(GL_ARRAY_BUFFER, total * sizeof(float), NULL, GL_STREAM_DRAW);
+	
+	echo_glUseProgram(program);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	int each = 0;
+	while(each < 4)
+	{
+		echo_glEnableVertexAttribArray(column[each]);
+		echo_glVertexAttribDivisor(column[each], 1);
+		each++;
+	}
+	int offset = 0;
+	kind = 0;
+	while(kind < NUM_KINDS)
+	{
+		const int floats = instances[kind].size();
+		if(floats > 0)
+		{
+			echo_glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+			echo_glBufferSubData(GL_ARRAY_BUFFER, offset * sizeof(float), floats * sizeof(float)
+				, &instances[kind][0]);
+			each = 0;
+			while(each < 4)
+			{
+				echo_glVertexAttribPointer(column[each], 4, GL_FLOAT, GL_FALSE, 16 * sizeof(float)
+					, (const char*)NULL + (offset + 4 * each) * sizeof(float));
+				each++;
+			}
+			//the projection is orthographic, so every mannequin gets the same level of detail
+			const echo_mesh* mesh = mesh_lod(kinds[kind]);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, mesh->buffers[0]);
+			echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->buffers[1]);
+			glVertexPointer(3, GL_FLOAT, 0, 0);
+			echo_glDrawElementsInstanced(GL_TRIANGLES, mesh->num_indices, GL_UNSIGNED_SHORT, 0
+				, floats / 16);
+			offset += floats;
+		}
+		kind++;
+	}
+	each = 0;
+	while(each < 4)
+	{
+		echo_glVertexAttribDivisor(column[each], 0);
+		echo_glDisableVertexAttribArray(column[each]);
+		each++;
+	}
+	glDisableClientState(GL_VERTEX_ARRAY);
+	echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+	echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	echo_glUseProgram(0);
+}
+
+void crowd_draw()
+{
+	if(num_chars == 0)
+		return;
+	if(can_instance())
+	{
+		draw_instanced();
+		return;
+	}
+	/// One part at a time, but still without working out the matrices on the GL's stack
+	int kind = 0;
+	while(kind < NUM_KINDS)
+	{
+		const int floats = instances[kind].size();
+		int each = 0;
+		while(each < floats)
+		{
+			glPushMatrix();
+			glMultMatrixf(&instances[kind][each]);
+			mesh_draw(kinds[kind]);
+			glPopMatrix();
+			each += 16;
+		}
+		kind++;
+	}
+}
+
+void crowd_free()
+{
+	if(program)
+		echo_glDeleteProgram(program);
+	if(instance_buffer)
+		echo_glDeleteBuffers(1, &instance_buffer);
+	program = instance_buffer = 0;
+	tried = 0;
+}
+
+#endif
@@ -0,0 +1,70 @@
+// echo_crowd.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_char_joints.h"
+
+#ifndef __ECHO_CROWD__
+#define __ECHO_CROWD__
+
+#ifndef ECHO_NDS
+/// Number of meshes draw_character places for a mannequin
+#define CHAR_NUM_PARTS		29
+
+/** Works out on the CPU where draw_character puts each part of a mannequin,
+ * without the GL matrix stack
+ * @param joints Joint values of the mannequin (NULL for a standing one)
+ * @param base Where the mannequin is (column-major 4x4, like glMultMatrixf), or NULL for the origin
+ * @param out CHAR_NUM_PARTS column-major 4x4 matrices, in draw_character's order
+ */
+void char_pose(const echo_char_joints* joints, const float* base, float* out);
+
+/** @brief Many mannequins drawn at once.
+ * 
+ * crowd_add poses a mannequin (see char_pose) and files each part's matrix
+ * under the part's mesh; crowd_draw then draws every instance of a mesh
+ * with one instanced call, so the number of calls doesn't grow with the
+ * crowd.  Without instancing (or with mesh_set_path away from buffers),
+ * each part is drawn with glMultMatrixf.  All use the current color, so
+ * crowd_draw can be called again for the outline pass.
+ */
+/// Empties the crowd (the memory is kept for the next one)
+void crowd_clear();
+/** Adds a mannequin to the crowd
+ * @param x X-coordinate of the mannequin
+ * @param y Y-coordinate of the mannequin
+ * @param z Z-coordinate of the mannequin
+ * @param turn Rotation about the y axis (degrees), like echo_char::draw's
+ * @param joints Joint values (NULL for a standing one)
+ */
+void crowd_add(float x, float y, float z, float turn, const echo_char_joints* joints);
+/// Number of mannequins added since crowd_clear
+int crowd_size();
+/// Draws the crowd (relative to the current modelview)
+void crowd_draw();
+/** Turns the instanced draw on or off; off draws each part on its own (for comparing them)
+ * @return Was it on?
+ */
+int crowd_set_instancing(int on);
+/// Deletes the shader and buffer the instanced draw made
+void crowd_free();
+#endif
+
+#endif
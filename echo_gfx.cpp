@@ -24,6 +24,7 @@
 #include "echo_error.h"
 #include "echo_gfx.h"
 #include "echo_math.h"
+#include "echo_outline.h"
 
 #include <cstdlib>
 #include <iostream>
@@ -136,6 +137,21 @@ void draw_rect(vector3f* p1, vector3f* p2, vector3f* p3, vector3f* p4)
 	}
 	glEnd();
 }
+/** Draws a WHITE rectangle (actually, a quadrilateral) at the 4 points
+ * @param pts The points, in order (like grid's points)
+ */
+void draw_rect(const vector3f* pts)
+{
+	gfx_color3f(1, 1, 1);
+	glBegin(GL_QUADS);
+	{
+		glVertex3f(pts[0].x, pts[0].y, pts[0].z);
+		glVertex3f(pts[1].x, pts[1].y, pts[1].z);
+		glVertex3f(pts[2].x, pts[2].y, pts[2].z);
+		glVertex3f(pts[3].x, pts[3].y, pts[3].z);
+	}
+	glEnd();
+}
 /// Draws a WHITE rectangle (actually, a quadrilateral) at the specified coordinates
 void draw_rect(float x1, float y1, float z1
 		, float x2, float y2, float z2
@@ -184,7 +200,7 @@ void draw_goal_gfx(vector3f* pos)
 	if(!drawing_outline)
 #endif
 	{
-		gfx_color3f(0.25f, 0.25f, 0.25f);
+		gfx_color3f(GOAL_GRAY, GOAL_GRAY, GOAL_GRAY);
 		gfx_push_matrix();
 			glTranslatef(pos->x, pos->y, pos->z);
 			draw_character(NULL);
@@ -567,10 +583,33 @@ void gfx_color3f(float r, float g, float b)
 		glColor3f(r, g, b);
 }
 
+/// Half the size of the projection; 0 until gfx_set_view
+static float view_half_width = 0, view_half_height = 0;
+
+void gfx_set_view(float half_width, float half_height)
+{
+	view_half_width = half_width;
+	view_half_height = half_height;
+}
+
+int gfx_rect_in_view(float min_x, float min_y, float max_x, float max_y)
+{
+	if(view_half_width <= 0 || view_half_height <= 0)
+		return(1);
+	return(max_x >= -view_half_width && min_x <= view_half_width
+		&& max_y >= -view_half_height && min_y <= view_half_height);
+}
+
 #ifndef ECHO_NDS
 	/// Adapted from http://www.codeproject.com/KB/openGL/Outline_Mode.aspx
-	void gfx_outline_start()
+	int gfx_outline_start()
 	{
+		if(gfx_screen_outline_active())
+		{
+			/// Only the fill is drawn; keep the color like the two-pass path does
+			glPushAttrib(GL_CURRENT_BIT);
+			return(0);
+		}
 		drawing_outline = 1;
 		//Method 1
 		// Push the GL attribute bits so that we don't wreck any settings
@@ -587,9 +626,15 @@ void gfx_color3f(float r, float g, float b)
 		// Set the colour to be white
 		
 		glColor3f( 0.0f, 0.0f, 0.0f );
+		return(1);
 	}
 	void gfx_outline_mid()
 	{
+		if(gfx_screen_outline_active())
+		{
+			glColor3f(1.0f, 1.0f, 1.0f);
+			return;
+		}
 		drawing_outline = 0;
 		//Method 1
 		// Set the polygon mode to be filled triangles 
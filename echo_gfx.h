@@ -34,6 +34,10 @@
  * @param p4 The fourth point
  */
 void draw_rect(vector3f* p1, vector3f* p2, vector3f* p3, vector3f* p4);
+/** Draws a WHITE rectangle (actually, a quadrilateral) at the 4 points
+ * @param pts The points, in order (like grid's points)
+ */
+void draw_rect(const vector3f* pts);
 /// Draws a WHITE rectangle (actually, a quadrilateral) at the specified coordinates
 void draw_rect(float x1, float y1, float z1
 		, float x2, float y2, float z2
@@ -59,6 +63,8 @@ void draw_hole(vector3f* pos);
  * @param pos Where to draw the launcher
  */
 void draw_launcher(vector3f* pos);
+/// Gray of the goals ("echoes")
+#define GOAL_GRAY	0.25f
 /** Draw a goal ("echo") at pos
  * @param pos Where to draw the goal
  */
@@ -119,9 +125,24 @@ void gfx_translatef(float x, float y, float z);
  */
 void gfx_color3f(float r, float g, float b);
 
+/** Sets the rectangle the orthographic projection shows, around the origin
+ * of Screen Position (see resize() in main.cpp); 0 shows everything
+ * @param half_width Half the width of the projection (world units)
+ * @param half_height Half the height of the projection (world units)
+ */
+void gfx_set_view(float half_width, float half_height);
+/** Does a rectangle in Screen Position overlap the projection?  Used to cull
+ * what is off the screen; always true until gfx_set_view is called
+ * @return 1 if any of it can be on the screen
+ */
+int gfx_rect_in_view(float min_x, float min_y, float max_x, float max_y);
+
 #ifndef ECHO_NDS
-	/// Call before 1st render
-	void gfx_outline_start();
+	/** Call before the 1st render
+	 * @return Should the 1st (outline) render be done?  Not if the outline
+	 * comes from the screen-space pass (see gfx_screen_outline_begin)
+	 */
+	int gfx_outline_start();
 	/// Call between the 1st and 2nd renders
 	void gfx_outline_mid();
 	/// Call after the second render
@@ -0,0 +1,338 @@
+// echo_glext.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cstring>
+#include <cstdlib>
+
+#include "echo_platform.h"
+#include "echo_debug.h"
+#include "echo_glext.h"
+
+#ifdef ECHO_PC
+
+#ifdef ECHO_WIN
+	#include <windows.h>
+	#define WINDOW_GET_PROC(name)	((void*)wglGetProcAddress(name))
+#elif ECHO_OSX
+	#include <dlfcn.h>
+	#define WINDOW_GET_PROC(name)	dlsym(RTLD_DEFAULT, name)
+#else
+	#include <GL/glx.h>
+	#define WINDOW_GET_PROC(name)	((void*)glXGetProcAddressARB((const GLubyte*)(name)))
+#endif
+
+/// Set if the context isn't the window system's (see echo_glext_set_loader)
+static echo_get_proc_t loader = NULL;
+#define GET_PROC(name)	(loader ? loader(name) : WINDOW_GET_PROC(name))
+
+echo_gen_buffers_t echo_glGenBuffers = NULL;
+echo_bind_buffer_t echo_glBindBuffer = NULL;
+echo_buffer_data_t echo_glBufferData = NULL;
+echo_buffer_sub_data_t echo_glBufferSubData = NULL;
+echo_delete_buffers_t echo_glDeleteBuffers = NULL;
+echo_gen_framebuffers_t echo_glGenFramebuffers = NULL;
+echo_bind_framebuffer_t echo_glBindFramebuffer = NULL;
+echo_framebuffer_texture_2d_t echo_glFramebufferTexture2D = NULL;
+echo_check_framebuffer_status_t echo_glCheckFramebufferStatus = NULL;
+echo_delete_framebuffers_t echo_glDeleteFramebuffers = NULL;
+echo_create_shader_t echo_glCreateShader = NULL;
+echo_shader_source_t echo_glShaderSource = NULL;
+echo_compile_shader_t echo_glCompileShader = NULL;
+echo_get_shader_iv_t echo_glGetShaderiv = NULL;
+echo_get_shader_info_log_t echo_glGetShaderInfoLog = NULL;
+echo_create_program_t echo_glCreateProgram = NULL;
+echo_attach_shader_t echo_glAttachShader = NULL;
+echo_link_program_t echo_glLinkProgram = NULL;
+echo_get_program_iv_t echo_glGetProgramiv = NULL;
+echo_use_program_t echo_glUseProgram = NULL;
+echo_get_uniform_location_t echo_glGetUniformLocation = NULL;
+echo_uniform_1i_t echo_glUniform1i = NULL;
+echo_uniform_1f_t echo_glUniform1f = NULL;
+echo_uniform_2f_t echo_glUniform2f = NULL;
+echo_delete_shader_t echo_glDeleteShader = NULL;
+echo_delete_program_t echo_glDeleteProgram = NULL;
+echo_active_texture_t echo_glActiveTexture = NULL;
+echo_gen_queries_t echo_glGenQueries = NULL;
+echo_begin_query_t echo_glBeginQuery = NULL;
+echo_end_query_t echo_glEndQuery = NULL;
+echo_get_query_object_ui64v_t echo_glGetQueryObjectui64v = NULL;
+echo_delete_queries_t echo_glDeleteQueries = NULL;
+echo_draw_elements_instanced_t echo_glDrawElementsInstanced = NULL;
+echo_vertex_attrib_divisor_t echo_glVertexAttribDivisor = NULL;
+echo_vertex_attrib_pointer_t echo_glVertexAttribPointer = NULL;
+echo_enable_vertex_attrib_array_t echo_glEnableVertexAttribArray = NULL;
+echo_disable_vertex_attrib_array_t echo_glDisableVertexAttribArray = NULL;
+echo_get_attrib_location_t echo_glGetAttribLocation = NULL;
+echo_map_buffer_t echo_glMapBuffer = NULL;
+echo_unmap_buffer_t echo_glUnmapBuffer = NULL;
+echo_fence_sync_t echo_glFenceSync = NULL;
+echo_client_wait_sync_t echo_glClientWaitSync = NULL;
+echo_delete_sync_t echo_glDeleteSync = NULL;
+
+/// Has echo_glext_init run?
+static int glext_ready = 0;
+/// Did it find the buffer object functions?
+static int has_vbo = 0;
+/// Did it find the framebuffer object functions?
+static int has_fbo = 0;
+/// Did it find the shader functions?
+static int has_glsl = 0;
+/// Did it find the timer query functions?
+static int has_timer = 0;
+/// Did it find the instancing functions?
+static int has_instancing = 0;
+/// Did it find the buffer mapping functions, with pixel buffers?
+static int has_pbo = 0;
+/// Did it find the fence functions?
+static int has_sync = 0;
+
+/** Does the extension string contain the name (as a whole word)?
+ * @param exts The GL_EXTENSIONS string
+ * @param name The extension to look for
+ */
+static int has_ext(const char* exts, const char* name)
+{
+	size_t len = strlen(name);
+	const char* at = exts;
+	while(at && (at = strstr(at, name)) != NULL)
+	{
+		if((at == exts || at[-1] == ' ') && (at[len] == ' ' || at[len] == '\0'))
+			return(1);
+		at += len;
+	}
+	return(0);
+}
+
+/// Looks up the core name, then the ARB one
+static void* get_proc(const char* core, const char* arb)
+{
+	void* ret = GET_PROC(core);
+	if(!ret)
+		ret = GET_PROC(arb);
+	return(ret);
+}
+
+void echo_glext_set_loader(echo_get_proc_t get_proc)
+{
+	loader = get_proc;
+}
+
+void echo_glext_init()
+{
+	if(glext_ready)
+		return;
+	glext_ready = 1;
+	const char* version = (const char*)glGetString(GL_VERSION);
+	const char* exts = (const char*)glGetString(GL_EXTENSIONS);
+	if(!version)
+	{
+		ECHO_PRINT("no GL context; not loading extensions\n");
+		glext_ready = 0;
+		return;
+	}
+	int major = atoi(version);
+	const char* dot = strchr(version, '.');
+	int minor = dot ? atoi(dot + 1) : 0;
+	if(major > 1 || (major == 1 && minor >= 5) || has_ext(exts, "GL_ARB_vertex_buffer_object"))
+	{
+		echo_glGenBuffers = (echo_gen_buffers_t)get_proc("glGenBuffers", "glGenBuffersARB");
+		echo_glBindBuffer = (echo_bind_buffer_t)get_proc("glBindBuffer", "glBindBufferARB");
+		echo_glBufferData = (echo_buffer_data_t)get_proc("glBufferData", "glBufferDataARB");
+		echo_glBufferSubData = (echo_buffer_sub_data_t)get_proc("glBufferSubData", "glBufferSubDataARB");
+		echo_glDeleteBuffers = (echo_delete_buffers_t)get_proc("glDeleteBuffers", "glDeleteBuffersARB");
+		has_vbo = echo_glGenBuffers && echo_glBindBuffer && echo_glBufferData
+				&& echo_glBufferSubData && echo_glDeleteBuffers;
+	}
+	if(major >= 3 || has_ext(exts, "GL_ARB_framebuffer_object") || has_ext(exts, "GL_EXT_framebuffer_object"))
+	{
+		echo_glGenFramebuffers = (echo_gen_framebuffers_t)get_proc("glGenFramebuffers", "glGenFramebuffersEXT");
+		echo_glBindFramebuffer = (echo_bind_framebuffer_t)get_proc("glBindFramebuffer", "glBindFramebufferEXT");
+		echo_glFramebufferTexture2D = (echo_framebuffer_texture_2d_t)get_proc("glFramebufferTexture2D"
+			, "glFramebufferTexture2DEXT");
+		echo_glCheckFramebufferStatus = (echo_check_framebuffer_status_t)get_proc("glCheckFramebufferStatus"
+			, "glCheckFramebufferStatusEXT");
+		echo_glDeleteFramebuffers = (echo_delete_framebuffers_t)get_proc("glDeleteFramebuffers"
+			, "glDeleteFramebuffersEXT");
+		has_fbo = echo_glGenFramebuffers && echo_glBindFramebuffer && echo_glFramebufferTexture2D
+				&& echo_glCheckFramebufferStatus && echo_glDeleteFramebuffers
+				&& (major > 1 || minor >= 4 || has_ext(exts, "GL_ARB_depth_texture"));
+	}
+	if(major >= 2)
+	{
+		/// The ARB_shader_objects names take handles, not GLuints, so only the core names will do
+		echo_glCreateShader = (echo_create_shader_t)GET_PROC("glCreateShader");
+		echo_glShaderSource = (echo_shader_source_t)GET_PROC("glShaderSource");
+		echo_glCompileShader = (echo_compile_shader_t)GET_PROC("glCompileShader");
+		echo_glGetShaderiv = (echo_get_shader_iv_t)GET_PROC("glGetShaderiv");
+		echo_glGetShaderInfoLog = (echo_get_shader_info_log_t)GET_PROC("glGetShaderInfoLog");
+		echo_glCreateProgram = (echo_create_program_t)GET_PROC("glCreateProgram");
+		echo_glAttachShader = (echo_attach_shader_t)GET_PROC("glAttachShader");
+		echo_glLinkProgram = (echo_link_program_t)GET_PROC("glLinkProgram");
+		echo_glGetProgramiv = (echo_get_program_iv_t)GET_PROC("glGetProgramiv");
+		echo_glUseProgram = (echo_use_program_t)GET_PROC("glUseProgram");
+		echo_glGetUniformLocation = (echo_get_uniform_location_t)GET_PROC("glGetUniformLocation");
+		echo_glUniform1i = (echo_uniform_1i_t)GET_PROC("glUniform1i");
+		echo_glUniform1f = (echo_uniform_1f_t)GET_PROC("glUniform1f");
+		echo_glUniform2f = (echo_uniform_2f_t)GET_PROC("glUniform2f");
+		echo_glDeleteShader = (echo_delete_shader_t)GET_PROC("glDeleteShader");
+		echo_glDeleteProgram = (echo_delete_program_t)GET_PROC("glDeleteProgram");
+		echo_glActiveTexture = (echo_active_texture_t)GET_PROC("glActiveTexture");
+		has_glsl = echo_glCreateShader && echo_glShaderSource && echo_glCompileShader
+				&& echo_glGetShaderiv && echo_glGetShaderInfoLog && echo_glCreateProgram
+				&& echo_glAttachShader && echo_glLinkProgram && echo_glGetProgramiv
+				&& echo_glUseProgram && echo_glGetUniformLocation && echo_glUniform1i
+				&& echo_glUniform1f && echo_glUniform2f && echo_glDeleteShader
+				&& echo_glDeleteProgram && echo_glActiveTexture;
+	}
+	if((major > 3 || (major == 3 && minor >= 3)) || has_ext(exts, "GL_ARB_timer_query")
+		|| has_ext(exts, "GL_EXT_timer_query"))
+	{
+		echo_glGenQueries = (echo_gen_queries_t)get_proc("glGenQueries", "glGenQueriesARB");
+		echo_glBeginQuery = (echo_begin_query_t)get_proc("glBeginQuery", "glBeginQueryARB");
+		echo_glEndQuery = (echo_end_query_t)get_proc("glEndQuery", "glEndQueryARB");
+		echo_glGetQueryObjectui64v = (echo_get_query_object_ui64v_t)get_proc("glGetQueryObjectui64v"
+			, "glGetQueryObjectui64vEXT");
+		echo_glDeleteQueries = (echo_delete_queries_t)get_proc("glDeleteQueries", "glDeleteQueriesARB");
+		has_timer = echo_glGenQueries && echo_glBeginQuery && echo_glEndQuery
+				&& echo_glGetQueryObjectui64v && echo_glDeleteQueries;
+	}
+	if(has_vbo && has_glsl && ((major > 3 || (major == 3 && minor >= 3))
+		|| (has_ext(exts, "GL_ARB_draw_instanced") && has_ext(exts, "GL_ARB_instanced_arrays"))))
+	{
+		echo_glDrawElementsInstanced = (echo_draw_elements_instanced_t)get_proc("glDrawElementsInstanced"
+			, "glDrawElementsInstancedARB");
+		echo_glVertexAttribDivisor = (echo_vertex_attrib_divisor_t)get_proc("glVertexAttribDivisor"
+			, "glVertexAttribDivisorARB");
+		echo_glVertexAttribPointer = (echo_vertex_attrib_pointer_t)GET_PROC("glVertexAttribPointer");
+		echo_glEnableVertexAttribArray = (echo_enable_vertex_attrib_array_t)GET_PROC("glEnableVertexAttribArray");
+		echo_glDisableVertexAttribArray = (echo_disable_vertex_attrib_array_t)GET_PROC("glDisableVertexAttribArray");
+		echo_glGetAttribLocation = (echo_get_attrib_location_t)GET_PROC("glGetAttribLocation");
+		has_instancing = echo_glDrawElementsInstanced && echo_glVertexAttribDivisor
+				&& echo_glVertexAttribPointer && echo_glEnableVertexAttribArray
+				&& echo_glDisableVertexAttribArray && echo_glGetAttribLocation;
+	}
+	if(has_vbo && (major > 2 || (major == 2 && minor >= 1) || has_ext(exts, "GL_ARB_pixel_buffer_object")))
+	{
+		echo_glMapBuffer = (echo_map_buffer_t)get_proc("glMapBuffer", "glMapBufferARB");
+		echo_glUnmapBuffer = (echo_unmap_buffer_t)get_proc("glUnmapBuffer", "glUnmapBufferARB");
+		has_pbo = echo_glMapBuffer && echo_glUnmapBuffer;
+	}
+	if((major > 3 || (major == 3 && minor >= 2)) || has_ext(exts, "GL_ARB_sync"))
+	{
+		/// ARB_sync has no suffixes
+		echo_glFenceSync = (echo_fence_sync_t)GET_PROC("glFenceSync");
+		echo_glClientWaitSync = (echo_client_wait_sync_t)GET_PROC("glClientWaitSync");
+		echo_glDeleteSync = (echo_delete_sync_t)GET_PROC("glDeleteSync");
+		has_sync = echo_glFenceSync && echo_glClientWaitSync && echo_glDeleteSync;
+	}
+	ECHO_PRINT("GL %s, vertex buffers: %s, framebuffers: %s, shaders: %s, timers: %s, instancing: %s"
+		", pixel buffers: %s, fences: %s\n"
+		, version, has_vbo ? "yes" : "no", has_fbo ? "yes" : "no", has_glsl ? "yes" : "no"
+		, has_timer ? "yes" : "no", has_instancing ? "yes" : "no"
+		, has_pbo ? "yes" : "no", has_sync ? "yes" : "no");
+}
+
+int echo_glext_has_vbo()
+{
+	return(has_vbo);
+}
+
+int echo_glext_has_fbo()
+{
+	return(has_fbo);
+}
+
+int echo_glext_has_glsl()
+{
+	return(has_glsl);
+}
+
+/** Compiles a shader
+ * @return The shader, or 0 if it didn't compile
+ */
+static GLuint compile(GLenum type, const char* source, const char* what)
+{
+	GLuint shader = echo_glCreateShader(type);
+	echo_glShaderSource(shader, 1, &source, NULL);
+	echo_glCompileShader(shader);
+	GLint ok = 0;
+	echo_glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+	if(!ok)
+	{
+		char log[1024];
+		echo_glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+		ECHO_PRINT("%s shader didn't compile: %s\n", what, log);
+		echo_glDeleteShader(shader);
+		return(0);
+	}
+	return(shader);
+}
+
+GLuint echo_glext_program(const char* vertex_source, const char* fragment_source, const char* what)
+{
+	GLuint vert = compile(GL_VERTEX_SHADER, vertex_source, what);
+	GLuint frag = fragment_source ? compile(GL_FRAGMENT_SHADER, fragment_source, what) : 0;
+	if(!vert || (fragment_source && !frag))
+	{
+		if(vert)	echo_glDeleteShader(vert);
+		if(frag)	echo_glDeleteShader(frag);
+		return(0);
+	}
+	GLuint program = echo_glCreateProgram();
+	echo_glAttachShader(program, vert);
+	if(frag)
+		echo_glAttachShader(program, frag);
+	echo_glLinkProgram(program);
+	/// The program keeps them
+	echo_glDeleteShader(vert);
+	if(frag)
+		echo_glDeleteShader(frag);
+	GLint ok = 0;
+	echo_glGetProgramiv(program, GL_LINK_STATUS, &ok);
+	if(!ok)
+	{
+		ECHO_PRINT("%s shader didn't link\n", what);
+		echo_glDeleteProgram(program);
+		return(0);
+	}
+	return(program);
+}
+
+int echo_glext_has_timer()
+{
+	return(has_timer);
+}
+
+int echo_glext_has_instancing()
+{
+	return(has_instancing);
+}
+
+int echo_glext_has_pbo()
+{
+	return(has_pbo);
+}
+
+int echo_glext_has_sync()
+{
+	return(has_sync);
+}
+
+#endif
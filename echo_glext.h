@@ -0,0 +1,248 @@
+// echo_glext.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stddef.h>
+
+#include "echo_platform.h"
+
+#ifndef __ECHO_GLEXT__
+#define __ECHO_GLEXT__
+
+#ifdef ECHO_PC
+	#ifdef ECHO_OSX
+		#include <OpenGL/gl.h>
+	#else
+		#include <GL/gl.h>
+	#endif
+	
+	#ifdef ECHO_WIN
+		#define ECHO_GLAPI	__stdcall
+	#else
+		#define ECHO_GLAPI
+	#endif
+	
+	/// Buffer targets/usages from GL 1.5 (older gl.h does not have them)
+	#ifndef GL_ARRAY_BUFFER
+		#define GL_ARRAY_BUFFER				0x8892
+		#define GL_ELEMENT_ARRAY_BUFFER		0x8893
+		#define GL_STATIC_DRAW				0x88E4
+		#define GL_DYNAMIC_DRAW				0x88E8
+	#endif
+	
+	typedef void (ECHO_GLAPI *echo_gen_buffers_t)(GLsizei n, GLuint* buffers);
+	typedef void (ECHO_GLAPI *echo_bind_buffer_t)(GLenum target, GLuint buffer);
+	typedef void (ECHO_GLAPI *echo_buffer_data_t)(GLenum target, ptrdiff_t size
+		, const GLvoid* data, GLenum usage);
+	typedef void (ECHO_GLAPI *echo_buffer_sub_data_t)(GLenum target, ptrdiff_t offset
+		, ptrdiff_t size, const GLvoid* data);
+	typedef void (ECHO_GLAPI *echo_delete_buffers_t)(GLsizei n, const GLuint* buffers);
+	
+	/// Framebuffer objects (GL 3.0, ARB_framebuffer_object or EXT_framebuffer_object)
+	#ifndef GL_FRAMEBUFFER
+		#define GL_FRAMEBUFFER				0x8D40
+		#define GL_COLOR_ATTACHMENT0		0x8CE0
+		#define GL_DEPTH_ATTACHMENT			0x8D00
+		#define GL_FRAMEBUFFER_COMPLETE		0x8CD5
+	#endif
+	#ifndef GL_FRAMEBUFFER_BINDING
+		#define GL_FRAMEBUFFER_BINDING		0x8CA6
+	#endif
+	#ifndef GL_DEPTH_COMPONENT24
+		#define GL_DEPTH_COMPONENT24		0x81A6
+	#endif
+	#ifndef GL_CLAMP_TO_EDGE
+		#define GL_CLAMP_TO_EDGE			0x812F
+	#endif
+	typedef void (ECHO_GLAPI *echo_gen_framebuffers_t)(GLsizei n, GLuint* framebuffers);
+	typedef void (ECHO_GLAPI *echo_bind_framebuffer_t)(GLenum target, GLuint framebuffer);
+	typedef void (ECHO_GLAPI *echo_framebuffer_texture_2d_t)(GLenum target, GLenum attachment
+		, GLenum textarget, GLuint texture, GLint level);
+	typedef GLenum (ECHO_GLAPI *echo_check_framebuffer_status_t)(GLenum target);
+	typedef void (ECHO_GLAPI *echo_delete_framebuffers_t)(GLsizei n, const GLuint* framebuffers);
+	
+	/// Shaders (GL 2.0)
+	#ifndef GL_FRAGMENT_SHADER
+		#define GL_FRAGMENT_SHADER			0x8B30
+		#define GL_VERTEX_SHADER			0x8B31
+		#define GL_COMPILE_STATUS			0x8B81
+		#define GL_LINK_STATUS				0x8B82
+	#endif
+	#ifndef GL_TEXTURE0
+		#define GL_TEXTURE0					0x84C0
+		#define GL_TEXTURE1					0x84C1
+	#endif
+	typedef GLuint (ECHO_GLAPI *echo_create_shader_t)(GLenum type);
+	typedef void (ECHO_GLAPI *echo_shader_source_t)(GLuint shader, GLsizei count
+		, const char** string, const GLint* length);
+	typedef void (ECHO_GLAPI *echo_compile_shader_t)(GLuint shader);
+	typedef void (ECHO_GLAPI *echo_get_shader_iv_t)(GLuint shader, GLenum pname, GLint* params);
+	typedef void (ECHO_GLAPI *echo_get_shader_info_log_t)(GLuint shader, GLsizei size
+		, GLsizei* length, char* log);
+	typedef GLuint (ECHO_GLAPI *echo_create_program_t)();
+	typedef void (ECHO_GLAPI *echo_attach_shader_t)(GLuint program, GLuint shader);
+	typedef void (ECHO_GLAPI *echo_link_program_t)(GLuint program);
+	typedef void (ECHO_GLAPI *echo_get_program_iv_t)(GLuint program, GLenum pname, GLint* params);
+	typedef void (ECHO_GLAPI *echo_use_program_t)(GLuint program);
+	typedef GLint (ECHO_GLAPI *echo_get_uniform_location_t)(GLuint program, const char* name);
+	typedef void (ECHO_GLAPI *echo_uniform_1i_t)(GLint location, GLint v0);
+	typedef void (ECHO_GLAPI *echo_uniform_1f_t)(GLint location, GLfloat v0);
+	typedef void (ECHO_GLAPI *echo_uniform_2f_t)(GLint location, GLfloat v0, GLfloat v1);
+	typedef void (ECHO_GLAPI *echo_delete_shader_t)(GLuint shader);
+	typedef void (ECHO_GLAPI *echo_delete_program_t)(GLuint program);
+	typedef void (ECHO_GLAPI *echo_active_texture_t)(GLenum texture);
+	
+	/// Timer queries (GL 3.3, ARB_timer_query or EXT_timer_query)
+	#ifndef GL_TIME_ELAPSED
+		#define GL_TIME_ELAPSED				0x88BF
+	#endif
+	#ifndef GL_QUERY_RESULT
+		#define GL_QUERY_RESULT				0x8866
+	#endif
+	typedef void (ECHO_GLAPI *echo_gen_queries_t)(GLsizei n, GLuint* ids);
+	typedef void (ECHO_GLAPI *echo_begin_query_t)(GLenum target, GLuint id);
+	typedef void (ECHO_GLAPI *echo_end_query_t)(GLenum target);
+	typedef void (ECHO_GLAPI *echo_get_query_object_ui64v_t)(GLuint id, GLenum pname
+		, unsigned long long* params);
+	typedef void (ECHO_GLAPI *echo_delete_queries_t)(GLsizei n, const GLuint* ids);
+	
+	/// Instanced arrays (GL 3.3, or ARB_draw_instanced with ARB_instanced_arrays)
+	#ifndef GL_STREAM_DRAW
+		#define GL_STREAM_DRAW				0x88E0
+	#endif
+	typedef void (ECHO_GLAPI *echo_draw_elements_instanced_t)(GLenum mode, GLsizei count
+		, GLenum type, const GLvoid* indices, GLsizei instances);
+	typedef void (ECHO_GLAPI *echo_vertex_attrib_divisor_t)(GLuint index, GLuint divisor);
+	typedef void (ECHO_GLAPI *echo_vertex_attrib_pointer_t)(GLuint index, GLint size, GLenum type
+		, GLboolean normalized, GLsizei stride, const GLvoid* pointer);
+	typedef void (ECHO_GLAPI *echo_enable_vertex_attrib_array_t)(GLuint index);
+	typedef void (ECHO_GLAPI *echo_disable_vertex_attrib_array_t)(GLuint index);
+	typedef GLint (ECHO_GLAPI *echo_get_attrib_location_t)(GLuint program, const char* name);
+	
+	/// Pixel buffer objects (GL 2.1 or ARB_pixel_buffer_object)
+	#ifndef GL_PIXEL_PACK_BUFFER
+		#define GL_PIXEL_PACK_BUFFER		0x88EB
+	#endif
+	#ifndef GL_STREAM_READ
+		#define GL_STREAM_READ				0x88E1
+	#endif
+	#ifndef GL_READ_ONLY
+		#define GL_READ_ONLY				0x88B8
+	#endif
+	#ifndef GL_BGRA
+		#define GL_BGRA						0x80E1
+	#endif
+	typedef void* (ECHO_GLAPI *echo_map_buffer_t)(GLenum target, GLenum access);
+	typedef GLboolean (ECHO_GLAPI *echo_unmap_buffer_t)(GLenum target);
+	
+	/// Fences (GL 3.2 or ARB_sync); older gl.h has no GLsync
+	#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+		#define GL_SYNC_GPU_COMMANDS_COMPLETE	0x9117
+		#define GL_ALREADY_SIGNALED			0x911A
+		#define GL_CONDITION_SATISFIED		0x911C
+	#endif
+	typedef void* echo_sync_t;
+	typedef echo_sync_t (ECHO_GLAPI *echo_fence_sync_t)(GLenum condition, GLbitfield flags);
+	typedef GLenum (ECHO_GLAPI *echo_client_wait_sync_t)(echo_sync_t sync, GLbitfield flags
+		, unsigned long long timeout);
+	typedef void (ECHO_GLAPI *echo_delete_sync_t)(echo_sync_t sync);
+	
+	/// Looks up a GL entry point by name (wglGetProcAddress, eglGetProcAddress, ...)
+	typedef void* (*echo_get_proc_t)(const char* name);
+	
+	/// Extension entry points; NULL until echo_glext_init finds them
+	extern echo_gen_buffers_t echo_glGenBuffers;
+	extern echo_bind_buffer_t echo_glBindBuffer;
+	extern echo_buffer_data_t echo_glBufferData;
+	extern echo_buffer_sub_data_t echo_glBufferSubData;
+	extern echo_delete_buffers_t echo_glDeleteBuffers;
+	extern echo_gen_framebuffers_t echo_glGenFramebuffers;
+	extern echo_bind_framebuffer_t echo_glBindFramebuffer;
+	extern echo_framebuffer_texture_2d_t echo_glFramebufferTexture2D;
+	extern echo_check_framebuffer_status_t echo_glCheckFramebufferStatus;
+	extern echo_delete_framebuffers_t echo_glDeleteFramebuffers;
+	extern echo_create_shader_t echo_glCreateShader;
+	extern echo_shader_source_t echo_glShaderSource;
+	extern echo_compile_shader_t echo_glCompileShader;
+	extern echo_get_shader_iv_t echo_glGetShaderiv;
+	extern echo_get_shader_info_log_t echo_glGetShaderInfoLog;
+	extern echo_create_program_t echo_glCreateProgram;
+	extern echo_attach_shader_t echo_glAttachShader;
+	extern echo_link_program_t echo_glLinkProgram;
+	extern echo_get_program_iv_t echo_glGetProgramiv;
+	extern echo_use_program_t echo_glUseProgram;
+	extern echo_get_uniform_location_t echo_glGetUniformLocation;
+	extern echo_uniform_1i_t echo_glUniform1i;
+	extern echo_uniform_1f_t echo_glUniform1f;
+	extern echo_uniform_2f_t echo_glUniform2f;
+	extern echo_delete_shader_t echo_glDeleteShader;
+	extern echo_delete_program_t echo_glDeleteProgram;
+	extern echo_active_texture_t echo_glActiveTexture;
+	extern echo_gen_queries_t echo_glGenQueries;
+	extern echo_begin_query_t echo_glBeginQuery;
+	extern echo_end_query_t echo_glEndQuery;
+	extern echo_get_query_object_ui64v_t echo_glGetQueryObjectui64v;
+	extern echo_delete_queries_t echo_glDeleteQueries;
+	extern echo_draw_elements_instanced_t echo_glDrawElementsInstanced;
+	extern echo_vertex_attrib_divisor_t echo_glVertexAttribDivisor;
+	extern echo_vertex_attrib_pointer_t echo_glVertexAttribPointer;
+	extern echo_enable_vertex_attrib_array_t echo_glEnableVertexAttribArray;
+	extern echo_disable_vertex_attrib_array_t echo_glDisableVertexAttribArray;
+	extern echo_get_attrib_location_t echo_glGetAttribLocation;
+	extern echo_map_buffer_t echo_glMapBuffer;
+	extern echo_unmap_buffer_t echo_glUnmapBuffer;
+	extern echo_fence_sync_t echo_glFenceSync;
+	extern echo_client_wait_sync_t echo_glClientWaitSync;
+	extern echo_delete_sync_t echo_glDeleteSync;
+	
+	/** Looks the entry points up with get_proc instead of the window system's
+	 * function; for contexts GLUT didn't make (see echo_offscreen.h).
+	 * Call before echo_glext_init.
+	 * @param get_proc The lookup function, or NULL for the window system's
+	 */
+	void echo_glext_set_loader(echo_get_proc_t get_proc);
+	
+	/** Looks up the extension entry points L-Echo uses.  Needs a current context.
+	 * Safe to call more than once.
+	 */
+	void echo_glext_init();
+	/// Are vertex buffer objects usable?  (after echo_glext_init)
+	int echo_glext_has_vbo();
+	/// Are framebuffer objects (with depth textures) usable?  (after echo_glext_init)
+	int echo_glext_has_fbo();
+	/// Are GLSL shaders usable?  (after echo_glext_init)
+	int echo_glext_has_glsl();
+	/** Compiles and links a shader program (needs echo_glext_has_glsl)
+	 * @param vertex_source Source of the vertex shader
+	 * @param fragment_source Source of the fragment shader, or NULL to keep the fixed one
+	 * @param what What the program is for, to print if it fails
+	 * @return The program, or 0 if it didn't compile or link
+	 */
+	GLuint echo_glext_program(const char* vertex_source, const char* fragment_source, const char* what);
+	/// Are GL_TIME_ELAPSED queries usable?  (after echo_glext_init)
+	int echo_glext_has_timer();
+	/// Are instanced draws with per-instance attributes (and shaders) usable?  (after echo_glext_init)
+	int echo_glext_has_instancing();
+	/// Can glReadPixels go into a GL_PIXEL_PACK_BUFFER and be mapped?  (after echo_glext_init)
+	int echo_glext_has_pbo();
+	/// Are fences usable?  (after echo_glext_init)
+	int echo_glext_has_sync();
+#endif
+
+#endif
@@ -470,6 +470,10 @@ stage* load_stage(char* file_name)
 		delete nonffgrids;
 		delete ffgrids;
 #endif
+		/// -----------------------------------------------------------the string ids were only needed to link the grids
+		ret->drop_names();
+		/// -----------------------------------------------------------pack the grid corners
+		ret->build_corners();
 		return(ret);
 	}
 	/// Failing to open the file...
@@ -583,7 +587,7 @@ static int add_esc(echo_xml_element* child, stage* st, DEPENDENCY_MAP* map, escg
 	{
 		if(!strcmp(*type, "angle"))
 		{
-			vector3f* each_angle = new vector3f();
+			vector3f* each_angle = new(st->get_arena()) vector3f();
 			
 			if(get_angle(child, each_angle) == WIN)
 			{
@@ -623,16 +627,15 @@ static int add_esc(echo_xml_element* child, stage* st, DEPENDENCY_MAP* map, escg
 			}
 			else
 				lderr("couldn't get angle in add_esc!");
-			delete each_angle;
 		}
 		else if(!strcmp(*type, "range"))
 		{
-			vector3f* v1 = new vector3f();
+			vector3f* v1 = new(st->get_arena()) vector3f();
 			
 			if(echo_xml_get_float_attribute(child, "x_min", &(v1->x)) == WIN
 				&& echo_xml_get_float_attribute(child, "y_min", &(v1->y)) == WIN)
 			{
-				vector3f* v2 = new vector3f();
+				vector3f* v2 = new(st->get_arena()) vector3f();
 				
 				if(echo_xml_get_float_attribute(child, "x_max", &(v2->x)) == WIN
 					&& echo_xml_get_float_attribute(child, "y_max", &(v2->y)) == WIN)
@@ -652,7 +655,7 @@ static int add_esc(echo_xml_element* child, stage* st, DEPENDENCY_MAP* map, escg
 #endif
 							if(g != NULL)
 							{
-								angle_range* range = new angle_range(v1, v2);
+								angle_range* range = new(st->get_arena()) angle_range(v1, v2);
 								//ECHO_PRINT("range added\n");
 								
 								egrid->add(range, g);
@@ -674,12 +677,9 @@ static int add_esc(echo_xml_element* child, stage* st, DEPENDENCY_MAP* map, escg
 				}
 				else
 					lderr("couldn't get max for angle range!");
-				delete v2;
 			}
 			else
 				lderr("couldn't get min for angle range!");
-			delete v1;
-			
 		}
 		else
 			lderr("child of escgrid, hole or launcher is not an angle or range!");
@@ -814,7 +814,7 @@ static filter* get_filter(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map,
 		char* name = get_attribute(txe, "id", "no id for goal filter");
 		if(name != NULL)
 		{
-			filter* ret = new filter();
+			filter* ret = new(st->get_arena()) filter();
 			
 			grid* g = st->get(name);
 			if(g)
@@ -844,7 +844,7 @@ static filter* get_filter(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map,
 				
 				if(echo_xml_to_element(*first, e) == WIN)
 				{
-					not_filter* ret = new not_filter(get_filter(*e, st, map));
+					not_filter* ret = new(st->get_arena()) not_filter(get_filter(*e, st, map));
 					
 					delete e;
 					delete first;
@@ -864,8 +864,8 @@ static filter* get_filter(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map,
 	else if(!strcmp(type, "or") || !strcmp(type, "and"))
 	{
 		multi_filter* ret = (!strcmp(type, "or")) ?
-				dynamic_cast<multi_filter*>(new or_filter()) : 
-				dynamic_cast<multi_filter*>(new and_filter());
+				dynamic_cast<multi_filter*>(new(st->get_arena()) or_filter()) : 
+				dynamic_cast<multi_filter*>(new(st->get_arena()) and_filter());
 		
 		int error = false;
 		echo_xml_node** first = new(echo_xml_node*);
@@ -907,8 +907,9 @@ static filter* get_filter(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map,
 			delete e;
 		}
 		delete first;
-		if(error == true)	delete ret;
-		else				return(ret);
+		/// On an error, the filter is left for the arena to free
+		if(error == false)
+			return(ret);
 	}
 	else
 		lderr("filter type unknown\n");
@@ -946,13 +947,13 @@ static trigger* get_trigger(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* ma
 		grid* g = st->get(name);
 		if(g)
 		{
-			trigger* ret = new trigger(f, g);
+			trigger* ret = new(st->get_arena()) trigger(f, g);
 			
 			return(ret);
 		}
 		else
 		{
-			trigger* ret = new trigger(f);
+			trigger* ret = new(st->get_arena()) trigger(f);
 			
 			LD_PRINT("trigger target (%s) is null, adding to dep map\n", name);
 			add(map, name, ret, &trigger::set_target);
@@ -1030,9 +1031,9 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 		
 		if(echo_xml_get_tagname(txe, type) == WIN)
 		{
-			grid_info_t* info = new(grid_info_t);
+			grid_info_t* info = new(st->get_arena()) grid_info_t;
 			
-			info->pos = new vector3f();
+			info->pos = new(st->get_arena()) vector3f();
 			
 			if(get_vec(txe, info->pos, st) == WIN)
 			{
@@ -1048,7 +1049,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 						if(!strcmp(*type, "grid"))
 						{
 							LD_PRINT("%s is a grid!\n", name);
-							new_grid = new grid(info, prev, next);
+							new_grid = new(st->get_arena()) grid(info, prev, next);
 							
 						}
 						else if(!strcmp(*type, "t_grid"))
@@ -1058,7 +1059,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 							if(next2_id != NULL)
 							{
 								grid* next2 = st->get(next2_id);
-								new_grid = new t_grid(info, prev, next, next2);
+								new_grid = new(st->get_arena()) t_grid(info, prev, next, next2);
 								
 								if(!next2 && strcmp(next2_id, "NONE"))
 								{
@@ -1070,7 +1071,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 						else if(!strcmp(*type, "escgrid"))
 						{
 							LD_PRINT("%s is a escgrid!\n", name);
-							new_grid = new escgrid(info, prev, next);
+							new_grid = new(st->get_arena()) escgrid(info, prev, next);
 							
 #ifdef ECHO_NDS
 							if(!add_escs(txe, st, map, escroot, (escgrid*)new_grid, nonffgrids, ffgrids))
@@ -1085,7 +1086,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 						else if(!strcmp(*type, "hole"))
 						{
 							LD_PRINT("%s is an hole!\n", name);
-							new_grid = new hole(info);
+							new_grid = new(st->get_arena()) hole(info);
 							
 #ifdef ECHO_NDS
 							if(!add_escs(txe, st, map, escroot, (escgrid*)new_grid, nonffgrids, ffgrids))
@@ -1100,7 +1101,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 						else if(!strcmp(*type, "launcher"))
 						{
 							LD_PRINT("%s is a launcher!\n", name);
-							new_grid = new launcher(info);
+							new_grid = new(st->get_arena()) launcher(info);
 							
 #ifdef ECHO_NDS
 							if(!add_escs(txe, st, map, escroot, (escgrid*)new_grid, nonffgrids, ffgrids))
@@ -1125,7 +1126,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 									&& echo_xml_next_sibling(*first, first) == WIN);
 								if(*first != NULL)
 								{
-									vector3f* dir_angle = new vector3f();
+									vector3f* dir_angle = new(st->get_arena()) vector3f();
 									
 									echo_xml_element** e = new(echo_xml_element*);
 									
@@ -1139,38 +1140,33 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 												&& echo_xml_next_sibling(*first, first) == WIN);
 											if(*first != NULL)
 											{
-												vector3f* width_angle = new vector3f();
+												vector3f* width_angle = new(st->get_arena()) vector3f();
 												
 												if(echo_xml_to_element(*first, e) == WIN 
 													&& get_vec(*e, width_angle) == WIN)
 												{
-													new_grid = new freeform_grid(info, prev, next, dir_angle, width_angle);
+													new_grid = new(st->get_arena()) freeform_grid(info, prev, next, dir_angle, width_angle);
 													
 												}
 												else
 												{
 													lderr("couldn't get width of freeform_grid!", name);
-													delete width_angle;
-													delete dir_angle;
 												}
 											}
 											else
 											{
 												lderr("cannot find width element of freeform_grid: " , name);
-												delete dir_angle;
 											}
 										}
 										else
 										{
 											lderr("cannot find width element of freeform_grid: " , name);
-											delete dir_angle;
 										}
 										delete e;
 									}
 									else
 									{
 										lderr("couldn't get direction of freeform grid!:", name);
-										delete dir_angle;
 									}
 								}
 								else
@@ -1186,7 +1182,7 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 							if(echo_xml_get_float_attribute(txe, "direction", &angle) == WIN)
 							{
 								LD_PRINT("angle: %f\n", angle);
-								new_grid = new stair(info, prev, next, angle);
+								new_grid = new(st->get_arena()) stair(info, prev, next, angle);
 								
 							}
 							else
@@ -1321,7 +1317,6 @@ static grid* parse_grid(echo_xml_element* txe, stage* st, DEPENDENCY_MAP* map, e
 			}
 			else
 				lderr("couldn't get position!");
-			delete info;
 		}
 		else
 			lderr("type not known for grid: " , name);
@@ -24,6 +24,11 @@
 
 #include <cmath>
 
+#ifdef ECHO_SSE
+	#include <xmmintrin.h>
+	#include <emmintrin.h>
+#endif
+
 #ifdef ECHO_NDS
 	#include <nds.h>
 	#include <nds/ndstypes.h>
@@ -61,24 +66,6 @@ float echo_sin(float deg){ return(ECHO_SINF(deg)); }
 float echo_cos(int deg){ return(ECHO_COSI(deg)); }
 float echo_cos(float deg){ return(ECHO_COSF(deg)); }
 
-/// Default constructor
-vector3f::vector3f()
-{
-	x = 0;
-	y = 0;
-	z = 0;
-}
-/** Sets elements as specified
- * @param myX The new vector's x-coordinate
- * @param myY The new vector's y-coordinate
- * @param myZ The new vector's z-coordinate
- */
-vector3f::vector3f(float my_x, float my_y, float my_z)
-{
-	x = my_x;
-	y = my_y;
-	z = my_z;
-}
 /** Test if the vectors are unequal, or different outside of the range of +/- EPSILON.
  * @param v The other vector to check against.
  */
@@ -102,7 +89,7 @@ int vector3f::operator ==(vector3f* v)
  * vector is used as a point or direction.
  * @return The length of this vector
  */
-float vector3f::length()
+float vector3f::length() const
 {
 	return(sqrt(x * x + y * y + z * z));
 }
@@ -121,123 +108,50 @@ void vector3f::set(vector3f* copy_from)
 	y = copy_from->y;
 	z = copy_from->z;
 }
-/** Gets a new vector that is opposite to this vector.
- * @return A new vector that is opposite to this vector
- */
-vector3f* vector3f::negate()
-{
-	vector3f* ret = new vector3f(-x, -y, -z);
-	
-	return(ret);
-}
-/** Gets the resultant vector from the addition of this vector and the one given.
- * @param vec The other vector to add to to form the resultant vector.
- * @return The resultant vector.
- */
-vector3f* vector3f::operator +(vector3f* vec)
-{
-    vector3f* ret = new vector3f(x + vec->x, y + vec->y, z + vec->z);
-    
-    return(ret);
-}
-/** Gets the resultant vector from the subtraction of the vector given from this vector.
- * @param vec The other vector to subtract this vector to form the resultant vector.
- * @return The resultant vector.
- */
-vector3f* vector3f::operator -(vector3f* vec)
-{
-    vector3f* ret = new vector3f(x - vec->x, y - vec->y, z - vec->z);
-    
-    return(ret);
-}
-/** Gets a new vector that is this vector times the scalar given.
- * @param f Factor to multiply each element by.
- * @return This vector times the scalar given.
- */
-vector3f* vector3f::operator *(float f)
-{
-	vector3f* ret = new vector3f(x * f, y * f, z * f);
-	
-	return(ret);
-}
-/** Gets a new vector representing the angle between this vector and <0, 0, 1>
+/** Gets the angle between this vector and <0, 0, 1>
  * @return Vector with the x and y rotation angles needed to rotate this vector to the positive z-axis.
  */
-vector3f* vector3f::angle_xy()
+vector3f vector3f::angle_xy() const
 {
-	vector3f* ret = NULL;
 	if(z == 0)
-		ret = new vector3f(0, TO_DEG(atan2f(x, z)), 0);
-	else
-	{
-		ret = new vector3f(-TO_DEG(atan2f(y, z > 0 
-				? sqrt(x * x  + z * z) : -sqrt(x * x  + z * z))),
-					TO_DEG(atan2f(x, z)), 0);
-	}
-        
-        return(ret);
-
+		return(vector3f(0, TO_DEG(atan2f(x, z)), 0));
+	return(vector3f(-TO_DEG(atan2f(y, z > 0 
+			? sqrt(x * x  + z * z) : -sqrt(x * x  + z * z))),
+				TO_DEG(atan2f(x, z)), 0));
 }
 /** Gets the distance between this point vector and the other point vector given.
  * @param other The other point.
  * @return The distance between the two points.
  */
-float vector3f::dist(vector3f* other)
+float vector3f::dist(const vector3f& other) const
 {
-	return(sqrt((x - other->x) * (x - other->x)
-		+ (y - other->y) * (y - other->y) 
-		+ (z - other->z) * (z - other->z)));
+	return(sqrt((x - other.x) * (x - other.x)
+		+ (y - other.y) * (y - other.y) 
+		+ (z - other.z) * (z - other.z)));
 }
 /** Gets the distance between this point vector and <0, 1, 0>.
  * Used to accelerate IK calculations
  * @return Distance between this point and <0, 1, 0>
  */
-float vector3f::dist_with_up()
+float vector3f::dist_with_up() const
 {
 	return(sqrt(x * x + y * y - 2 * y + 1 + z * z));
 }
 /** Rotates from Absolute Position to World Position
  * @param rot Current camera angle
- * @return New vector containing a World Position if this vector is an Absolute Position
+ * @return A World Position if this vector is an Absolute Position
  */
-vector3f* vector3f::rotate_xy(vector3f rot)
+vector3f vector3f::rotate_xy(vector3f rot) const
 {
-	/// If there is no rotation, just give a copy of this vector
-	if(rot.x == 0 && rot.y == 0)
-	{
-		vector3f* ret = new vector3f(x, y, z);
-		
-		return(ret);
-	}
-	vector3f* ret = new vector3f(x
-			, y * ECHO_COSF(rot.x) - z * ECHO_SINF(rot.x)
-			, y * ECHO_SINF(rot.x) + z * ECHO_COSF(rot.x));
-	
-	float z_save = ret->z;
-	ret->z = ret->z * ECHO_COSF(rot.y) - ret->x * ECHO_SINF(rot.y);
-	ret->x = z_save * ECHO_SINF(rot.y) + ret->x * ECHO_COSF(rot.y);
-	return(ret);
+	return(camera_basis(rot).rotate_xy(*this));
 }
 /** Rotates from World Position to Screen Position
  * @param rot Current camera angle
- * @return New vector containing a Screen Position if this vector is a World Position
+ * @return A Screen Position if this vector is a World Position
  */
-vector3f* vector3f::neg_rotate_xy(vector3f rot)
+vector3f vector3f::neg_rotate_xy(vector3f rot) const
 {
-	if(rot.x == 0 && rot.y == 0)
-	{
-		vector3f* ret = new vector3f(x, y, z);
-		
-		return(ret);
-	}
-	vector3f* ret = new vector3f(x
-			, y * ECHO_COSF(-rot.x) - z * ECHO_SINF(-rot.x)
-			, y * ECHO_SINF(-rot.x) + z * ECHO_COSF(-rot.x));
-	
-	float z_save = ret->z;
-	ret->z = ret->z * ECHO_COSF(-rot.y) - ret->x * ECHO_SINF(-rot.y);
-	ret->x = z_save * ECHO_SINF(-rot.y) + ret->x * ECHO_COSF(-rot.y);
-	return(ret);
+	return(camera_basis(rot).neg_rotate_xy(*this));
 }
 /** Sets the vector to the components given.
  * @param my_x The new x component of this vector
@@ -252,48 +166,24 @@ void vector3f::set(float my_x, float my_y, float my_z)
 }
 /** Rotates from Screen Position to World Position
  * @param rot Current camera angle
- * @return New vector containing a World Position if this vector is a Screen Position
+ * @return A World Position if this vector is a Screen Position
  */
-vector3f* vector3f::rotate_yx(vector3f rot)
+vector3f vector3f::rotate_yx(vector3f rot) const
 {
-	if(rot.x == 0 && rot.y == 0)
-	{
-		vector3f* ret = new vector3f(x, y, z);
-		
-		return(ret);
-	}
-	vector3f* ret = new vector3f(z * ECHO_SINF(rot.y) + x * ECHO_COSF(rot.y), y
-                                , z * ECHO_COSF(rot.y) - x * ECHO_SINF(rot.y));
-	
-	float y_save = ret->y;
-	ret->y = ret->y * ECHO_COSF(rot.x) - ret->z * ECHO_SINF(rot.x);
-	ret->z = y_save * ECHO_SINF(rot.x) + ret->z * ECHO_COSF(rot.x);
-	return(ret);
+	return(camera_basis(rot).rotate_yx(*this));
 }
 /** Rotates from World Position to Absolute Position
  * @param rot Current camera angle
- * @return New vector containing an Absolute Position if this vector is a World Position
+ * @return An Absolute Position if this vector is a World Position
  */
-vector3f* vector3f::neg_rotate_yx(vector3f rot)
+vector3f vector3f::neg_rotate_yx(vector3f rot) const
 {
-	if(rot.x == 0 && rot.y == 0)
-	{
-		vector3f* ret = new vector3f(x, y, z);
-		
-		return(ret);
-	}
-	vector3f* ret = new vector3f(z * ECHO_SINF(-rot.y) + x * ECHO_COSF(-rot.y), y
-                                , z * ECHO_COSF(-rot.y) - x * ECHO_SINF(-rot.y));
-	
-	float y_save = ret->y;
-	ret->y = ret->y * ECHO_COSF(-rot.x) - ret->z * ECHO_SINF(-rot.x);
-	ret->z = y_save * ECHO_SINF(-rot.x) + ret->z * ECHO_COSF(-rot.x);
-	return(ret);
+	return(camera_basis(rot).neg_rotate_yx(*this));
 }
 /** Returns the angle this vector has with up as a single scalar in degrees
  * @return Angle this vector has with up; note that this is on an interval of [0, 180]
  */
-float vector3f::scalar_angle_with_up()
+float vector3f::scalar_angle_with_up() const
 {
 	const float distance = dist_with_up();
 	const float length1 = length();
@@ -335,15 +225,29 @@ float IK_angle(float length1, float length2, float distance)
  */
 int lineSeg_intersect(vector3f* a1, vector3f* a2, vector3f* b1, vector3f* b2)
 {
-    float a1yb1y = a1->y - b1->y;
-    float a1xb1x = a1->x - b1->x;
+	return(lineSeg_intersect(a1, a2, b1->x, b1->y, b2->x, b2->y));
+}
+/** Same as lineSeg_intersect, but B is given as loose coordinates (like the
+ * stage's projected corner arrays).
+ * @param a1 One of the points of line segment A
+ * @param a2 One of the points of line segment A
+ * @param b1x X-coordinate of one of the points of line segment B
+ * @param b1y Y-coordinate of one of the points of line segment B
+ * @param b2x X-coordinate of one of the points of line segment B
+ * @param b2y Y-coordinate of one of the points of line segment B
+ * @return If line segments A and B intersect.
+ */
+int lineSeg_intersect(const vector3f* a1, const vector3f* a2, float b1x, float b1y, float b2x, float b2y)
+{
+    float a1yb1y = a1->y - b1y;
+    float a1xb1x = a1->x - b1x;
     float a2xa1x = a2->x - a1->x;
     float a2ya1y = a2->y - a1->y;
 	
     //----------------------------------------------------------------------
 	
-    float crossa = a1yb1y * (b2->x - b1->x) - a1xb1x * (b2->y - b1->y);
-    float crossb = a2xa1x * (b2->y - b1->y) - a2ya1y * (b2->x - b1->x);
+    float crossa = a1yb1y * (b2x - b1x) - a1xb1x * (b2y - b1y);
+    float crossb = a2xa1x * (b2y - b1y) - a2ya1y * (b2x - b1x);
 	
     //----------------------------------------------------------------------
     
@@ -363,6 +267,176 @@ int lineSeg_intersect(vector3f* a1, vector3f* a2, vector3f* b1, vector3f* b2)
     return(true);
 }
 
+/** Tests line segment A against many line segments at once; gives exactly the
+ * same answers as calling lineSeg_intersect on each.  The B segments are packed
+ * as separate coordinate arrays.  Uses SSE where it's available.
+ * @param a1 One of the points of line segment A
+ * @param a2 One of the points of line segment A
+ * @param b1x X-coordinates of the first points of the B segments
+ * @param b1y Y-coordinates of the first points of the B segments
+ * @param b2x X-coordinates of the second points of the B segments
+ * @param b2y Y-coordinates of the second points of the B segments
+ * @param hits Where to store the results; hits[i] is 1 if A intersects B segment i, 0 otherwise
+ * @param n Number of B segments
+ * @return The number of B segments A intersects
+ */
+int lineSeg_intersect_batch(const vector3f* a1, const vector3f* a2
+		, const float* b1x, const float* b1y, const float* b2x, const float* b2y
+		, unsigned char* hits, int n)
+{
+	int each = 0, count = 0;
+#ifdef ECHO_SSE
+	/** Each lane follows the scalar version step by step; the early returns
+	 * become masks.  The comparisons behave the same with NaNs, too:
+	 * "crossb == 0" and the ordered compares are false, so NaN lanes hit.
+	 */
+	const __m128 a1x = _mm_set1_ps(a1->x), a1y = _mm_set1_ps(a1->y);
+	const __m128 a2xa1x = _mm_set1_ps(a2->x - a1->x);
+	const __m128 a2ya1y = _mm_set1_ps(a2->y - a1->y);
+	const __m128 zero = _mm_setzero_ps();
+	/// Clears the sign bit for fabs
+	const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	while(each + 4 <= n)
+	{
+		const __m128 bx1 = _mm_loadu_ps(b1x + each), by1 = _mm_loadu_ps(b1y + each);
+		const __m128 bdx = _mm_sub_ps(_mm_loadu_ps(b2x + each), bx1);
+		const __m128 bdy = _mm_sub_ps(_mm_loadu_ps(b2y + each), by1);
+		const __m128 a1yb1y = _mm_sub_ps(a1y, by1);
+		const __m128 a1xb1x = _mm_sub_ps(a1x, bx1);
+		
+		__m128 crossa = _mm_sub_ps(_mm_mul_ps(a1yb1y, bdx), _mm_mul_ps(a1xb1x, bdy));
+		const __m128 crossb = _mm_sub_ps(_mm_mul_ps(a2xa1x, bdy), _mm_mul_ps(a2ya1y, bdx));
+		const __m128 abs_crossb = _mm_and_ps(crossb, abs_mask);
+		
+		/// crossb != 0
+		__m128 hit = _mm_cmpneq_ps(crossb, zero);
+		/// !(fabs(crossa) > fabs(crossb) || crossa * crossb < 0)
+		__m128 miss = _mm_or_ps(_mm_cmpgt_ps(_mm_and_ps(crossa, abs_mask), abs_crossb)
+						, _mm_cmplt_ps(_mm_mul_ps(crossa, crossb), zero));
+		hit = _mm_andnot_ps(miss, hit);
+		
+		crossa = _mm_sub_ps(_mm_mul_ps(a1yb1y, a2xa1x), _mm_mul_ps(a1xb1x, a2ya1y));
+		miss = _mm_or_ps(_mm_cmpgt_ps(_mm_and_ps(crossa, abs_mask), abs_crossb)
+						, _mm_cmplt_ps(_mm_mul_ps(crossa, crossb), zero));
+		hit = _mm_andnot_ps(miss, hit);
+		
+		const int bits = _mm_movemask_ps(hit);
+		hits[each] = bits & 1;
+		hits[each + 1] = (bits >> 1) & 1;
+		hits[each + 2] = (bits >> 2) & 1;
+		hits[each + 3] = (bits >> 3) & 1;
+		count += hits[each] + hits[each + 1] + hits[each + 2] + hits[each + 3];
+		each += 4;
+	}
+#endif
+	while(each < n)
+	{
+		hits[each] = lineSeg_intersect(a1, a2, b1x[each], b1y[each], b2x[each], b2y[each]) ? 1 : 0;
+		count += hits[each];
+		each++;
+	}
+	return(count);
+}
+
+//-----------CAMERA_BASIS----------
+/// Builds the basis for no rotation
+camera_basis::camera_basis()
+{
+	set(vector3f(0, 0, 0));
+}
+/** Builds the basis for the given angle
+ * @param my_angle The camera angle
+ */
+camera_basis::camera_basis(vector3f my_angle)
+{
+	set(my_angle);
+}
+/** Fills a rotation matrix that first rotates about the x-axis by ax,
+ * then about the y-axis by ay (the order of vector3f::rotate_xy)
+ * @param m Row-major 3x3 matrix to fill
+ * @param ax Rotation about the x-axis in degrees
+ * @param ay Rotation about the y-axis in degrees
+ */
+static void fill_xy(float* m, float ax, float ay)
+{
+	const float cx = ECHO_COSF(ax), sx = ECHO_SINF(ax);
+	const float cy = ECHO_COSF(ay), sy = ECHO_SINF(ay);
+	m[0] = cy;	m[1] = sx * sy;	m[2] = cx * sy;
+	m[3] = 0;	m[4] = cx;		m[5] = -sx;
+	m[6] = -sy;	m[7] = sx * cy;	m[8] = cx * cy;
+}
+/** Fills a rotation matrix that first rotates about the y-axis by ay,
+ * then about the x-axis by ax (the order of vector3f::rotate_yx)
+ * @param m Row-major 3x3 matrix to fill
+ * @param ax Rotation about the x-axis in degrees
+ * @param ay Rotation about the y-axis in degrees
+ */
+static void fill_yx(float* m, float ax, float ay)
+{
+	const float cx = ECHO_COSF(ax), sx = ECHO_SINF(ax);
+	const float cy = ECHO_COSF(ay), sy = ECHO_SINF(ay);
+	m[0] = cy;		m[1] = 0;	m[2] = sy;
+	m[3] = sx * sy;	m[4] = cx;	m[5] = -sx * cy;
+	m[6] = -cx * sy;	m[7] = sx;	m[8] = cx * cy;
+}
+/** Rebuilds the basis for the given angle
+ * @param my_angle The new camera angle
+ */
+void camera_basis::set(vector3f my_angle)
+{
+	angle = my_angle;
+	identity = (angle.x == 0 && angle.y == 0);
+	fill_xy(world, angle.x, angle.y);
+	fill_yx(world_inv, -angle.x, -angle.y);
+	fill_xy(screen, -angle.x, -angle.y);
+	fill_yx(screen_inv, angle.x, angle.y);
+}
+/** Rotates a batch of World Positions to Screen Positions, keeping only
+ * x and y.  Uses SSE where it's available.
+ * @param x World x-coordinates
+ * @param y World y-coordinates
+ * @param z World z-coordinates
+ * @param out_x Where to store the Screen x-coordinates
+ * @param out_y Where to store the Screen y-coordinates
+ * @param n Number of points
+ */
+void camera_basis::neg_rotate_xy(const float* x, const float* y, const float* z
+					, float* out_x, float* out_y, int n) const
+{
+	int each = 0;
+	/// Same as the single-vector version: no rotation is an exact copy
+	if(identity)
+	{
+		while(each < n)
+		{
+			out_x[each] = x[each];
+			out_y[each] = y[each];
+			each++;
+		}
+		return;
+	}
+#ifdef ECHO_SSE
+	/// Same operation order as mul, so the results are bit-for-bit the same as the scalar path
+	const __m128 m0 = _mm_set1_ps(screen[0]), m1 = _mm_set1_ps(screen[1]), m2 = _mm_set1_ps(screen[2]);
+	const __m128 m3 = _mm_set1_ps(screen[3]), m4 = _mm_set1_ps(screen[4]), m5 = _mm_set1_ps(screen[5]);
+	while(each + 4 <= n)
+	{
+		const __m128 vx = _mm_loadu_ps(x + each);
+		const __m128 vy = _mm_loadu_ps(y + each);
+		const __m128 vz = _mm_loadu_ps(z + each);
+		_mm_storeu_ps(out_x + each, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, vx), _mm_mul_ps(m1, vy)), _mm_mul_ps(m2, vz)));
+		_mm_storeu_ps(out_y + each, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, vx), _mm_mul_ps(m4, vy)), _mm_mul_ps(m5, vz)));
+		each += 4;
+	}
+#endif
+	while(each < n)
+	{
+		out_x[each] = screen[0] * x[each] + screen[1] * y[each] + screen[2] * z[each];
+		out_y[each] = screen[3] * x[each] + screen[4] * y[each] + screen[5] * z[each];
+		each++;
+	}
+}
+
 //-----------ANGLE_RANGE----------
 /** Initialize an AngleRange with the two bounds given
  * @param my_v1 First bound
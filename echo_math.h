@@ -28,6 +28,16 @@
 #define TO_RAD(x)		((x) / 180.0f * PI)
 #define TO_DEG(x)		((x) / PI * 180.0f)
 
+#ifndef __ECHO_CONSTEXPR__
+	#define __ECHO_CONSTEXPR__
+	#if __cplusplus >= 201103L
+		/// Lets the compiler fold vector arithmetic on constants
+		#define ECHO_CONSTEXPR	constexpr
+	#else
+		#define ECHO_CONSTEXPR	inline
+	#endif
+#endif
+
 #ifndef __ECHO_VECTOR_3F__
 #define __ECHO_VECTOR_3F__
 /** @brief Simple data structure, used for anything with three float elements,
@@ -50,7 +60,9 @@
  * 2 -> 1 - use rotate_xy\n
  * 1 -> 3 - use neg_rotate_xy\n
  * There are no need for other conversions, though rotate_yx is included for 3 -> 1
- * just in case.
+ * just in case.\n
+ * 
+ * Every operation returns by value, so none of them touch the heap.
  */
 class vector3f
 {
@@ -59,14 +71,13 @@ class vector3f
 		float x, y, z;
 		
 		/// Default constructor
-		vector3f();
+		ECHO_CONSTEXPR vector3f() : x(0), y(0), z(0) {}
 		/** Sets elements as specified
-		 * @param myX The new vector's x-coordinate
-		 * @param myY The new vector's y-coordinate
-		 * @param myZ The new vector's z-coordinate
+		 * @param my_x The new vector's x-coordinate
+		 * @param my_y The new vector's y-coordinate
+		 * @param my_z The new vector's z-coordinate
 		 */
-		vector3f(float my_x, float my_y, float my_z);
-		~vector3f(){}
+		ECHO_CONSTEXPR vector3f(float my_x, float my_y, float my_z) : x(my_x), y(my_y), z(my_z) {}
 		/** Sets the vector to exactly the same as the vector given.
 		 * @param copy_from The vector to copy from.
 		 */
@@ -93,66 +104,187 @@ class vector3f
 		 * vector is used as a point or direction.
 		 * @return The length of this vector
 		 */
-		float		length();
+		float		length() const;
 		/** Returns the angle this vector has with up as a single scalar in degrees
 		 * @return Angle this vector has with up; note that this is on an interval of [0, 180]
 		 */
-		float		scalar_angle_with_up();
+		float		scalar_angle_with_up() const;
 		
-		/** Gets a new vector representing the angle between this vector and <0, 0, 1>
+		/** Gets the angle between this vector and <0, 0, 1>
 		 * @return Vector with the x and y rotation angles needed to rotate this vector to the positive z-axis.
 		 */
-		vector3f*	angle_xy();
-		/** Rotates from Absolute Position to World Position
+		vector3f	angle_xy() const;
+		/** Rotates from Absolute Position to World Position.
+		 * This builds a camera_basis every call; per-frame code should use echo_ns::get_basis instead.
 		 * @param rot Current camera angle
-		 * @return New vector containing a World Position if this vector is an Absolute Position
+		 * @return A World Position if this vector is an Absolute Position
 		 */
-		vector3f* 	rotate_xy(vector3f rot);
+		vector3f 	rotate_xy(vector3f rot) const;
 		/** Rotates from World Position to Screen Position
 		 * @param rot Current camera angle
-		 * @return New vector containing a Screen Position if this vector is a World Position
+		 * @return A Screen Position if this vector is a World Position
 		 */
-		vector3f* 	neg_rotate_xy(vector3f rot);
+		vector3f 	neg_rotate_xy(vector3f rot) const;
 		/** Rotates from World Position to Absolute Position
 		 * @param rot Current camera angle
-		 * @return New vector containing an Absolute Position if this vector is a World Position
+		 * @return An Absolute Position if this vector is a World Position
 		 */
-		vector3f*	neg_rotate_yx(vector3f rot);
+		vector3f	neg_rotate_yx(vector3f rot) const;
 		/** Rotates from Screen Position to World Position
 		 * @param rot Current camera angle
-		 * @return New vector containing a World Position if this vector is a Screen Position
+		 * @return A World Position if this vector is a Screen Position
 		 */
-		vector3f*	rotate_yx(vector3f rot);
+		vector3f	rotate_yx(vector3f rot) const;
 		
-		/** Gets a new vector that is opposite to this vector.
-		 * @return A new vector that is opposite to this vector
+		/** Gets the vector that is opposite to this vector.
+		 * @return The vector that is opposite to this vector
 		 */
-		vector3f*	negate();
+		ECHO_CONSTEXPR vector3f	negate() const
+		{
+			return(vector3f(-x, -y, -z));
+		}
 		/** Gets the distance between this point vector and the other point vector given.
 		 * @param other The other point.
 		 * @return The distance between the two points.
 		 */
-		float		dist(vector3f* other);
+		float		dist(const vector3f& other) const;
+		/// Pointer version of dist, for callers that hold grid positions
+		float		dist(const vector3f* other) const
+		{
+			return(dist(*other));
+		}
 		/** Gets the distance between this point vector and <0, 1, 0>.
 		 * Used to accelerate IK calculations
 		 * @return Distance between this point and <0, 1, 0>
 		 */
-		float		dist_with_up();
-		/** Gets a new vector that is this vector times the scalar given.
+		float		dist_with_up() const;
+		/** Gets the vector that is this vector times the scalar given.
 		 * @param f Factor to multiply each element by.
 		 * @return This vector times the scalar given.
 		 */
-		vector3f*	operator *(float f);
+		ECHO_CONSTEXPR vector3f	operator *(float f) const
+		{
+			return(vector3f(x * f, y * f, z * f));
+		}
 		/** Gets the resultant vector from this vector and the one given.
 		 * @param vec The other vector to add to to form the resultant vector.
 		 * @return The resultant vector.
 		 */
-		vector3f*	operator +(vector3f* vec);
+		ECHO_CONSTEXPR vector3f	operator +(const vector3f& vec) const
+		{
+			return(vector3f(x + vec.x, y + vec.y, z + vec.z));
+		}
 		/** Gets the resultant vector from the subtraction of the vector given from this vector.
 		 * @param vec The other vector to subtract this vector to form the resultant vector.
 		 * @return The resultant vector.
 		 */
-		vector3f*	operator -(vector3f* vec);
+		ECHO_CONSTEXPR vector3f	operator -(const vector3f& vec) const
+		{
+			return(vector3f(x - vec.x, y - vec.y, z - vec.z));
+		}
+};
+#endif
+
+#ifndef __ECHO_CAMERA_BASIS__
+#define __ECHO_CAMERA_BASIS__
+/** @brief The rotations of one camera angle, precomputed.
+ * 
+ * The conversions between Absolute, World and Screen Positions (see vector3f)
+ * all depend on the sines and cosines of the camera angle only, so the basis
+ * stores them as two 3x3 matrices, Absolute -> World and World -> Screen,
+ * along with their inverses.  The inverses are built from the lookup table
+ * the same way the forward matrices are (rather than transposed), so a
+ * round trip gives the same result the old per-call trig did.\n
+ * Build it once per angle (echo_ns::get_basis does this), then every
+ * conversion is 9 multiplies with no trig.
+ */
+class camera_basis
+{
+	public:
+		/// The camera angle this basis was built for
+		vector3f angle;
+		
+		/// Builds the basis for no rotation
+		camera_basis();
+		/** Builds the basis for the given angle
+		 * @param my_angle The camera angle
+		 */
+		camera_basis(vector3f my_angle);
+		/** Rebuilds the basis for the given angle
+		 * @param my_angle The new camera angle
+		 */
+		void		set(vector3f my_angle);
+		/** Is this basis built for the given angle?
+		 * @param other_angle The angle to check
+		 * @return If the basis can be used for other_angle without rebuilding
+		 */
+		int			is_for(vector3f other_angle) const
+		{
+			return(angle.x == other_angle.x && angle.y == other_angle.y);
+		}
+		
+		/** Rotates from Absolute Position to World Position
+		 * @param v An Absolute Position
+		 * @return The World Position
+		 */
+		vector3f	rotate_xy(const vector3f& v) const
+		{
+			return(identity ? v : mul(world, v));
+		}
+		/** Rotates from World Position to Absolute Position
+		 * @param v A World Position
+		 * @return The Absolute Position
+		 */
+		vector3f	neg_rotate_yx(const vector3f& v) const
+		{
+			return(identity ? v : mul(world_inv, v));
+		}
+		/** Rotates from World Position to Screen Position
+		 * @param v A World Position
+		 * @return The Screen Position
+		 */
+		vector3f	neg_rotate_xy(const vector3f& v) const
+		{
+			return(identity ? v : mul(screen, v));
+		}
+		/** Rotates from Screen Position to World Position
+		 * @param v A Screen Position
+		 * @return The World Position
+		 */
+		vector3f	rotate_yx(const vector3f& v) const
+		{
+			return(identity ? v : mul(screen_inv, v));
+		}
+		/** Rotates a batch of World Positions to Screen Positions, keeping only
+		 * x and y.  Uses SSE where it's available.
+		 * @param x World x-coordinates
+		 * @param y World y-coordinates
+		 * @param z World z-coordinates
+		 * @param out_x Where to store the Screen x-coordinates
+		 * @param out_y Where to store the Screen y-coordinates
+		 * @param n Number of points
+		 */
+		void		neg_rotate_xy(const float* x, const float* y, const float* z
+						, float* out_x, float* out_y, int n) const;
+	protected:
+		/// Is the angle zero?  Then all the conversions are exact copies, like before.
+		int identity;
+		/// Absolute -> World, row-major
+		float world[9];
+		/// World -> Absolute, row-major
+		float world_inv[9];
+		/// World -> Screen, row-major
+		float screen[9];
+		/// Screen -> World, row-major
+		float screen_inv[9];
+		
+		/// m * v
+		static vector3f mul(const float* m, const vector3f& v)
+		{
+			return(vector3f(m[0] * v.x + m[1] * v.y + m[2] * v.z
+					, m[3] * v.x + m[4] * v.y + m[5] * v.z
+					, m[6] * v.x + m[7] * v.y + m[8] * v.z));
+		}
 };
 #endif
 
@@ -200,6 +332,33 @@ float IK_angle(float length1, float length2, float distance);
  * @return If line segments A and B intersect.
  */
 int lineSeg_intersect(vector3f* a1, vector3f* a2, vector3f* b1, vector3f* b2);
+/** Same as lineSeg_intersect, but B is given as loose coordinates (like the
+ * stage's projected corner arrays).
+ * @param a1 One of the points of line segment A
+ * @param a2 One of the points of line segment A
+ * @param b1x X-coordinate of one of the points of line segment B
+ * @param b1y Y-coordinate of one of the points of line segment B
+ * @param b2x X-coordinate of one of the points of line segment B
+ * @param b2y Y-coordinate of one of the points of line segment B
+ * @return If line segments A and B intersect.
+ */
+int lineSeg_intersect(const vector3f* a1, const vector3f* a2, float b1x, float b1y, float b2x, float b2y);
+/** Tests line segment A against many line segments at once; gives exactly the
+ * same answers as calling lineSeg_intersect on each.  The B segments are packed
+ * as separate coordinate arrays.  Uses SSE where it's available.
+ * @param a1 One of the points of line segment A
+ * @param a2 One of the points of line segment A
+ * @param b1x X-coordinates of the first points of the B segments
+ * @param b1y Y-coordinates of the first points of the B segments
+ * @param b2x X-coordinates of the second points of the B segments
+ * @param b2y Y-coordinates of the second points of the B segments
+ * @param hits Where to store the results; hits[i] is 1 if A intersects B segment i, 0 otherwise
+ * @param n Number of B segments
+ * @return The number of B segments A intersects
+ */
+int lineSeg_intersect_batch(const vector3f* a1, const vector3f* a2
+		, const float* b1x, const float* b1y, const float* b2x, const float* b2y
+		, unsigned char* hits, int n);
 
 float echo_sin(int deg);
 float echo_cos(int deg);
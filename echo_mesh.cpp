@@ -0,0 +1,210 @@
+// echo_mesh.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cmath>
+
+#include "echo_platform.h"
+
+#ifndef ECHO_NDS
+
+#include "echo_debug.h"
+#include "echo_glext.h"
+#include "echo_math.h"
+#include "echo_mesh.h"
+
+#ifdef ECHO_OSX	//OS X
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// Every generated mesh, NULL-terminated; their coarser levels of detail hang off them
+static echo_mesh* meshes[] = 
+{
+	&head_mesh, &body_mesh, &lower_body_mesh, &limb_mesh
+	, &left_hand_mesh, &right_hand_mesh, &foot_mesh, &stairs_mesh
+	, &sphere_point1_mesh, &sphere_pointzero75_mesh, NULL
+};
+
+/// How meshes are drawn
+static int path = MESH_PATH_BUFFER;
+/// Pixels per unit on the screen; 0 if unknown
+static float pixel_scale = 0;
+
+int mesh_set_path(int new_path)
+{
+	const int prev = path;
+	if(new_path >= 0 && new_path < MESH_NUM_PATHS)
+		path = new_path;
+	return(prev);
+}
+
+int mesh_get_path()
+{
+	return(path);
+}
+
+const char* mesh_path_name(int which)
+{
+	switch(which)
+	{
+		case MESH_PATH_IMMEDIATE:
+			return("immediate");
+		case MESH_PATH_LIST:
+			return("list");
+		case MESH_PATH_BUFFER:
+			return("buffer");
+	}
+	return("?");
+}
+
+float mesh_set_pixel_scale(float pixels_per_unit)
+{
+	const float prev = pixel_scale;
+	pixel_scale = pixels_per_unit;
+	return(prev);
+}
+
+echo_mesh* mesh_lod(echo_mesh* mesh)
+{
+	if(pixel_scale <= 0)
+		return(mesh);
+	while(mesh->coarser)
+	{
+		//a quad spans PI / lats of the turn; its middle is this far inside the surface
+		const echo_mesh* next = mesh->coarser;
+		if(next->radius * pixel_scale * (1 - cos(PI / (2 * next->lats))) > MESH_LOD_ERROR)
+			break;
+		mesh = mesh->coarser;
+	}
+	return(mesh);
+}
+
+/// Sends the triangles one vertex at a time
+static void draw_immediate(const echo_mesh* mesh)
+{
+	glBegin(GL_TRIANGLES);
+	int each = 0;
+	while(each < mesh->num_indices)
+	{
+		glVertex3fv(mesh->vertices + 3 * mesh->indices[each]);
+		each++;
+	}
+	glEnd();
+}
+
+void mesh_init()
+{
+	echo_glext_init();
+	if(!echo_glext_has_vbo())
+	{
+		ECHO_PRINT("no vertex buffers; meshes will be drawn from client memory\n");
+		return;
+	}
+	int each = 0, count = 0, bytes = 0;
+	while(meshes[each])
+	{
+		echo_mesh* mesh = meshes[each];
+		while(mesh)
+		{
+			if(!mesh->buffers[0])
+			{
+				echo_glGenBuffers(2, mesh->buffers);
+				echo_glBindBuffer(GL_ARRAY_BUFFER, mesh->buffers[0]);
+				echo_glBufferData(GL_ARRAY_BUFFER, mesh->num_vertices * 3 * sizeof(float)
+					, mesh->vertices, GL_STATIC_DRAW);
+				echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->buffers[1]);
+				echo_glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->num_indices * sizeof(unsigned short)
+					, mesh->indices, GL_STATIC_DRAW);
+				bytes += mesh->num_vertices * 3 * sizeof(float) + mesh->num_indices * sizeof(unsigned short);
+			}
+			mesh = mesh->coarser;
+			count++;
+		}
+		each++;
+	}
+	echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+	echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	ECHO_PRINT("uploaded %i meshes (%i bytes)\n", count, bytes);
+}
+
+void mesh_free()
+{
+	int each = 0;
+	while(meshes[each])
+	{
+		echo_mesh* mesh = meshes[each];
+		while(mesh)
+		{
+			if(mesh->buffers[0])
+			{
+				echo_glDeleteBuffers(2, mesh->buffers);
+				mesh->buffers[0] = mesh->buffers[1] = 0;
+			}
+			if(mesh->list)
+			{
+				glDeleteLists(mesh->list, 1);
+				mesh->list = 0;
+			}
+			mesh = mesh->coarser;
+		}
+		each++;
+	}
+}
+
+void mesh_draw(echo_mesh* mesh)
+{
+	mesh = mesh_lod(mesh);
+	if(path == MESH_PATH_IMMEDIATE)
+	{
+		draw_immediate(mesh);
+		return;
+	}
+	if(path == MESH_PATH_LIST)
+	{
+		if(!mesh->list)
+		{
+			mesh->list = glGenLists(1);
+			glNewList(mesh->list, GL_COMPILE);
+			draw_immediate(mesh);
+			glEndList();
+		}
+		glCallList(mesh->list);
+		return;
+	}
+	glEnableClientState(GL_VERTEX_ARRAY);
+	if(mesh->buffers[0])
+	{
+		echo_glBindBuffer(GL_ARRAY_BUFFER, mesh->buffers[0]);
+		echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->buffers[1]);
+		glVertexPointer(3, GL_FLOAT, 0, 0);
+		glDrawElements(GL_TRIANGLES, mesh->num_indices, GL_UNSIGNED_SHORT, 0);
+		echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+		echo_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	}
+	else
+	{
+		glVertexPointer(3, GL_FLOAT, 0, mesh->vertices);
+		glDrawElements(GL_TRIANGLES, mesh->num_indices, GL_UNSIGNED_SHORT, mesh->indices);
+	}
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+
+#endif
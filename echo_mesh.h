@@ -0,0 +1,117 @@
+// echo_mesh.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+
+#ifndef __ECHO_MESH__
+#define __ECHO_MESH__
+
+#ifndef ECHO_NDS
+/** @brief A static triangle mesh generated by gen/gen_*.c
+ * 
+ * The vertices and indices are compiled into the model files; mesh_init
+ * uploads them into buffer objects once, then drawing a part is a single
+ * glDrawElements instead of hundreds of glVertex3f calls.
+ */
+typedef struct echo_mesh
+{
+	/// x, y, z of each vertex
+	const float* vertices;
+	/// Number of vertices (not floats)
+	int num_vertices;
+	/// Triangle list
+	const unsigned short* indices;
+	/// Number of indices
+	int num_indices;
+	/// Vertex and index buffer objects; 0 if not uploaded
+	unsigned int buffers[2];
+	/// Display list, compiled the first time it is drawn with MESH_PATH_LIST; 0 until then
+	unsigned int list;
+	/// Largest radius of its curved surface, and quads per half turn around it (0 if it has no levels of detail)
+	float radius;
+	int lats;
+	/// The next coarser level of detail; NULL if there is none
+	struct echo_mesh* coarser;
+} echo_mesh;
+
+/// Initializer for a mesh from the two static arrays
+#define ECHO_MESH(verts, inds)	{ verts, sizeof(verts) / (3 * sizeof(float)) \
+									, inds, sizeof(inds) / sizeof(unsigned short), {0, 0}, 0, 0, 0, NULL }
+/// Initializer for one level of detail of a part; coarser points to the next one
+#define ECHO_LOD_MESH(verts, inds, radius, lats, coarser)	{ verts, sizeof(verts) / (3 * sizeof(float)) \
+									, inds, sizeof(inds) / sizeof(unsigned short), {0, 0}, 0 \
+									, radius, lats, coarser }
+
+/// The meshes in the generated echo_model_*.cpp files
+extern echo_mesh head_mesh, body_mesh, lower_body_mesh, limb_mesh
+	, left_hand_mesh, right_hand_mesh, foot_mesh, stairs_mesh
+	, sphere_point1_mesh, sphere_pointzero75_mesh;
+
+/// How meshes are sent to the GL (see mesh_set_path)
+/// glBegin/glVertex for every vertex, every frame
+#define MESH_PATH_IMMEDIATE		0
+/// Display lists, compiled the first time a mesh is drawn
+#define MESH_PATH_LIST			1
+/// Buffer objects (or vertex arrays if there are none); the default
+#define MESH_PATH_BUFFER		2
+/// Number of paths
+#define MESH_NUM_PATHS			3
+
+/** Changes how meshes (and the stage mesh) are drawn; the older paths are
+ * kept so the -o benchmark can compare them
+ * @param path One of the MESH_PATH_ constants
+ * @return The previous path
+ */
+int mesh_set_path(int path);
+/// How meshes are drawn now
+int mesh_get_path();
+/// The name of the path, for printing
+const char* mesh_path_name(int path);
+
+/// How far (in pixels) a level of detail may stray from the curved surface before it is too coarse
+#define MESH_LOD_ERROR			0.5f
+
+/** Sets how big a unit is on the screen, so mesh_draw can pick the levels of
+ * detail; the projection is orthographic, so it is the same everywhere
+ * (the window's height over the height of the projection)
+ * @param pixels_per_unit 0 to always draw the full meshes
+ * @return The previous scale
+ */
+float mesh_set_pixel_scale(float pixels_per_unit);
+/** The coarsest level of detail of the mesh that stays within MESH_LOD_ERROR
+ * pixels of its surface at the current scale
+ * @param mesh The full mesh
+ * @return mesh or one of its coarser levels
+ */
+echo_mesh* mesh_lod(echo_mesh* mesh);
+
+/// Uploads every generated mesh into buffer objects (if the GL has them); needs a context
+void mesh_init();
+/// Deletes the buffer objects mesh_init made, and any display lists
+void mesh_free();
+/** Draws the mesh (at the level of detail mesh_lod picks) in a single call;
+ * from the buffer objects if they were uploaded, otherwise from the static
+ * arrays (or as the path says)
+ * @param mesh The mesh to draw
+ */
+void mesh_draw(echo_mesh* mesh);
+#endif
+
+#endif
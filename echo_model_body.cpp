@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -34,139 +35,202 @@
 
 
 //stats: LATS: 6, ANGLE_INCR: 0.523599, NDS_LATS: 2, NDS_ANGLE_INCR: 1.570796
+#ifndef ECHO_NDS
+static const float body_vertices[] = {
+	0.118f, 0.324f, 0.000f,
+	0.102f, 0.324f, 0.044f,
+	0.183f, 0.163f, 0.000f,
+	0.158f, 0.163f, 0.069f,
+	0.199f, -0.042f, 0.000f,
+	0.172f, -0.042f, 0.075f,
+	0.162f, -0.235f, 0.000f,
+	0.140f, -0.235f, 0.061f,
+	0.102f, 0.324f, 0.044f,
+	0.059f, 0.324f, 0.076f,
+	0.158f, 0.163f, 0.069f,
+	0.091f, 0.163f, 0.119f,
+	0.172f, -0.042f, 0.075f,
+	0.099f, -0.042f, 0.129f,
+	0.140f, -0.235f, 0.061f,
+	0.081f, -0.235f, 0.105f,
+	0.059f, 0.324f, 0.076f,
+	0.000f, 0.324f, 0.088f,
+	0.091f, 0.163f, 0.119f,
+	0.000f, 0.163f, 0.137f,
+	0.099f, -0.042f, 0.129f,
+	0.000f, -0.042f, 0.149f,
+	0.081f, -0.235f, 0.105f,
+	0.000f, -0.235f, 0.121f,
+	0.000f, 0.324f, 0.088f,
+	-0.059f, 0.324f, 0.076f,
+	0.000f, 0.163f, 0.137f,
+	-0.091f, 0.163f, 0.119f,
+	0.000f, -0.042f, 0.149f,
+	-0.099f, -0.042f, 0.129f,
+	0.000f, -0.235f, 0.121f,
+	-0.081f, -0.235f, 0.105f,
+	-0.059f, 0.324f, 0.076f,
+	-0.102f, 0.324f, 0.044f,
+	-0.091f, 0.163f, 0.119f,
+	-0.158f, 0.163f, 0.069f,
+	-0.099f, -0.042f, 0.129f,
+	-0.172f, -0.042f, 0.075f,
+	-0.081f, -0.235f, 0.105f,
+	-0.140f, -0.235f, 0.061f,
+	-0.102f, 0.324f, 0.044f,
+	-0.118f, 0.324f, 0.000f,
+	-0.158f, 0.163f, 0.069f,
+	-0.183f, 0.163f, 0.000f,
+	-0.172f, -0.042f, 0.075f,
+	-0.199f, -0.042f, 0.000f,
+	-0.140f, -0.235f, 0.061f,
+	-0.162f, -0.235f, 0.000f,
+	-0.118f, 0.324f, 0.000f,
+	-0.102f, 0.324f, -0.044f,
+	-0.183f, 0.163f, 0.000f,
+	-0.158f, 0.163f, -0.069f,
+	-0.199f, -0.042f, 0.000f,
+	-0.172f, -0.042f, -0.075f,
+	-0.162f, -0.235f, 0.000f,
+	-0.140f, -0.235f, -0.061f,
+	-0.102f, 0.324f, -0.044f,
+	-0.059f, 0.324f, -0.076f,
+	-0.158f, 0.163f, -0.069f,
+	-0.091f, 0.163f, -0.119f,
+	-0.172f, -0.042f, -0.075f,
+	-0.099f, -0.042f, -0.129f,
+	-0.140f, -0.235f, -0.061f,
+	-0.081f, -0.235f, -0.105f,
+	-0.059f, 0.324f, -0.076f,
+	-0.000f, 0.324f, -0.088f,
+	-0.091f, 0.163f, -0.119f,
+	-0.000f, 0.163f, -0.137f,
+	-0.099f, -0.042f, -0.129f,
+	-0.000f, -0.042f, -0.149f,
+	-0.081f, -0.235f, -0.105f,
+	-0.000f, -0.235f, -0.121f,
+	-0.000f, 0.324f, -0.088f,
+	0.059f, 0.324f, -0.076f,
+	-0.000f, 0.163f, -0.137f,
+	0.091f, 0.163f, -0.119f,
+	-0.000f, -0.042f, -0.149f,
+	0.099f, -0.042f, -0.129f,
+	-0.000f, -0.235f, -0.121f,
+	0.081f, -0.235f, -0.105f,
+	0.059f, 0.324f, -0.076f,
+	0.102f, 0.324f, -0.044f,
+	0.091f, 0.163f, -0.119f,
+	0.158f, 0.163f, -0.069f,
+	0.099f, -0.042f, -0.129f,
+	0.172f, -0.042f, -0.075f,
+	0.081f, -0.235f, -0.105f,
+	0.140f, -0.235f, -0.061f,
+	0.102f, 0.324f, -0.044f,
+	0.118f, 0.324f, -0.000f,
+	0.158f, 0.163f, -0.069f,
+	0.183f, 0.163f, -0.000f,
+	0.172f, -0.042f, -0.075f,
+	0.199f, -0.042f, -0.000f,
+	0.140f, -0.235f, -0.061f,
+	0.162f, -0.235f, -0.000f,
+	0.118f, 0.324f, -0.000f,
+	0.102f, 0.324f, 0.044f,
+	0.183f, 0.163f, -0.000f,
+	0.158f, 0.163f, 0.069f,
+	0.199f, -0.042f, -0.000f,
+	0.172f, -0.042f, 0.075f,
+	0.162f, -0.235f, -0.000f,
+	0.140f, -0.235f, 0.061f,
+};
+
+static const unsigned short body_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	8, 9, 11,
+	8, 11, 10,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	16, 17, 19,
+	16, 19, 18,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	28, 29, 31,
+	28, 31, 30,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	40, 41, 43,
+	40, 43, 42,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	48, 49, 51,
+	48, 51, 50,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+	56, 57, 59,
+	56, 59, 58,
+	58, 59, 61,
+	58, 61, 60,
+	60, 61, 63,
+	60, 63, 62,
+	64, 65, 67,
+	64, 67, 66,
+	66, 67, 69,
+	66, 69, 68,
+	68, 69, 71,
+	68, 71, 70,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+	76, 77, 79,
+	76, 79, 78,
+	80, 81, 83,
+	80, 83, 82,
+	82, 83, 85,
+	82, 85, 84,
+	84, 85, 87,
+	84, 87, 86,
+	88, 89, 91,
+	88, 91, 90,
+	90, 91, 93,
+	90, 93, 92,
+	92, 93, 95,
+	92, 95, 94,
+	96, 97, 99,
+	96, 99, 98,
+	98, 99, 101,
+	98, 101, 100,
+	100, 101, 103,
+	100, 103, 102,
+};
+
+echo_mesh body_mesh = ECHO_MESH(body_vertices, body_indices);
+#endif
+
 void draw_body()
 {
 #ifndef ECHO_NDS
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.118f, 0.324f, 0.000f);
-		glVertex3f(0.102f, 0.324f, 0.044f);
-		glVertex3f(0.183f, 0.163f, 0.000f);
-		glVertex3f(0.158f, 0.163f, 0.069f);
-		glVertex3f(0.199f, -0.042f, 0.000f);
-		glVertex3f(0.172f, -0.042f, 0.075f);
-		glVertex3f(0.162f, -0.235f, 0.000f);
-		glVertex3f(0.140f, -0.235f, 0.061f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.102f, 0.324f, 0.044f);
-		glVertex3f(0.059f, 0.324f, 0.076f);
-		glVertex3f(0.158f, 0.163f, 0.069f);
-		glVertex3f(0.091f, 0.163f, 0.119f);
-		glVertex3f(0.172f, -0.042f, 0.075f);
-		glVertex3f(0.099f, -0.042f, 0.129f);
-		glVertex3f(0.140f, -0.235f, 0.061f);
-		glVertex3f(0.081f, -0.235f, 0.105f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.059f, 0.324f, 0.076f);
-		glVertex3f(0.000f, 0.324f, 0.088f);
-		glVertex3f(0.091f, 0.163f, 0.119f);
-		glVertex3f(0.000f, 0.163f, 0.137f);
-		glVertex3f(0.099f, -0.042f, 0.129f);
-		glVertex3f(0.000f, -0.042f, 0.149f);
-		glVertex3f(0.081f, -0.235f, 0.105f);
-		glVertex3f(0.000f, -0.235f, 0.121f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, 0.324f, 0.088f);
-		glVertex3f(-0.059f, 0.324f, 0.076f);
-		glVertex3f(0.000f, 0.163f, 0.137f);
-		glVertex3f(-0.091f, 0.163f, 0.119f);
-		glVertex3f(0.000f, -0.042f, 0.149f);
-		glVertex3f(-0.099f, -0.042f, 0.129f);
-		glVertex3f(0.000f, -0.235f, 0.121f);
-		glVertex3f(-0.081f, -0.235f, 0.105f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.059f, 0.324f, 0.076f);
-		glVertex3f(-0.102f, 0.324f, 0.044f);
-		glVertex3f(-0.091f, 0.163f, 0.119f);
-		glVertex3f(-0.158f, 0.163f, 0.069f);
-		glVertex3f(-0.099f, -0.042f, 0.129f);
-		glVertex3f(-0.172f, -0.042f, 0.075f);
-		glVertex3f(-0.081f, -0.235f, 0.105f);
-		glVertex3f(-0.140f, -0.235f, 0.061f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.102f, 0.324f, 0.044f);
-		glVertex3f(-0.118f, 0.324f, 0.000f);
-		glVertex3f(-0.158f, 0.163f, 0.069f);
-		glVertex3f(-0.183f, 0.163f, 0.000f);
-		glVertex3f(-0.172f, -0.042f, 0.075f);
-		glVertex3f(-0.199f, -0.042f, 0.000f);
-		glVertex3f(-0.140f, -0.235f, 0.061f);
-		glVertex3f(-0.162f, -0.235f, 0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.118f, 0.324f, 0.000f);
-		glVertex3f(-0.102f, 0.324f, -0.044f);
-		glVertex3f(-0.183f, 0.163f, 0.000f);
-		glVertex3f(-0.158f, 0.163f, -0.069f);
-		glVertex3f(-0.199f, -0.042f, 0.000f);
-		glVertex3f(-0.172f, -0.042f, -0.075f);
-		glVertex3f(-0.162f, -0.235f, 0.000f);
-		glVertex3f(-0.140f, -0.235f, -0.061f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.102f, 0.324f, -0.044f);
-		glVertex3f(-0.059f, 0.324f, -0.076f);
-		glVertex3f(-0.158f, 0.163f, -0.069f);
-		glVertex3f(-0.091f, 0.163f, -0.119f);
-		glVertex3f(-0.172f, -0.042f, -0.075f);
-		glVertex3f(-0.099f, -0.042f, -0.129f);
-		glVertex3f(-0.140f, -0.235f, -0.061f);
-		glVertex3f(-0.081f, -0.235f, -0.105f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.059f, 0.324f, -0.076f);
-		glVertex3f(-0.000f, 0.324f, -0.088f);
-		glVertex3f(-0.091f, 0.163f, -0.119f);
-		glVertex3f(-0.000f, 0.163f, -0.137f);
-		glVertex3f(-0.099f, -0.042f, -0.129f);
-		glVertex3f(-0.000f, -0.042f, -0.149f);
-		glVertex3f(-0.081f, -0.235f, -0.105f);
-		glVertex3f(-0.000f, -0.235f, -0.121f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.324f, -0.088f);
-		glVertex3f(0.059f, 0.324f, -0.076f);
-		glVertex3f(-0.000f, 0.163f, -0.137f);
-		glVertex3f(0.091f, 0.163f, -0.119f);
-		glVertex3f(-0.000f, -0.042f, -0.149f);
-		glVertex3f(0.099f, -0.042f, -0.129f);
-		glVertex3f(-0.000f, -0.235f, -0.121f);
-		glVertex3f(0.081f, -0.235f, -0.105f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.059f, 0.324f, -0.076f);
-		glVertex3f(0.102f, 0.324f, -0.044f);
-		glVertex3f(0.091f, 0.163f, -0.119f);
-		glVertex3f(0.158f, 0.163f, -0.069f);
-		glVertex3f(0.099f, -0.042f, -0.129f);
-		glVertex3f(0.172f, -0.042f, -0.075f);
-		glVertex3f(0.081f, -0.235f, -0.105f);
-		glVertex3f(0.140f, -0.235f, -0.061f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.102f, 0.324f, -0.044f);
-		glVertex3f(0.118f, 0.324f, -0.000f);
-		glVertex3f(0.158f, 0.163f, -0.069f);
-		glVertex3f(0.183f, 0.163f, -0.000f);
-		glVertex3f(0.172f, -0.042f, -0.075f);
-		glVertex3f(0.199f, -0.042f, -0.000f);
-		glVertex3f(0.140f, -0.235f, -0.061f);
-		glVertex3f(0.162f, -0.235f, -0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.118f, 0.324f, -0.000f);
-		glVertex3f(0.102f, 0.324f, 0.044f);
-		glVertex3f(0.183f, 0.163f, -0.000f);
-		glVertex3f(0.158f, 0.163f, 0.069f);
-		glVertex3f(0.199f, -0.042f, -0.000f);
-		glVertex3f(0.172f, -0.042f, 0.075f);
-		glVertex3f(0.162f, -0.235f, -0.000f);
-		glVertex3f(0.140f, -0.235f, 0.061f);
-	glEnd();
+	mesh_draw(&body_mesh);
 #else
 	glBegin(GL_QUAD_STRIP);
 		glVertex3v16(-819, 963, 614);
@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -34,79 +35,206 @@
 
 
 //stats: LATS: 6, ANGLE_INCR: 0.523599, NDS_LATS: 2, NDS_ANGLE_INCR: 1.570796
+#ifndef ECHO_NDS
+static const float foot_lod2_vertices[] = {
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.075f, 0.000f, 0.000f,
+	-0.000f, 0.000f, 0.200f,
+	-0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	-0.000f, 0.000f, 0.200f,
+	0.075f, 0.000f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, -0.000f,
+	0.075f, 0.000f, 0.000f,
+	-0.000f, 0.000f, -0.200f,
+};
+
+static const unsigned short foot_lod2_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	4, 5, 7,
+	4, 7, 6,
+	8, 9, 11,
+	8, 11, 10,
+};
+
+static echo_mesh foot_lod2_mesh = ECHO_LOD_MESH(foot_lod2_vertices, foot_lod2_indices, 0.200f, 2, NULL);
+#endif
+
+#ifndef ECHO_NDS
+static const float foot_lod1_vertices[] = {
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.053f, 0.106f, 0.000f,
+	-0.038f, 0.106f, 0.100f,
+	-0.075f, 0.000f, 0.000f,
+	-0.053f, 0.000f, 0.141f,
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.038f, 0.106f, 0.100f,
+	-0.000f, 0.106f, 0.141f,
+	-0.053f, 0.000f, 0.141f,
+	-0.000f, 0.000f, 0.200f,
+	-0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	-0.000f, 0.106f, 0.141f,
+	0.037f, 0.106f, 0.100f,
+	-0.000f, 0.000f, 0.200f,
+	0.053f, 0.000f, 0.141f,
+	0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	0.037f, 0.106f, 0.100f,
+	0.053f, 0.106f, 0.000f,
+	0.053f, 0.000f, 0.141f,
+	0.075f, 0.000f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, -0.000f,
+	0.053f, 0.106f, 0.000f,
+	0.038f, 0.106f, -0.100f,
+	0.075f, 0.000f, 0.000f,
+	0.053f, 0.000f, -0.141f,
+};
+
+static const unsigned short foot_lod1_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+};
+
+static echo_mesh foot_lod1_mesh = ECHO_LOD_MESH(foot_lod1_vertices, foot_lod1_indices, 0.200f, 4, &foot_lod2_mesh);
+#endif
+
+#ifndef ECHO_NDS
+static const float foot_vertices[] = {
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.037f, 0.130f, 0.000f,
+	-0.032f, 0.130f, 0.050f,
+	-0.065f, 0.075f, 0.000f,
+	-0.056f, 0.075f, 0.087f,
+	-0.075f, 0.000f, 0.000f,
+	-0.065f, 0.000f, 0.100f,
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.032f, 0.130f, 0.050f,
+	-0.019f, 0.130f, 0.087f,
+	-0.056f, 0.075f, 0.087f,
+	-0.032f, 0.075f, 0.150f,
+	-0.065f, 0.000f, 0.100f,
+	-0.038f, 0.000f, 0.173f,
+	-0.000f, 0.150f, 0.000f,
+	-0.000f, 0.150f, 0.000f,
+	-0.019f, 0.130f, 0.087f,
+	-0.000f, 0.130f, 0.100f,
+	-0.032f, 0.075f, 0.150f,
+	-0.000f, 0.075f, 0.173f,
+	-0.038f, 0.000f, 0.173f,
+	-0.000f, 0.000f, 0.200f,
+	-0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	-0.000f, 0.130f, 0.100f,
+	0.019f, 0.130f, 0.087f,
+	-0.000f, 0.075f, 0.173f,
+	0.032f, 0.075f, 0.150f,
+	-0.000f, 0.000f, 0.200f,
+	0.037f, 0.000f, 0.173f,
+	0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	0.019f, 0.130f, 0.087f,
+	0.032f, 0.130f, 0.050f,
+	0.032f, 0.075f, 0.150f,
+	0.056f, 0.075f, 0.087f,
+	0.037f, 0.000f, 0.173f,
+	0.065f, 0.000f, 0.100f,
+	0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	0.032f, 0.130f, 0.050f,
+	0.037f, 0.130f, 0.000f,
+	0.056f, 0.075f, 0.087f,
+	0.065f, 0.075f, 0.000f,
+	0.065f, 0.000f, 0.100f,
+	0.075f, 0.000f, 0.000f,
+	0.000f, 0.150f, 0.000f,
+	0.000f, 0.150f, -0.000f,
+	0.037f, 0.130f, 0.000f,
+	0.032f, 0.130f, -0.050f,
+	0.065f, 0.075f, 0.000f,
+	0.056f, 0.075f, -0.087f,
+	0.075f, 0.000f, 0.000f,
+	0.065f, 0.000f, -0.100f,
+};
+
+static const unsigned short foot_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	8, 9, 11,
+	8, 11, 10,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	16, 17, 19,
+	16, 19, 18,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	28, 29, 31,
+	28, 31, 30,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	40, 41, 43,
+	40, 43, 42,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	48, 49, 51,
+	48, 51, 50,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+};
+
+echo_mesh foot_mesh = ECHO_LOD_MESH(foot_vertices, foot_indices, 0.200f, 6, &foot_lod1_mesh);
+#endif
+
 void draw_foot()
 {
 #ifndef ECHO_NDS
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.037f, 0.130f, 0.000f);
-		glVertex3f(-0.032f, 0.130f, 0.050f);
-		glVertex3f(-0.065f, 0.075f, 0.000f);
-		glVertex3f(-0.056f, 0.075f, 0.087f);
-		glVertex3f(-0.075f, 0.000f, 0.000f);
-		glVertex3f(-0.065f, 0.000f, 0.100f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.032f, 0.130f, 0.050f);
-		glVertex3f(-0.019f, 0.130f, 0.087f);
-		glVertex3f(-0.056f, 0.075f, 0.087f);
-		glVertex3f(-0.032f, 0.075f, 0.150f);
-		glVertex3f(-0.065f, 0.000f, 0.100f);
-		glVertex3f(-0.038f, 0.000f, 0.173f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.019f, 0.130f, 0.087f);
-		glVertex3f(-0.000f, 0.130f, 0.100f);
-		glVertex3f(-0.032f, 0.075f, 0.150f);
-		glVertex3f(-0.000f, 0.075f, 0.173f);
-		glVertex3f(-0.038f, 0.000f, 0.173f);
-		glVertex3f(-0.000f, 0.000f, 0.200f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.150f, 0.000f);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(-0.000f, 0.130f, 0.100f);
-		glVertex3f(0.019f, 0.130f, 0.087f);
-		glVertex3f(-0.000f, 0.075f, 0.173f);
-		glVertex3f(0.032f, 0.075f, 0.150f);
-		glVertex3f(-0.000f, 0.000f, 0.200f);
-		glVertex3f(0.037f, 0.000f, 0.173f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(0.019f, 0.130f, 0.087f);
-		glVertex3f(0.032f, 0.130f, 0.050f);
-		glVertex3f(0.032f, 0.075f, 0.150f);
-		glVertex3f(0.056f, 0.075f, 0.087f);
-		glVertex3f(0.037f, 0.000f, 0.173f);
-		glVertex3f(0.065f, 0.000f, 0.100f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(0.032f, 0.130f, 0.050f);
-		glVertex3f(0.037f, 0.130f, 0.000f);
-		glVertex3f(0.056f, 0.075f, 0.087f);
-		glVertex3f(0.065f, 0.075f, 0.000f);
-		glVertex3f(0.065f, 0.000f, 0.100f);
-		glVertex3f(0.075f, 0.000f, 0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, 0.150f, 0.000f);
-		glVertex3f(0.000f, 0.150f, -0.000f);
-		glVertex3f(0.037f, 0.130f, 0.000f);
-		glVertex3f(0.032f, 0.130f, -0.050f);
-		glVertex3f(0.065f, 0.075f, 0.000f);
-		glVertex3f(0.056f, 0.075f, -0.087f);
-		glVertex3f(0.075f, 0.000f, 0.000f);
-		glVertex3f(0.065f, 0.000f, -0.100f);
-	glEnd();
+	mesh_draw(&foot_mesh);
 #else
 	glBegin(GL_QUAD_STRIP);
 		glVertex3v16(-307, 0, 0);
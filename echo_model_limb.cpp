@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -34,1101 +35,2338 @@
 
 
 //stats: LATS: 6, ANGLE_INCR: 0.523599, NDS_LATS: 2, NDS_ANGLE_INCR: 1.570796
+#ifndef ECHO_NDS
+static const float limb_lod2_vertices[] = {
+	0.075f, -0.000f, 0.000f,
+	0.000f, -0.000f, 0.075f,
+	0.069f, -0.400f, 0.000f,
+	0.000f, -0.400f, 0.069f,
+	0.000f, -0.000f, 0.075f,
+	-0.075f, -0.000f, 0.000f,
+	0.000f, -0.400f, 0.069f,
+	-0.069f, -0.400f, 0.000f,
+	-0.075f, -0.000f, 0.000f,
+	0.000f, -0.000f, -0.075f,
+	-0.069f, -0.400f, 0.000f,
+	0.000f, -0.400f, -0.069f,
+	0.000f, -0.000f, -0.075f,
+	0.075f, -0.000f, -0.000f,
+	0.000f, -0.400f, -0.069f,
+	0.069f, -0.400f, -0.000f,
+	0.075f, -0.000f, -0.000f,
+	0.000f, -0.000f, 0.075f,
+	0.069f, -0.400f, -0.000f,
+	0.000f, -0.400f, 0.069f,
+};
+
+static const unsigned short limb_lod2_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	4, 5, 7,
+	4, 7, 6,
+	8, 9, 11,
+	8, 11, 10,
+	12, 13, 15,
+	12, 15, 14,
+	16, 17, 19,
+	16, 19, 18,
+};
+
+static echo_mesh limb_lod2_mesh = ECHO_LOD_MESH(limb_lod2_vertices, limb_lod2_indices, 0.075f, 2, NULL);
+#endif
+
+#ifndef ECHO_NDS
+static const float limb_lod1_vertices[] = {
+	0.075f, -0.000f, 0.000f,
+	0.053f, -0.000f, 0.053f,
+	0.074f, -0.100f, 0.000f,
+	0.052f, -0.100f, 0.052f,
+	0.072f, -0.200f, 0.000f,
+	0.051f, -0.200f, 0.051f,
+	0.071f, -0.300f, 0.000f,
+	0.050f, -0.300f, 0.050f,
+	0.069f, -0.400f, 0.000f,
+	0.049f, -0.400f, 0.049f,
+	0.053f, -0.000f, 0.053f,
+	0.000f, -0.000f, 0.075f,
+	0.052f, -0.100f, 0.052f,
+	0.000f, -0.100f, 0.074f,
+	0.051f, -0.200f, 0.051f,
+	0.000f, -0.200f, 0.072f,
+	0.050f, -0.300f, 0.050f,
+	0.000f, -0.300f, 0.071f,
+	0.049f, -0.400f, 0.049f,
+	0.000f, -0.400f, 0.069f,
+	0.000f, -0.000f, 0.075f,
+	-0.053f, -0.000f, 0.053f,
+	0.000f, -0.100f, 0.074f,
+	-0.052f, -0.100f, 0.052f,
+	0.000f, -0.200f, 0.072f,
+	-0.051f, -0.200f, 0.051f,
+	0.000f, -0.300f, 0.071f,
+	-0.050f, -0.300f, 0.050f,
+	0.000f, -0.400f, 0.069f,
+	-0.049f, -0.400f, 0.049f,
+	-0.053f, -0.000f, 0.053f,
+	-0.075f, -0.000f, 0.000f,
+	-0.052f, -0.100f, 0.052f,
+	-0.074f, -0.100f, 0.000f,
+	-0.051f, -0.200f, 0.051f,
+	-0.072f, -0.200f, 0.000f,
+	-0.050f, -0.300f, 0.050f,
+	-0.071f, -0.300f, 0.000f,
+	-0.049f, -0.400f, 0.049f,
+	-0.069f, -0.400f, 0.000f,
+	-0.075f, -0.000f, 0.000f,
+	-0.053f, -0.000f, -0.053f,
+	-0.074f, -0.100f, 0.000f,
+	-0.052f, -0.100f, -0.052f,
+	-0.072f, -0.200f, 0.000f,
+	-0.051f, -0.200f, -0.051f,
+	-0.071f, -0.300f, 0.000f,
+	-0.050f, -0.300f, -0.050f,
+	-0.069f, -0.400f, 0.000f,
+	-0.049f, -0.400f, -0.049f,
+	-0.053f, -0.000f, -0.053f,
+	-0.000f, -0.000f, -0.075f,
+	-0.052f, -0.100f, -0.052f,
+	-0.000f, -0.100f, -0.074f,
+	-0.051f, -0.200f, -0.051f,
+	-0.000f, -0.200f, -0.072f,
+	-0.050f, -0.300f, -0.050f,
+	-0.000f, -0.300f, -0.071f,
+	-0.049f, -0.400f, -0.049f,
+	-0.000f, -0.400f, -0.069f,
+	-0.000f, -0.000f, -0.075f,
+	0.053f, -0.000f, -0.053f,
+	-0.000f, -0.100f, -0.074f,
+	0.052f, -0.100f, -0.052f,
+	-0.000f, -0.200f, -0.072f,
+	0.051f, -0.200f, -0.051f,
+	-0.000f, -0.300f, -0.071f,
+	0.050f, -0.300f, -0.050f,
+	-0.000f, -0.400f, -0.069f,
+	0.049f, -0.400f, -0.049f,
+	0.053f, -0.000f, -0.053f,
+	0.075f, -0.000f, -0.000f,
+	0.052f, -0.100f, -0.052f,
+	0.074f, -0.100f, -0.000f,
+	0.051f, -0.200f, -0.051f,
+	0.072f, -0.200f, -0.000f,
+	0.050f, -0.300f, -0.050f,
+	0.071f, -0.300f, -0.000f,
+	0.049f, -0.400f, -0.049f,
+	0.069f, -0.400f, -0.000f,
+	0.075f, -0.000f, -0.000f,
+	0.053f, -0.000f, 0.053f,
+	0.074f, -0.100f, -0.000f,
+	0.052f, -0.100f, 0.052f,
+	0.072f, -0.200f, -0.000f,
+	0.051f, -0.200f, 0.051f,
+	0.071f, -0.300f, -0.000f,
+	0.050f, -0.300f, 0.050f,
+	0.069f, -0.400f, -0.000f,
+	0.049f, -0.400f, 0.049f,
+};
+
+static const unsigned short limb_lod1_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	6, 7, 9,
+	6, 9, 8,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	16, 17, 19,
+	16, 19, 18,
+	20, 21, 23,
+	20, 23, 22,
+	22, 23, 25,
+	22, 25, 24,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	30, 31, 33,
+	30, 33, 32,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	40, 41, 43,
+	40, 43, 42,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	46, 47, 49,
+	46, 49, 48,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+	54, 55, 57,
+	54, 57, 56,
+	56, 57, 59,
+	56, 59, 58,
+	60, 61, 63,
+	60, 63, 62,
+	62, 63, 65,
+	62, 65, 64,
+	64, 65, 67,
+	64, 67, 66,
+	66, 67, 69,
+	66, 69, 68,
+	70, 71, 73,
+	70, 73, 72,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+	76, 77, 79,
+	76, 79, 78,
+	80, 81, 83,
+	80, 83, 82,
+	82, 83, 85,
+	82, 85, 84,
+	84, 85, 87,
+	84, 87, 86,
+	86, 87, 89,
+	86, 89, 88,
+};
+
+static echo_mesh limb_lod1_mesh = ECHO_LOD_MESH(limb_lod1_vertices, limb_lod1_indices, 0.075f, 4, &limb_lod2_mesh);
+#endif
+
+#ifndef ECHO_NDS
+static const float limb_vertices[] = {
+	0.075f, -0.000f, 0.000f,
+	0.065f, -0.000f, 0.037f,
+	0.075f, -0.010f, 0.000f,
+	0.065f, -0.010f, 0.037f,
+	0.075f, -0.020f, 0.000f,
+	0.065f, -0.020f, 0.037f,
+	0.075f, -0.030f, 0.000f,
+	0.065f, -0.030f, 0.037f,
+	0.074f, -0.040f, 0.000f,
+	0.064f, -0.040f, 0.037f,
+	0.074f, -0.050f, 0.000f,
+	0.064f, -0.050f, 0.037f,
+	0.074f, -0.060f, 0.000f,
+	0.064f, -0.060f, 0.037f,
+	0.074f, -0.070f, 0.000f,
+	0.064f, -0.070f, 0.037f,
+	0.074f, -0.080f, 0.000f,
+	0.064f, -0.080f, 0.037f,
+	0.074f, -0.090f, 0.000f,
+	0.064f, -0.090f, 0.037f,
+	0.074f, -0.100f, 0.000f,
+	0.064f, -0.100f, 0.037f,
+	0.073f, -0.110f, 0.000f,
+	0.064f, -0.110f, 0.037f,
+	0.073f, -0.120f, 0.000f,
+	0.063f, -0.120f, 0.037f,
+	0.073f, -0.130f, 0.000f,
+	0.063f, -0.130f, 0.037f,
+	0.073f, -0.140f, 0.000f,
+	0.063f, -0.140f, 0.036f,
+	0.073f, -0.150f, 0.000f,
+	0.063f, -0.150f, 0.036f,
+	0.073f, -0.160f, 0.000f,
+	0.063f, -0.160f, 0.036f,
+	0.072f, -0.170f, 0.000f,
+	0.063f, -0.170f, 0.036f,
+	0.072f, -0.180f, 0.000f,
+	0.063f, -0.180f, 0.036f,
+	0.072f, -0.190f, 0.000f,
+	0.062f, -0.190f, 0.036f,
+	0.072f, -0.200f, 0.000f,
+	0.062f, -0.200f, 0.036f,
+	0.072f, -0.210f, 0.000f,
+	0.062f, -0.210f, 0.036f,
+	0.072f, -0.220f, 0.000f,
+	0.062f, -0.220f, 0.036f,
+	0.072f, -0.230f, 0.000f,
+	0.062f, -0.230f, 0.036f,
+	0.071f, -0.240f, 0.000f,
+	0.062f, -0.240f, 0.036f,
+	0.071f, -0.250f, 0.000f,
+	0.062f, -0.250f, 0.036f,
+	0.071f, -0.260f, 0.000f,
+	0.062f, -0.260f, 0.036f,
+	0.071f, -0.270f, 0.000f,
+	0.061f, -0.270f, 0.035f,
+	0.071f, -0.280f, 0.000f,
+	0.061f, -0.280f, 0.035f,
+	0.071f, -0.290f, 0.000f,
+	0.061f, -0.290f, 0.035f,
+	0.071f, -0.300f, 0.000f,
+	0.061f, -0.300f, 0.035f,
+	0.070f, -0.310f, 0.000f,
+	0.061f, -0.310f, 0.035f,
+	0.070f, -0.320f, 0.000f,
+	0.061f, -0.320f, 0.035f,
+	0.070f, -0.330f, 0.000f,
+	0.061f, -0.330f, 0.035f,
+	0.070f, -0.340f, 0.000f,
+	0.061f, -0.340f, 0.035f,
+	0.070f, -0.350f, 0.000f,
+	0.060f, -0.350f, 0.035f,
+	0.070f, -0.360f, 0.000f,
+	0.060f, -0.360f, 0.035f,
+	0.069f, -0.370f, 0.000f,
+	0.060f, -0.370f, 0.035f,
+	0.069f, -0.380f, 0.000f,
+	0.060f, -0.380f, 0.035f,
+	0.069f, -0.390f, 0.000f,
+	0.060f, -0.390f, 0.035f,
+	0.069f, -0.400f, 0.000f,
+	0.060f, -0.400f, 0.034f,
+	0.065f, -0.000f, 0.037f,
+	0.038f, -0.000f, 0.065f,
+	0.065f, -0.010f, 0.037f,
+	0.037f, -0.010f, 0.065f,
+	0.065f, -0.020f, 0.037f,
+	0.037f, -0.020f, 0.065f,
+	0.065f, -0.030f, 0.037f,
+	0.037f, -0.030f, 0.065f,
+	0.064f, -0.040f, 0.037f,
+	0.037f, -0.040f, 0.064f,
+	0.064f, -0.050f, 0.037f,
+	0.037f, -0.050f, 0.064f,
+	0.064f, -0.060f, 0.037f,
+	0.037f, -0.060f, 0.064f,
+	0.064f, -0.070f, 0.037f,
+	0.037f, -0.070f, 0.064f,
+	0.064f, -0.080f, 0.037f,
+	0.037f, -0.080f, 0.064f,
+	0.064f, -0.090f, 0.037f,
+	0.037f, -0.090f, 0.064f,
+	0.064f, -0.100f, 0.037f,
+	0.037f, -0.100f, 0.064f,
+	0.064f, -0.110f, 0.037f,
+	0.037f, -0.110f, 0.064f,
+	0.063f, -0.120f, 0.037f,
+	0.037f, -0.120f, 0.063f,
+	0.063f, -0.130f, 0.037f,
+	0.037f, -0.130f, 0.063f,
+	0.063f, -0.140f, 0.036f,
+	0.036f, -0.140f, 0.063f,
+	0.063f, -0.150f, 0.036f,
+	0.036f, -0.150f, 0.063f,
+	0.063f, -0.160f, 0.036f,
+	0.036f, -0.160f, 0.063f,
+	0.063f, -0.170f, 0.036f,
+	0.036f, -0.170f, 0.063f,
+	0.063f, -0.180f, 0.036f,
+	0.036f, -0.180f, 0.063f,
+	0.062f, -0.190f, 0.036f,
+	0.036f, -0.190f, 0.062f,
+	0.062f, -0.200f, 0.036f,
+	0.036f, -0.200f, 0.062f,
+	0.062f, -0.210f, 0.036f,
+	0.036f, -0.210f, 0.062f,
+	0.062f, -0.220f, 0.036f,
+	0.036f, -0.220f, 0.062f,
+	0.062f, -0.230f, 0.036f,
+	0.036f, -0.230f, 0.062f,
+	0.062f, -0.240f, 0.036f,
+	0.036f, -0.240f, 0.062f,
+	0.062f, -0.250f, 0.036f,
+	0.036f, -0.250f, 0.062f,
+	0.062f, -0.260f, 0.036f,
+	0.036f, -0.260f, 0.062f,
+	0.061f, -0.270f, 0.035f,
+	0.035f, -0.270f, 0.061f,
+	0.061f, -0.280f, 0.035f,
+	0.035f, -0.280f, 0.061f,
+	0.061f, -0.290f, 0.035f,
+	0.035f, -0.290f, 0.061f,
+	0.061f, -0.300f, 0.035f,
+	0.035f, -0.300f, 0.061f,
+	0.061f, -0.310f, 0.035f,
+	0.035f, -0.310f, 0.061f,
+	0.061f, -0.320f, 0.035f,
+	0.035f, -0.320f, 0.061f,
+	0.061f, -0.330f, 0.035f,
+	0.035f, -0.330f, 0.061f,
+	0.061f, -0.340f, 0.035f,
+	0.035f, -0.340f, 0.061f,
+	0.060f, -0.350f, 0.035f,
+	0.035f, -0.350f, 0.060f,
+	0.060f, -0.360f, 0.035f,
+	0.035f, -0.360f, 0.060f,
+	0.060f, -0.370f, 0.035f,
+	0.035f, -0.370f, 0.060f,
+	0.060f, -0.380f, 0.035f,
+	0.035f, -0.380f, 0.060f,
+	0.060f, -0.390f, 0.035f,
+	0.035f, -0.390f, 0.060f,
+	0.060f, -0.400f, 0.034f,
+	0.035f, -0.400f, 0.060f,
+	0.038f, -0.000f, 0.065f,
+	0.000f, -0.000f, 0.075f,
+	0.037f, -0.010f, 0.065f,
+	0.000f, -0.010f, 0.075f,
+	0.037f, -0.020f, 0.065f,
+	0.000f, -0.020f, 0.075f,
+	0.037f, -0.030f, 0.065f,
+	0.000f, -0.030f, 0.075f,
+	0.037f, -0.040f, 0.064f,
+	0.000f, -0.040f, 0.074f,
+	0.037f, -0.050f, 0.064f,
+	0.000f, -0.050f, 0.074f,
+	0.037f, -0.060f, 0.064f,
+	0.000f, -0.060f, 0.074f,
+	0.037f, -0.070f, 0.064f,
+	0.000f, -0.070f, 0.074f,
+	0.037f, -0.080f, 0.064f,
+	0.000f, -0.080f, 0.074f,
+	0.037f, -0.090f, 0.064f,
+	0.000f, -0.090f, 0.074f,
+	0.037f, -0.100f, 0.064f,
+	0.000f, -0.100f, 0.074f,
+	0.037f, -0.110f, 0.064f,
+	0.000f, -0.110f, 0.073f,
+	0.037f, -0.120f, 0.063f,
+	0.000f, -0.120f, 0.073f,
+	0.037f, -0.130f, 0.063f,
+	0.000f, -0.130f, 0.073f,
+	0.036f, -0.140f, 0.063f,
+	0.000f, -0.140f, 0.073f,
+	0.036f, -0.150f, 0.063f,
+	0.000f, -0.150f, 0.073f,
+	0.036f, -0.160f, 0.063f,
+	0.000f, -0.160f, 0.073f,
+	0.036f, -0.170f, 0.063f,
+	0.000f, -0.170f, 0.072f,
+	0.036f, -0.180f, 0.063f,
+	0.000f, -0.180f, 0.072f,
+	0.036f, -0.190f, 0.062f,
+	0.000f, -0.190f, 0.072f,
+	0.036f, -0.200f, 0.062f,
+	0.000f, -0.200f, 0.072f,
+	0.036f, -0.210f, 0.062f,
+	0.000f, -0.210f, 0.072f,
+	0.036f, -0.220f, 0.062f,
+	0.000f, -0.220f, 0.072f,
+	0.036f, -0.230f, 0.062f,
+	0.000f, -0.230f, 0.072f,
+	0.036f, -0.240f, 0.062f,
+	0.000f, -0.240f, 0.071f,
+	0.036f, -0.250f, 0.062f,
+	0.000f, -0.250f, 0.071f,
+	0.036f, -0.260f, 0.062f,
+	0.000f, -0.260f, 0.071f,
+	0.035f, -0.270f, 0.061f,
+	0.000f, -0.270f, 0.071f,
+	0.035f, -0.280f, 0.061f,
+	0.000f, -0.280f, 0.071f,
+	0.035f, -0.290f, 0.061f,
+	0.000f, -0.290f, 0.071f,
+	0.035f, -0.300f, 0.061f,
+	0.000f, -0.300f, 0.071f,
+	0.035f, -0.310f, 0.061f,
+	0.000f, -0.310f, 0.070f,
+	0.035f, -0.320f, 0.061f,
+	0.000f, -0.320f, 0.070f,
+	0.035f, -0.330f, 0.061f,
+	0.000f, -0.330f, 0.070f,
+	0.035f, -0.340f, 0.061f,
+	0.000f, -0.340f, 0.070f,
+	0.035f, -0.350f, 0.060f,
+	0.000f, -0.350f, 0.070f,
+	0.035f, -0.360f, 0.060f,
+	0.000f, -0.360f, 0.070f,
+	0.035f, -0.370f, 0.060f,
+	0.000f, -0.370f, 0.069f,
+	0.035f, -0.380f, 0.060f,
+	0.000f, -0.380f, 0.069f,
+	0.035f, -0.390f, 0.060f,
+	0.000f, -0.390f, 0.069f,
+	0.035f, -0.400f, 0.060f,
+	0.000f, -0.400f, 0.069f,
+	0.000f, -0.000f, 0.075f,
+	-0.037f, -0.000f, 0.065f,
+	0.000f, -0.010f, 0.075f,
+	-0.037f, -0.010f, 0.065f,
+	0.000f, -0.020f, 0.075f,
+	-0.037f, -0.020f, 0.065f,
+	0.000f, -0.030f, 0.075f,
+	-0.037f, -0.030f, 0.065f,
+	0.000f, -0.040f, 0.074f,
+	-0.037f, -0.040f, 0.064f,
+	0.000f, -0.050f, 0.074f,
+	-0.037f, -0.050f, 0.064f,
+	0.000f, -0.060f, 0.074f,
+	-0.037f, -0.060f, 0.064f,
+	0.000f, -0.070f, 0.074f,
+	-0.037f, -0.070f, 0.064f,
+	0.000f, -0.080f, 0.074f,
+	-0.037f, -0.080f, 0.064f,
+	0.000f, -0.090f, 0.074f,
+	-0.037f, -0.090f, 0.064f,
+	0.000f, -0.100f, 0.074f,
+	-0.037f, -0.100f, 0.064f,
+	0.000f, -0.110f, 0.073f,
+	-0.037f, -0.110f, 0.064f,
+	0.000f, -0.120f, 0.073f,
+	-0.037f, -0.120f, 0.063f,
+	0.000f, -0.130f, 0.073f,
+	-0.037f, -0.130f, 0.063f,
+	0.000f, -0.140f, 0.073f,
+	-0.036f, -0.140f, 0.063f,
+	0.000f, -0.150f, 0.073f,
+	-0.036f, -0.150f, 0.063f,
+	0.000f, -0.160f, 0.073f,
+	-0.036f, -0.160f, 0.063f,
+	0.000f, -0.170f, 0.072f,
+	-0.036f, -0.170f, 0.063f,
+	0.000f, -0.180f, 0.072f,
+	-0.036f, -0.180f, 0.063f,
+	0.000f, -0.190f, 0.072f,
+	-0.036f, -0.190f, 0.062f,
+	0.000f, -0.200f, 0.072f,
+	-0.036f, -0.200f, 0.062f,
+	0.000f, -0.210f, 0.072f,
+	-0.036f, -0.210f, 0.062f,
+	0.000f, -0.220f, 0.072f,
+	-0.036f, -0.220f, 0.062f,
+	0.000f, -0.230f, 0.072f,
+	-0.036f, -0.230f, 0.062f,
+	0.000f, -0.240f, 0.071f,
+	-0.036f, -0.240f, 0.062f,
+	0.000f, -0.250f, 0.071f,
+	-0.036f, -0.250f, 0.062f,
+	0.000f, -0.260f, 0.071f,
+	-0.036f, -0.260f, 0.062f,
+	0.000f, -0.270f, 0.071f,
+	-0.035f, -0.270f, 0.061f,
+	0.000f, -0.280f, 0.071f,
+	-0.035f, -0.280f, 0.061f,
+	0.000f, -0.290f, 0.071f,
+	-0.035f, -0.290f, 0.061f,
+	0.000f, -0.300f, 0.071f,
+	-0.035f, -0.300f, 0.061f,
+	0.000f, -0.310f, 0.070f,
+	-0.035f, -0.310f, 0.061f,
+	0.000f, -0.320f, 0.070f,
+	-0.035f, -0.320f, 0.061f,
+	0.000f, -0.330f, 0.070f,
+	-0.035f, -0.330f, 0.061f,
+	0.000f, -0.340f, 0.070f,
+	-0.035f, -0.340f, 0.061f,
+	0.000f, -0.350f, 0.070f,
+	-0.035f, -0.350f, 0.060f,
+	0.000f, -0.360f, 0.070f,
+	-0.035f, -0.360f, 0.060f,
+	0.000f, -0.370f, 0.069f,
+	-0.035f, -0.370f, 0.060f,
+	0.000f, -0.380f, 0.069f,
+	-0.035f, -0.380f, 0.060f,
+	0.000f, -0.390f, 0.069f,
+	-0.035f, -0.390f, 0.060f,
+	0.000f, -0.400f, 0.069f,
+	-0.034f, -0.400f, 0.060f,
+	-0.037f, -0.000f, 0.065f,
+	-0.065f, -0.000f, 0.038f,
+	-0.037f, -0.010f, 0.065f,
+	-0.065f, -0.010f, 0.037f,
+	-0.037f, -0.020f, 0.065f,
+	-0.065f, -0.020f, 0.037f,
+	-0.037f, -0.030f, 0.065f,
+	-0.065f, -0.030f, 0.037f,
+	-0.037f, -0.040f, 0.064f,
+	-0.064f, -0.040f, 0.037f,
+	-0.037f, -0.050f, 0.064f,
+	-0.064f, -0.050f, 0.037f,
+	-0.037f, -0.060f, 0.064f,
+	-0.064f, -0.060f, 0.037f,
+	-0.037f, -0.070f, 0.064f,
+	-0.064f, -0.070f, 0.037f,
+	-0.037f, -0.080f, 0.064f,
+	-0.064f, -0.080f, 0.037f,
+	-0.037f, -0.090f, 0.064f,
+	-0.064f, -0.090f, 0.037f,
+	-0.037f, -0.100f, 0.064f,
+	-0.064f, -0.100f, 0.037f,
+	-0.037f, -0.110f, 0.064f,
+	-0.064f, -0.110f, 0.037f,
+	-0.037f, -0.120f, 0.063f,
+	-0.063f, -0.120f, 0.037f,
+	-0.037f, -0.130f, 0.063f,
+	-0.063f, -0.130f, 0.037f,
+	-0.036f, -0.140f, 0.063f,
+	-0.063f, -0.140f, 0.036f,
+	-0.036f, -0.150f, 0.063f,
+	-0.063f, -0.150f, 0.036f,
+	-0.036f, -0.160f, 0.063f,
+	-0.063f, -0.160f, 0.036f,
+	-0.036f, -0.170f, 0.063f,
+	-0.063f, -0.170f, 0.036f,
+	-0.036f, -0.180f, 0.063f,
+	-0.063f, -0.180f, 0.036f,
+	-0.036f, -0.190f, 0.062f,
+	-0.062f, -0.190f, 0.036f,
+	-0.036f, -0.200f, 0.062f,
+	-0.062f, -0.200f, 0.036f,
+	-0.036f, -0.210f, 0.062f,
+	-0.062f, -0.210f, 0.036f,
+	-0.036f, -0.220f, 0.062f,
+	-0.062f, -0.220f, 0.036f,
+	-0.036f, -0.230f, 0.062f,
+	-0.062f, -0.230f, 0.036f,
+	-0.036f, -0.240f, 0.062f,
+	-0.062f, -0.240f, 0.036f,
+	-0.036f, -0.250f, 0.062f,
+	-0.062f, -0.250f, 0.036f,
+	-0.036f, -0.260f, 0.062f,
+	-0.062f, -0.260f, 0.036f,
+	-0.035f, -0.270f, 0.061f,
+	-0.061f, -0.270f, 0.035f,
+	-0.035f, -0.280f, 0.061f,
+	-0.061f, -0.280f, 0.035f,
+	-0.035f, -0.290f, 0.061f,
+	-0.061f, -0.290f, 0.035f,
+	-0.035f, -0.300f, 0.061f,
+	-0.061f, -0.300f, 0.035f,
+	-0.035f, -0.310f, 0.061f,
+	-0.061f, -0.310f, 0.035f,
+	-0.035f, -0.320f, 0.061f,
+	-0.061f, -0.320f, 0.035f,
+	-0.035f, -0.330f, 0.061f,
+	-0.061f, -0.330f, 0.035f,
+	-0.035f, -0.340f, 0.061f,
+	-0.061f, -0.340f, 0.035f,
+	-0.035f, -0.350f, 0.060f,
+	-0.060f, -0.350f, 0.035f,
+	-0.035f, -0.360f, 0.060f,
+	-0.060f, -0.360f, 0.035f,
+	-0.035f, -0.370f, 0.060f,
+	-0.060f, -0.370f, 0.035f,
+	-0.035f, -0.380f, 0.060f,
+	-0.060f, -0.380f, 0.035f,
+	-0.035f, -0.390f, 0.060f,
+	-0.060f, -0.390f, 0.035f,
+	-0.034f, -0.400f, 0.060f,
+	-0.060f, -0.400f, 0.035f,
+	-0.065f, -0.000f, 0.038f,
+	-0.075f, -0.000f, 0.000f,
+	-0.065f, -0.010f, 0.037f,
+	-0.075f, -0.010f, 0.000f,
+	-0.065f, -0.020f, 0.037f,
+	-0.075f, -0.020f, 0.000f,
+	-0.065f, -0.030f, 0.037f,
+	-0.075f, -0.030f, 0.000f,
+	-0.064f, -0.040f, 0.037f,
+	-0.074f, -0.040f, 0.000f,
+	-0.064f, -0.050f, 0.037f,
+	-0.074f, -0.050f, 0.000f,
+	-0.064f, -0.060f, 0.037f,
+	-0.074f, -0.060f, 0.000f,
+	-0.064f, -0.070f, 0.037f,
+	-0.074f, -0.070f, 0.000f,
+	-0.064f, -0.080f, 0.037f,
+	-0.074f, -0.080f, 0.000f,
+	-0.064f, -0.090f, 0.037f,
+	-0.074f, -0.090f, 0.000f,
+	-0.064f, -0.100f, 0.037f,
+	-0.074f, -0.100f, 0.000f,
+	-0.064f, -0.110f, 0.037f,
+	-0.073f, -0.110f, 0.000f,
+	-0.063f, -0.120f, 0.037f,
+	-0.073f, -0.120f, 0.000f,
+	-0.063f, -0.130f, 0.037f,
+	-0.073f, -0.130f, 0.000f,
+	-0.063f, -0.140f, 0.036f,
+	-0.073f, -0.140f, 0.000f,
+	-0.063f, -0.150f, 0.036f,
+	-0.073f, -0.150f, 0.000f,
+	-0.063f, -0.160f, 0.036f,
+	-0.073f, -0.160f, 0.000f,
+	-0.063f, -0.170f, 0.036f,
+	-0.072f, -0.170f, 0.000f,
+	-0.063f, -0.180f, 0.036f,
+	-0.072f, -0.180f, 0.000f,
+	-0.062f, -0.190f, 0.036f,
+	-0.072f, -0.190f, 0.000f,
+	-0.062f, -0.200f, 0.036f,
+	-0.072f, -0.200f, 0.000f,
+	-0.062f, -0.210f, 0.036f,
+	-0.072f, -0.210f, 0.000f,
+	-0.062f, -0.220f, 0.036f,
+	-0.072f, -0.220f, 0.000f,
+	-0.062f, -0.230f, 0.036f,
+	-0.072f, -0.230f, 0.000f,
+	-0.062f, -0.240f, 0.036f,
+	-0.071f, -0.240f, 0.000f,
+	-0.062f, -0.250f, 0.036f,
+	-0.071f, -0.250f, 0.000f,
+	-0.062f, -0.260f, 0.036f,
+	-0.071f, -0.260f, 0.000f,
+	-0.061f, -0.270f, 0.035f,
+	-0.071f, -0.270f, 0.000f,
+	-0.061f, -0.280f, 0.035f,
+	-0.071f, -0.280f, 0.000f,
+	-0.061f, -0.290f, 0.035f,
+	-0.071f, -0.290f, 0.000f,
+	-0.061f, -0.300f, 0.035f,
+	-0.071f, -0.300f, 0.000f,
+	-0.061f, -0.310f, 0.035f,
+	-0.070f, -0.310f, 0.000f,
+	-0.061f, -0.320f, 0.035f,
+	-0.070f, -0.320f, 0.000f,
+	-0.061f, -0.330f, 0.035f,
+	-0.070f, -0.330f, 0.000f,
+	-0.061f, -0.340f, 0.035f,
+	-0.070f, -0.340f, 0.000f,
+	-0.060f, -0.350f, 0.035f,
+	-0.070f, -0.350f, 0.000f,
+	-0.060f, -0.360f, 0.035f,
+	-0.070f, -0.360f, 0.000f,
+	-0.060f, -0.370f, 0.035f,
+	-0.069f, -0.370f, 0.000f,
+	-0.060f, -0.380f, 0.035f,
+	-0.069f, -0.380f, 0.000f,
+	-0.060f, -0.390f, 0.035f,
+	-0.069f, -0.390f, 0.000f,
+	-0.060f, -0.400f, 0.035f,
+	-0.069f, -0.400f, 0.000f,
+	-0.075f, -0.000f, 0.000f,
+	-0.065f, -0.000f, -0.037f,
+	-0.075f, -0.010f, 0.000f,
+	-0.065f, -0.010f, -0.037f,
+	-0.075f, -0.020f, 0.000f,
+	-0.065f, -0.020f, -0.037f,
+	-0.075f, -0.030f, 0.000f,
+	-0.065f, -0.030f, -0.037f,
+	-0.074f, -0.040f, 0.000f,
+	-0.064f, -0.040f, -0.037f,
+	-0.074f, -0.050f, 0.000f,
+	-0.064f, -0.050f, -0.037f,
+	-0.074f, -0.060f, 0.000f,
+	-0.064f, -0.060f, -0.037f,
+	-0.074f, -0.070f, 0.000f,
+	-0.064f, -0.070f, -0.037f,
+	-0.074f, -0.080f, 0.000f,
+	-0.064f, -0.080f, -0.037f,
+	-0.074f, -0.090f, 0.000f,
+	-0.064f, -0.090f, -0.037f,
+	-0.074f, -0.100f, 0.000f,
+	-0.064f, -0.100f, -0.037f,
+	-0.073f, -0.110f, 0.000f,
+	-0.064f, -0.110f, -0.037f,
+	-0.073f, -0.120f, 0.000f,
+	-0.063f, -0.120f, -0.037f,
+	-0.073f, -0.130f, 0.000f,
+	-0.063f, -0.130f, -0.037f,
+	-0.073f, -0.140f, 0.000f,
+	-0.063f, -0.140f, -0.036f,
+	-0.073f, -0.150f, 0.000f,
+	-0.063f, -0.150f, -0.036f,
+	-0.073f, -0.160f, 0.000f,
+	-0.063f, -0.160f, -0.036f,
+	-0.072f, -0.170f, 0.000f,
+	-0.063f, -0.170f, -0.036f,
+	-0.072f, -0.180f, 0.000f,
+	-0.063f, -0.180f, -0.036f,
+	-0.072f, -0.190f, 0.000f,
+	-0.062f, -0.190f, -0.036f,
+	-0.072f, -0.200f, 0.000f,
+	-0.062f, -0.200f, -0.036f,
+	-0.072f, -0.210f, 0.000f,
+	-0.062f, -0.210f, -0.036f,
+	-0.072f, -0.220f, 0.000f,
+	-0.062f, -0.220f, -0.036f,
+	-0.072f, -0.230f, 0.000f,
+	-0.062f, -0.230f, -0.036f,
+	-0.071f, -0.240f, 0.000f,
+	-0.062f, -0.240f, -0.036f,
+	-0.071f, -0.250f, 0.000f,
+	-0.062f, -0.250f, -0.036f,
+	-0.071f, -0.260f, 0.000f,
+	-0.062f, -0.260f, -0.036f,
+	-0.071f, -0.270f, 0.000f,
+	-0.061f, -0.270f, -0.035f,
+	-0.071f, -0.280f, 0.000f,
+	-0.061f, -0.280f, -0.035f,
+	-0.071f, -0.290f, 0.000f,
+	-0.061f, -0.290f, -0.035f,
+	-0.071f, -0.300f, 0.000f,
+	-0.061f, -0.300f, -0.035f,
+	-0.070f, -0.310f, 0.000f,
+	-0.061f, -0.310f, -0.035f,
+	-0.070f, -0.320f, 0.000f,
+	-0.061f, -0.320f, -0.035f,
+	-0.070f, -0.330f, 0.000f,
+	-0.061f, -0.330f, -0.035f,
+	-0.070f, -0.340f, 0.000f,
+	-0.061f, -0.340f, -0.035f,
+	-0.070f, -0.350f, 0.000f,
+	-0.060f, -0.350f, -0.035f,
+	-0.070f, -0.360f, 0.000f,
+	-0.060f, -0.360f, -0.035f,
+	-0.069f, -0.370f, 0.000f,
+	-0.060f, -0.370f, -0.035f,
+	-0.069f, -0.380f, 0.000f,
+	-0.060f, -0.380f, -0.035f,
+	-0.069f, -0.390f, 0.000f,
+	-0.060f, -0.390f, -0.035f,
+	-0.069f, -0.400f, 0.000f,
+	-0.060f, -0.400f, -0.034f,
+	-0.065f, -0.000f, -0.037f,
+	-0.038f, -0.000f, -0.065f,
+	-0.065f, -0.010f, -0.037f,
+	-0.037f, -0.010f, -0.065f,
+	-0.065f, -0.020f, -0.037f,
+	-0.037f, -0.020f, -0.065f,
+	-0.065f, -0.030f, -0.037f,
+	-0.037f, -0.030f, -0.065f,
+	-0.064f, -0.040f, -0.037f,
+	-0.037f, -0.040f, -0.064f,
+	-0.064f, -0.050f, -0.037f,
+	-0.037f, -0.050f, -0.064f,
+	-0.064f, -0.060f, -0.037f,
+	-0.037f, -0.060f, -0.064f,
+	-0.064f, -0.070f, -0.037f,
+	-0.037f, -0.070f, -0.064f,
+	-0.064f, -0.080f, -0.037f,
+	-0.037f, -0.080f, -0.064f,
+	-0.064f, -0.090f, -0.037f,
+	-0.037f, -0.090f, -0.064f,
+	-0.064f, -0.100f, -0.037f,
+	-0.037f, -0.100f, -0.064f,
+	-0.064f, -0.110f, -0.037f,
+	-0.037f, -0.110f, -0.064f,
+	-0.063f, -0.120f, -0.037f,
+	-0.037f, -0.120f, -0.063f,
+	-0.063f, -0.130f, -0.037f,
+	-0.037f, -0.130f, -0.063f,
+	-0.063f, -0.140f, -0.036f,
+	-0.036f, -0.140f, -0.063f,
+	-0.063f, -0.150f, -0.036f,
+	-0.036f, -0.150f, -0.063f,
+	-0.063f, -0.160f, -0.036f,
+	-0.036f, -0.160f, -0.063f,
+	-0.063f, -0.170f, -0.036f,
+	-0.036f, -0.170f, -0.063f,
+	-0.063f, -0.180f, -0.036f,
+	-0.036f, -0.180f, -0.063f,
+	-0.062f, -0.190f, -0.036f,
+	-0.036f, -0.190f, -0.062f,
+	-0.062f, -0.200f, -0.036f,
+	-0.036f, -0.200f, -0.062f,
+	-0.062f, -0.210f, -0.036f,
+	-0.036f, -0.210f, -0.062f,
+	-0.062f, -0.220f, -0.036f,
+	-0.036f, -0.220f, -0.062f,
+	-0.062f, -0.230f, -0.036f,
+	-0.036f, -0.230f, -0.062f,
+	-0.062f, -0.240f, -0.036f,
+	-0.036f, -0.240f, -0.062f,
+	-0.062f, -0.250f, -0.036f,
+	-0.036f, -0.250f, -0.062f,
+	-0.062f, -0.260f, -0.036f,
+	-0.036f, -0.260f, -0.062f,
+	-0.061f, -0.270f, -0.035f,
+	-0.035f, -0.270f, -0.061f,
+	-0.061f, -0.280f, -0.035f,
+	-0.035f, -0.280f, -0.061f,
+	-0.061f, -0.290f, -0.035f,
+	-0.035f, -0.290f, -0.061f,
+	-0.061f, -0.300f, -0.035f,
+	-0.035f, -0.300f, -0.061f,
+	-0.061f, -0.310f, -0.035f,
+	-0.035f, -0.310f, -0.061f,
+	-0.061f, -0.320f, -0.035f,
+	-0.035f, -0.320f, -0.061f,
+	-0.061f, -0.330f, -0.035f,
+	-0.035f, -0.330f, -0.061f,
+	-0.061f, -0.340f, -0.035f,
+	-0.035f, -0.340f, -0.061f,
+	-0.060f, -0.350f, -0.035f,
+	-0.035f, -0.350f, -0.060f,
+	-0.060f, -0.360f, -0.035f,
+	-0.035f, -0.360f, -0.060f,
+	-0.060f, -0.370f, -0.035f,
+	-0.035f, -0.370f, -0.060f,
+	-0.060f, -0.380f, -0.035f,
+	-0.035f, -0.380f, -0.060f,
+	-0.060f, -0.390f, -0.035f,
+	-0.035f, -0.390f, -0.060f,
+	-0.060f, -0.400f, -0.034f,
+	-0.035f, -0.400f, -0.060f,
+	-0.038f, -0.000f, -0.065f,
+	-0.000f, -0.000f, -0.075f,
+	-0.037f, -0.010f, -0.065f,
+	-0.000f, -0.010f, -0.075f,
+	-0.037f, -0.020f, -0.065f,
+	-0.000f, -0.020f, -0.075f,
+	-0.037f, -0.030f, -0.065f,
+	-0.000f, -0.030f, -0.075f,
+	-0.037f, -0.040f, -0.064f,
+	-0.000f, -0.040f, -0.074f,
+	-0.037f, -0.050f, -0.064f,
+	-0.000f, -0.050f, -0.074f,
+	-0.037f, -0.060f, -0.064f,
+	-0.000f, -0.060f, -0.074f,
+	-0.037f, -0.070f, -0.064f,
+	-0.000f, -0.070f, -0.074f,
+	-0.037f, -0.080f, -0.064f,
+	-0.000f, -0.080f, -0.074f,
+	-0.037f, -0.090f, -0.064f,
+	-0.000f, -0.090f, -0.074f,
+	-0.037f, -0.100f, -0.064f,
+	-0.000f, -0.100f, -0.074f,
+	-0.037f, -0.110f, -0.064f,
+	-0.000f, -0.110f, -0.073f,
+	-0.037f, -0.120f, -0.063f,
+	-0.000f, -0.120f, -0.073f,
+	-0.037f, -0.130f, -0.063f,
+	-0.000f, -0.130f, -0.073f,
+	-0.036f, -0.140f, -0.063f,
+	-0.000f, -0.140f, -0.073f,
+	-0.036f, -0.150f, -0.063f,
+	-0.000f, -0.150f, -0.073f,
+	-0.036f, -0.160f, -0.063f,
+	-0.000f, -0.160f, -0.073f,
+	-0.036f, -0.170f, -0.063f,
+	-0.000f, -0.170f, -0.072f,
+	-0.036f, -0.180f, -0.063f,
+	-0.000f, -0.180f, -0.072f,
+	-0.036f, -0.190f, -0.062f,
+	-0.000f, -0.190f, -0.072f,
+	-0.036f, -0.200f, -0.062f,
+	-0.000f, -0.200f, -0.072f,
+	-0.036f, -0.210f, -0.062f,
+	-0.000f, -0.210f, -0.072f,
+	-0.036f, -0.220f, -0.062f,
+	-0.000f, -0.220f, -0.072f,
+	-0.036f, -0.230f, -0.062f,
+	-0.000f, -0.230f, -0.072f,
+	-0.036f, -0.240f, -0.062f,
+	-0.000f, -0.240f, -0.071f,
+	-0.036f, -0.250f, -0.062f,
+	-0.000f, -0.250f, -0.071f,
+	-0.036f, -0.260f, -0.062f,
+	-0.000f, -0.260f, -0.071f,
+	-0.035f, -0.270f, -0.061f,
+	-0.000f, -0.270f, -0.071f,
+	-0.035f, -0.280f, -0.061f,
+	-0.000f, -0.280f, -0.071f,
+	-0.035f, -0.290f, -0.061f,
+	-0.000f, -0.290f, -0.071f,
+	-0.035f, -0.300f, -0.061f,
+	-0.000f, -0.300f, -0.071f,
+	-0.035f, -0.310f, -0.061f,
+	-0.000f, -0.310f, -0.070f,
+	-0.035f, -0.320f, -0.061f,
+	-0.000f, -0.320f, -0.070f,
+	-0.035f, -0.330f, -0.061f,
+	-0.000f, -0.330f, -0.070f,
+	-0.035f, -0.340f, -0.061f,
+	-0.000f, -0.340f, -0.070f,
+	-0.035f, -0.350f, -0.060f,
+	-0.000f, -0.350f, -0.070f,
+	-0.035f, -0.360f, -0.060f,
+	-0.000f, -0.360f, -0.070f,
+	-0.035f, -0.370f, -0.060f,
+	-0.000f, -0.370f, -0.069f,
+	-0.035f, -0.380f, -0.060f,
+	-0.000f, -0.380f, -0.069f,
+	-0.035f, -0.390f, -0.060f,
+	-0.000f, -0.390f, -0.069f,
+	-0.035f, -0.400f, -0.060f,
+	-0.000f, -0.400f, -0.069f,
+	-0.000f, -0.000f, -0.075f,
+	0.037f, -0.000f, -0.065f,
+	-0.000f, -0.010f, -0.075f,
+	0.037f, -0.010f, -0.065f,
+	-0.000f, -0.020f, -0.075f,
+	0.037f, -0.020f, -0.065f,
+	-0.000f, -0.030f, -0.075f,
+	0.037f, -0.030f, -0.065f,
+	-0.000f, -0.040f, -0.074f,
+	0.037f, -0.040f, -0.064f,
+	-0.000f, -0.050f, -0.074f,
+	0.037f, -0.050f, -0.064f,
+	-0.000f, -0.060f, -0.074f,
+	0.037f, -0.060f, -0.064f,
+	-0.000f, -0.070f, -0.074f,
+	0.037f, -0.070f, -0.064f,
+	-0.000f, -0.080f, -0.074f,
+	0.037f, -0.080f, -0.064f,
+	-0.000f, -0.090f, -0.074f,
+	0.037f, -0.090f, -0.064f,
+	-0.000f, -0.100f, -0.074f,
+	0.037f, -0.100f, -0.064f,
+	-0.000f, -0.110f, -0.073f,
+	0.037f, -0.110f, -0.064f,
+	-0.000f, -0.120f, -0.073f,
+	0.037f, -0.120f, -0.063f,
+	-0.000f, -0.130f, -0.073f,
+	0.037f, -0.130f, -0.063f,
+	-0.000f, -0.140f, -0.073f,
+	0.036f, -0.140f, -0.063f,
+	-0.000f, -0.150f, -0.073f,
+	0.036f, -0.150f, -0.063f,
+	-0.000f, -0.160f, -0.073f,
+	0.036f, -0.160f, -0.063f,
+	-0.000f, -0.170f, -0.072f,
+	0.036f, -0.170f, -0.063f,
+	-0.000f, -0.180f, -0.072f,
+	0.036f, -0.180f, -0.063f,
+	-0.000f, -0.190f, -0.072f,
+	0.036f, -0.190f, -0.062f,
+	-0.000f, -0.200f, -0.072f,
+	0.036f, -0.200f, -0.062f,
+	-0.000f, -0.210f, -0.072f,
+	0.036f, -0.210f, -0.062f,
+	-0.000f, -0.220f, -0.072f,
+	0.036f, -0.220f, -0.062f,
+	-0.000f, -0.230f, -0.072f,
+	0.036f, -0.230f, -0.062f,
+	-0.000f, -0.240f, -0.071f,
+	0.036f, -0.240f, -0.062f,
+	-0.000f, -0.250f, -0.071f,
+	0.036f, -0.250f, -0.062f,
+	-0.000f, -0.260f, -0.071f,
+	0.036f, -0.260f, -0.062f,
+	-0.000f, -0.270f, -0.071f,
+	0.035f, -0.270f, -0.061f,
+	-0.000f, -0.280f, -0.071f,
+	0.035f, -0.280f, -0.061f,
+	-0.000f, -0.290f, -0.071f,
+	0.035f, -0.290f, -0.061f,
+	-0.000f, -0.300f, -0.071f,
+	0.035f, -0.300f, -0.061f,
+	-0.000f, -0.310f, -0.070f,
+	0.035f, -0.310f, -0.061f,
+	-0.000f, -0.320f, -0.070f,
+	0.035f, -0.320f, -0.061f,
+	-0.000f, -0.330f, -0.070f,
+	0.035f, -0.330f, -0.061f,
+	-0.000f, -0.340f, -0.070f,
+	0.035f, -0.340f, -0.061f,
+	-0.000f, -0.350f, -0.070f,
+	0.035f, -0.350f, -0.060f,
+	-0.000f, -0.360f, -0.070f,
+	0.035f, -0.360f, -0.060f,
+	-0.000f, -0.370f, -0.069f,
+	0.035f, -0.370f, -0.060f,
+	-0.000f, -0.380f, -0.069f,
+	0.035f, -0.380f, -0.060f,
+	-0.000f, -0.390f, -0.069f,
+	0.035f, -0.390f, -0.060f,
+	-0.000f, -0.400f, -0.069f,
+	0.034f, -0.400f, -0.060f,
+	0.037f, -0.000f, -0.065f,
+	0.065f, -0.000f, -0.038f,
+	0.037f, -0.010f, -0.065f,
+	0.065f, -0.010f, -0.037f,
+	0.037f, -0.020f, -0.065f,
+	0.065f, -0.020f, -0.037f,
+	0.037f, -0.030f, -0.065f,
+	0.065f, -0.030f, -0.037f,
+	0.037f, -0.040f, -0.064f,
+	0.064f, -0.040f, -0.037f,
+	0.037f, -0.050f, -0.064f,
+	0.064f, -0.050f, -0.037f,
+	0.037f, -0.060f, -0.064f,
+	0.064f, -0.060f, -0.037f,
+	0.037f, -0.070f, -0.064f,
+	0.064f, -0.070f, -0.037f,
+	0.037f, -0.080f, -0.064f,
+	0.064f, -0.080f, -0.037f,
+	0.037f, -0.090f, -0.064f,
+	0.064f, -0.090f, -0.037f,
+	0.037f, -0.100f, -0.064f,
+	0.064f, -0.100f, -0.037f,
+	0.037f, -0.110f, -0.064f,
+	0.064f, -0.110f, -0.037f,
+	0.037f, -0.120f, -0.063f,
+	0.063f, -0.120f, -0.037f,
+	0.037f, -0.130f, -0.063f,
+	0.063f, -0.130f, -0.037f,
+	0.036f, -0.140f, -0.063f,
+	0.063f, -0.140f, -0.036f,
+	0.036f, -0.150f, -0.063f,
+	0.063f, -0.150f, -0.036f,
+	0.036f, -0.160f, -0.063f,
+	0.063f, -0.160f, -0.036f,
+	0.036f, -0.170f, -0.063f,
+	0.063f, -0.170f, -0.036f,
+	0.036f, -0.180f, -0.063f,
+	0.063f, -0.180f, -0.036f,
+	0.036f, -0.190f, -0.062f,
+	0.062f, -0.190f, -0.036f,
+	0.036f, -0.200f, -0.062f,
+	0.062f, -0.200f, -0.036f,
+	0.036f, -0.210f, -0.062f,
+	0.062f, -0.210f, -0.036f,
+	0.036f, -0.220f, -0.062f,
+	0.062f, -0.220f, -0.036f,
+	0.036f, -0.230f, -0.062f,
+	0.062f, -0.230f, -0.036f,
+	0.036f, -0.240f, -0.062f,
+	0.062f, -0.240f, -0.036f,
+	0.036f, -0.250f, -0.062f,
+	0.062f, -0.250f, -0.036f,
+	0.036f, -0.260f, -0.062f,
+	0.062f, -0.260f, -0.036f,
+	0.035f, -0.270f, -0.061f,
+	0.061f, -0.270f, -0.035f,
+	0.035f, -0.280f, -0.061f,
+	0.061f, -0.280f, -0.035f,
+	0.035f, -0.290f, -0.061f,
+	0.061f, -0.290f, -0.035f,
+	0.035f, -0.300f, -0.061f,
+	0.061f, -0.300f, -0.035f,
+	0.035f, -0.310f, -0.061f,
+	0.061f, -0.310f, -0.035f,
+	0.035f, -0.320f, -0.061f,
+	0.061f, -0.320f, -0.035f,
+	0.035f, -0.330f, -0.061f,
+	0.061f, -0.330f, -0.035f,
+	0.035f, -0.340f, -0.061f,
+	0.061f, -0.340f, -0.035f,
+	0.035f, -0.350f, -0.060f,
+	0.060f, -0.350f, -0.035f,
+	0.035f, -0.360f, -0.060f,
+	0.060f, -0.360f, -0.035f,
+	0.035f, -0.370f, -0.060f,
+	0.060f, -0.370f, -0.035f,
+	0.035f, -0.380f, -0.060f,
+	0.060f, -0.380f, -0.035f,
+	0.035f, -0.390f, -0.060f,
+	0.060f, -0.390f, -0.035f,
+	0.034f, -0.400f, -0.060f,
+	0.060f, -0.400f, -0.035f,
+	0.065f, -0.000f, -0.038f,
+	0.075f, -0.000f, -0.000f,
+	0.065f, -0.010f, -0.037f,
+	0.075f, -0.010f, -0.000f,
+	0.065f, -0.020f, -0.037f,
+	0.075f, -0.020f, -0.000f,
+	0.065f, -0.030f, -0.037f,
+	0.075f, -0.030f, -0.000f,
+	0.064f, -0.040f, -0.037f,
+	0.074f, -0.040f, -0.000f,
+	0.064f, -0.050f, -0.037f,
+	0.074f, -0.050f, -0.000f,
+	0.064f, -0.060f, -0.037f,
+	0.074f, -0.060f, -0.000f,
+	0.064f, -0.070f, -0.037f,
+	0.074f, -0.070f, -0.000f,
+	0.064f, -0.080f, -0.037f,
+	0.074f, -0.080f, -0.000f,
+	0.064f, -0.090f, -0.037f,
+	0.074f, -0.090f, -0.000f,
+	0.064f, -0.100f, -0.037f,
+	0.074f, -0.100f, -0.000f,
+	0.064f, -0.110f, -0.037f,
+	0.073f, -0.110f, -0.000f,
+	0.063f, -0.120f, -0.037f,
+	0.073f, -0.120f, -0.000f,
+	0.063f, -0.130f, -0.037f,
+	0.073f, -0.130f, -0.000f,
+	0.063f, -0.140f, -0.036f,
+	0.073f, -0.140f, -0.000f,
+	0.063f, -0.150f, -0.036f,
+	0.073f, -0.150f, -0.000f,
+	0.063f, -0.160f, -0.036f,
+	0.073f, -0.160f, -0.000f,
+	0.063f, -0.170f, -0.036f,
+	0.072f, -0.170f, -0.000f,
+	0.063f, -0.180f, -0.036f,
+	0.072f, -0.180f, -0.000f,
+	0.062f, -0.190f, -0.036f,
+	0.072f, -0.190f, -0.000f,
+	0.062f, -0.200f, -0.036f,
+	0.072f, -0.200f, -0.000f,
+	0.062f, -0.210f, -0.036f,
+	0.072f, -0.210f, -0.000f,
+	0.062f, -0.220f, -0.036f,
+	0.072f, -0.220f, -0.000f,
+	0.062f, -0.230f, -0.036f,
+	0.072f, -0.230f, -0.000f,
+	0.062f, -0.240f, -0.036f,
+	0.071f, -0.240f, -0.000f,
+	0.062f, -0.250f, -0.036f,
+	0.071f, -0.250f, -0.000f,
+	0.062f, -0.260f, -0.036f,
+	0.071f, -0.260f, -0.000f,
+	0.061f, -0.270f, -0.035f,
+	0.071f, -0.270f, -0.000f,
+	0.061f, -0.280f, -0.035f,
+	0.071f, -0.280f, -0.000f,
+	0.061f, -0.290f, -0.035f,
+	0.071f, -0.290f, -0.000f,
+	0.061f, -0.300f, -0.035f,
+	0.071f, -0.300f, -0.000f,
+	0.061f, -0.310f, -0.035f,
+	0.070f, -0.310f, -0.000f,
+	0.061f, -0.320f, -0.035f,
+	0.070f, -0.320f, -0.000f,
+	0.061f, -0.330f, -0.035f,
+	0.070f, -0.330f, -0.000f,
+	0.061f, -0.340f, -0.035f,
+	0.070f, -0.340f, -0.000f,
+	0.060f, -0.350f, -0.035f,
+	0.070f, -0.350f, -0.000f,
+	0.060f, -0.360f, -0.035f,
+	0.070f, -0.360f, -0.000f,
+	0.060f, -0.370f, -0.035f,
+	0.069f, -0.370f, -0.000f,
+	0.060f, -0.380f, -0.035f,
+	0.069f, -0.380f, -0.000f,
+	0.060f, -0.390f, -0.035f,
+	0.069f, -0.390f, -0.000f,
+	0.060f, -0.400f, -0.035f,
+	0.069f, -0.400f, -0.000f,
+	0.075f, -0.000f, -0.000f,
+	0.065f, -0.000f, 0.037f,
+	0.075f, -0.010f, -0.000f,
+	0.065f, -0.010f, 0.037f,
+	0.075f, -0.020f, -0.000f,
+	0.065f, -0.020f, 0.037f,
+	0.075f, -0.030f, -0.000f,
+	0.065f, -0.030f, 0.037f,
+	0.074f, -0.040f, -0.000f,
+	0.064f, -0.040f, 0.037f,
+	0.074f, -0.050f, -0.000f,
+	0.064f, -0.050f, 0.037f,
+	0.074f, -0.060f, -0.000f,
+	0.064f, -0.060f, 0.037f,
+	0.074f, -0.070f, -0.000f,
+	0.064f, -0.070f, 0.037f,
+	0.074f, -0.080f, -0.000f,
+	0.064f, -0.080f, 0.037f,
+	0.074f, -0.090f, -0.000f,
+	0.064f, -0.090f, 0.037f,
+	0.074f, -0.100f, -0.000f,
+	0.064f, -0.100f, 0.037f,
+	0.073f, -0.110f, -0.000f,
+	0.064f, -0.110f, 0.037f,
+	0.073f, -0.120f, -0.000f,
+	0.063f, -0.120f, 0.037f,
+	0.073f, -0.130f, -0.000f,
+	0.063f, -0.130f, 0.037f,
+	0.073f, -0.140f, -0.000f,
+	0.063f, -0.140f, 0.036f,
+	0.073f, -0.150f, -0.000f,
+	0.063f, -0.150f, 0.036f,
+	0.073f, -0.160f, -0.000f,
+	0.063f, -0.160f, 0.036f,
+	0.072f, -0.170f, -0.000f,
+	0.063f, -0.170f, 0.036f,
+	0.072f, -0.180f, -0.000f,
+	0.063f, -0.180f, 0.036f,
+	0.072f, -0.190f, -0.000f,
+	0.062f, -0.190f, 0.036f,
+	0.072f, -0.200f, -0.000f,
+	0.062f, -0.200f, 0.036f,
+	0.072f, -0.210f, -0.000f,
+	0.062f, -0.210f, 0.036f,
+	0.072f, -0.220f, -0.000f,
+	0.062f, -0.220f, 0.036f,
+	0.072f, -0.230f, -0.000f,
+	0.062f, -0.230f, 0.036f,
+	0.071f, -0.240f, -0.000f,
+	0.062f, -0.240f, 0.036f,
+	0.071f, -0.250f, -0.000f,
+	0.062f, -0.250f, 0.036f,
+	0.071f, -0.260f, -0.000f,
+	0.062f, -0.260f, 0.036f,
+	0.071f, -0.270f, -0.000f,
+	0.061f, -0.270f, 0.035f,
+	0.071f, -0.280f, -0.000f,
+	0.061f, -0.280f, 0.035f,
+	0.071f, -0.290f, -0.000f,
+	0.061f, -0.290f, 0.035f,
+	0.071f, -0.300f, -0.000f,
+	0.061f, -0.300f, 0.035f,
+	0.070f, -0.310f, -0.000f,
+	0.061f, -0.310f, 0.035f,
+	0.070f, -0.320f, -0.000f,
+	0.061f, -0.320f, 0.035f,
+	0.070f, -0.330f, -0.000f,
+	0.061f, -0.330f, 0.035f,
+	0.070f, -0.340f, -0.000f,
+	0.061f, -0.340f, 0.035f,
+	0.070f, -0.350f, -0.000f,
+	0.060f, -0.350f, 0.035f,
+	0.070f, -0.360f, -0.000f,
+	0.060f, -0.360f, 0.035f,
+	0.069f, -0.370f, -0.000f,
+	0.060f, -0.370f, 0.035f,
+	0.069f, -0.380f, -0.000f,
+	0.060f, -0.380f, 0.035f,
+	0.069f, -0.390f, -0.000f,
+	0.060f, -0.390f, 0.035f,
+	0.069f, -0.400f, -0.000f,
+	0.060f, -0.400f, 0.034f,
+};
+
+static const unsigned short limb_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	16, 17, 19,
+	16, 19, 18,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	22, 23, 25,
+	22, 25, 24,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	28, 29, 31,
+	28, 31, 30,
+	30, 31, 33,
+	30, 33, 32,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	38, 39, 41,
+	38, 41, 40,
+	40, 41, 43,
+	40, 43, 42,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	46, 47, 49,
+	46, 49, 48,
+	48, 49, 51,
+	48, 51, 50,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+	54, 55, 57,
+	54, 57, 56,
+	56, 57, 59,
+	56, 59, 58,
+	58, 59, 61,
+	58, 61, 60,
+	60, 61, 63,
+	60, 63, 62,
+	62, 63, 65,
+	62, 65, 64,
+	64, 65, 67,
+	64, 67, 66,
+	66, 67, 69,
+	66, 69, 68,
+	68, 69, 71,
+	68, 71, 70,
+	70, 71, 73,
+	70, 73, 72,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+	76, 77, 79,
+	76, 79, 78,
+	78, 79, 81,
+	78, 81, 80,
+	82, 83, 85,
+	82, 85, 84,
+	84, 85, 87,
+	84, 87, 86,
+	86, 87, 89,
+	86, 89, 88,
+	88, 89, 91,
+	88, 91, 90,
+	90, 91, 93,
+	90, 93, 92,
+	92, 93, 95,
+	92, 95, 94,
+	94, 95, 97,
+	94, 97, 96,
+	96, 97, 99,
+	96, 99, 98,
+	98, 99, 101,
+	98, 101, 100,
+	100, 101, 103,
+	100, 103, 102,
+	102, 103, 105,
+	102, 105, 104,
+	104, 105, 107,
+	104, 107, 106,
+	106, 107, 109,
+	106, 109, 108,
+	108, 109, 111,
+	108, 111, 110,
+	110, 111, 113,
+	110, 113, 112,
+	112, 113, 115,
+	112, 115, 114,
+	114, 115, 117,
+	114, 117, 116,
+	116, 117, 119,
+	116, 119, 118,
+	118, 119, 121,
+	118, 121, 120,
+	120, 121, 123,
+	120, 123, 122,
+	122, 123, 125,
+	122, 125, 124,
+	124, 125, 127,
+	124, 127, 126,
+	126, 127, 129,
+	126, 129, 128,
+	128, 129, 131,
+	128, 131, 130,
+	130, 131, 133,
+	130, 133, 132,
+	132, 133, 135,
+	132, 135, 134,
+	134, 135, 137,
+	134, 137, 136,
+	136, 137, 139,
+	136, 139, 138,
+	138, 139, 141,
+	138, 141, 140,
+	140, 141, 143,
+	140, 143, 142,
+	142, 143, 145,
+	142, 145, 144,
+	144, 145, 147,
+	144, 147, 146,
+	146, 147, 149,
+	146, 149, 148,
+	148, 149, 151,
+	148, 151, 150,
+	150, 151, 153,
+	150, 153, 152,
+	152, 153, 155,
+	152, 155, 154,
+	154, 155, 157,
+	154, 157, 156,
+	156, 157, 159,
+	156, 159, 158,
+	158, 159, 161,
+	158, 161, 160,
+	160, 161, 163,
+	160, 163, 162,
+	164, 165, 167,
+	164, 167, 166,
+	166, 167, 169,
+	166, 169, 168,
+	168, 169, 171,
+	168, 171, 170,
+	170, 171, 173,
+	170, 173, 172,
+	172, 173, 175,
+	172, 175, 174,
+	174, 175, 177,
+	174, 177, 176,
+	176, 177, 179,
+	176, 179, 178,
+	178, 179, 181,
+	178, 181, 180,
+	180, 181, 183,
+	180, 183, 182,
+	182, 183, 185,
+	182, 185, 184,
+	184, 185, 187,
+	184, 187, 186,
+	186, 187, 189,
+	186, 189, 188,
+	188, 189, 191,
+	188, 191, 190,
+	190, 191, 193,
+	190, 193, 192,
+	192, 193, 195,
+	192, 195, 194,
+	194, 195, 197,
+	194, 197, 196,
+	196, 197, 199,
+	196, 199, 198,
+	198, 199, 201,
+	198, 201, 200,
+	200, 201, 203,
+	200, 203, 202,
+	202, 203, 205,
+	202, 205, 204,
+	204, 205, 207,
+	204, 207, 206,
+	206, 207, 209,
+	206, 209, 208,
+	208, 209, 211,
+	208, 211, 210,
+	210, 211, 213,
+	210, 213, 212,
+	212, 213, 215,
+	212, 215, 214,
+	214, 215, 217,
+	214, 217, 216,
+	216, 217, 219,
+	216, 219, 218,
+	218, 219, 221,
+	218, 221, 220,
+	220, 221, 223,
+	220, 223, 222,
+	222, 223, 225,
+	222, 225, 224,
+	224, 225, 227,
+	224, 227, 226,
+	226, 227, 229,
+	226, 229, 228,
+	228, 229, 231,
+	228, 231, 230,
+	230, 231, 233,
+	230, 233, 232,
+	232, 233, 235,
+	232, 235, 234,
+	234, 235, 237,
+	234, 237, 236,
+	236, 237, 239,
+	236, 239, 238,
+	238, 239, 241,
+	238, 241, 240,
+	240, 241, 243,
+	240, 243, 242,
+	242, 243, 245,
+	242, 245, 244,
+	246, 247, 249,
+	246, 249, 248,
+	248, 249, 251,
+	248, 251, 250,
+	250, 251, 253,
+	250, 253, 252,
+	252, 253, 255,
+	252, 255, 254,
+	254, 255, 257,
+	254, 257, 256,
+	256, 257, 259,
+	256, 259, 258,
+	258, 259, 261,
+	258, 261, 260,
+	260, 261, 263,
+	260, 263, 262,
+	262, 263, 265,
+	262, 265, 264,
+	264, 265, 267,
+	264, 267, 266,
+	266, 267, 269,
+	266, 269, 268,
+	268, 269, 271,
+	268, 271, 270,
+	270, 271, 273,
+	270, 273, 272,
+	272, 273, 275,
+	272, 275, 274,
+	274, 275, 277,
+	274, 277, 276,
+	276, 277, 279,
+	276, 279, 278,
+	278, 279, 281,
+	278, 281, 280,
+	280, 281, 283,
+	280, 283, 282,
+	282, 283, 285,
+	282, 285, 284,
+	284, 285, 287,
+	284, 287, 286,
+	286, 287, 289,
+	286, 289, 288,
+	288, 289, 291,
+	288, 291, 290,
+	290, 291, 293,
+	290, 293, 292,
+	292, 293, 295,
+	292, 295, 294,
+	294, 295, 297,
+	294, 297, 296,
+	296, 297, 299,
+	296, 299, 298,
+	298, 299, 301,
+	298, 301, 300,
+	300, 301, 303,
+	300, 303, 302,
+	302, 303, 305,
+	302, 305, 304,
+	304, 305, 307,
+	304, 307, 306,
+	306, 307, 309,
+	306, 309, 308,
+	308, 309, 311,
+	308, 311, 310,
+	310, 311, 313,
+	310, 313, 312,
+	312, 313, 315,
+	312, 315, 314,
+	314, 315, 317,
+	314, 317, 316,
+	316, 317, 319,
+	316, 319, 318,
+	318, 319, 321,
+	318, 321, 320,
+	320, 321, 323,
+	320, 323, 322,
+	322, 323, 325,
+	322, 325, 324,
+	324, 325, 327,
+	324, 327, 326,
+	328, 329, 331,
+	328, 331, 330,
+	330, 331, 333,
+	330, 333, 332,
+	332, 333, 335,
+	332, 335, 334,
+	334, 335, 337,
+	334, 337, 336,
+	336, 337, 339,
+	336, 339, 338,
+	338, 339, 341,
+	338, 341, 340,
+	340, 341, 343,
+	340, 343, 342,
+	342, 343, 345,
+	342, 345, 344,
+	344, 345, 347,
+	344, 347, 346,
+	346, 347, 349,
+	346, 349, 348,
+	348, 349, 351,
+	348, 351, 350,
+	350, 351, 353,
+	350, 353, 352,
+	352, 353, 355,
+	352, 355, 354,
+	354, 355, 357,
+	354, 357, 356,
+	356, 357, 359,
+	356, 359, 358,
+	358, 359, 361,
+	358, 361, 360,
+	360, 361, 363,
+	360, 363, 362,
+	362, 363, 365,
+	362, 365, 364,
+	364, 365, 367,
+	364, 367, 366,
+	366, 367, 369,
+	366, 369, 368,
+	368, 369, 371,
+	368, 371, 370,
+	370, 371, 373,
+	370, 373, 372,
+	372, 373, 375,
+	372, 375, 374,
+	374, 375, 377,
+	374, 377, 376,
+	376, 377, 379,
+	376, 379, 378,
+	378, 379, 381,
+	378, 381, 380,
+	380, 381, 383,
+	380, 383, 382,
+	382, 383, 385,
+	382, 385, 384,
+	384, 385, 387,
+	384, 387, 386,
+	386, 387, 389,
+	386, 389, 388,
+	388, 389, 391,
+	388, 391, 390,
+	390, 391, 393,
+	390, 393, 392,
+	392, 393, 395,
+	392, 395, 394,
+	394, 395, 397,
+	394, 397, 396,
+	396, 397, 399,
+	396, 399, 398,
+	398, 399, 401,
+	398, 401, 400,
+	400, 401, 403,
+	400, 403, 402,
+	402, 403, 405,
+	402, 405, 404,
+	404, 405, 407,
+	404, 407, 406,
+	406, 407, 409,
+	406, 409, 408,
+	410, 411, 413,
+	410, 413, 412,
+	412, 413, 415,
+	412, 415, 414,
+	414, 415, 417,
+	414, 417, 416,
+	416, 417, 419,
+	416, 419, 418,
+	418, 419, 421,
+	418, 421, 420,
+	420, 421, 423,
+	420, 423, 422,
+	422, 423, 425,
+	422, 425, 424,
+	424, 425, 427,
+	424, 427, 426,
+	426, 427, 429,
+	426, 429, 428,
+	428, 429, 431,
+	428, 431, 430,
+	430, 431, 433,
+	430, 433, 432,
+	432, 433, 435,
+	432, 435, 434,
+	434, 435, 437,
+	434, 437, 436,
+	436, 437, 439,
+	436, 439, 438,
+	438, 439, 441,
+	438, 441, 440,
+	440, 441, 443,
+	440, 443, 442,
+	442, 443, 445,
+	442, 445, 444,
+	444, 445, 447,
+	444, 447, 446,
+	446, 447, 449,
+	446, 449, 448,
+	448, 449, 451,
+	448, 451, 450,
+	450, 451, 453,
+	450, 453, 452,
+	452, 453, 455,
+	452, 455, 454,
+	454, 455, 457,
+	454, 457, 456,
+	456, 457, 459,
+	456, 459, 458,
+	458, 459, 461,
+	458, 461, 460,
+	460, 461, 463,
+	460, 463, 462,
+	462, 463, 465,
+	462, 465, 464,
+	464, 465, 467,
+	464, 467, 466,
+	466, 467, 469,
+	466, 469, 468,
+	468, 469, 471,
+	468, 471, 470,
+	470, 471, 473,
+	470, 473, 472,
+	472, 473, 475,
+	472, 475, 474,
+	474, 475, 477,
+	474, 477, 476,
+	476, 477, 479,
+	476, 479, 478,
+	478, 479, 481,
+	478, 481, 480,
+	480, 481, 483,
+	480, 483, 482,
+	482, 483, 485,
+	482, 485, 484,
+	484, 485, 487,
+	484, 487, 486,
+	486, 487, 489,
+	486, 489, 488,
+	488, 489, 491,
+	488, 491, 490,
+	492, 493, 495,
+	492, 495, 494,
+	494, 495, 497,
+	494, 497, 496,
+	496, 497, 499,
+	496, 499, 498,
+	498, 499, 501,
+	498, 501, 500,
+	500, 501, 503,
+	500, 503, 502,
+	502, 503, 505,
+	502, 505, 504,
+	504, 505, 507,
+	504, 507, 506,
+	506, 507, 509,
+	506, 509, 508,
+	508, 509, 511,
+	508, 511, 510,
+	510, 511, 513,
+	510, 513, 512,
+	512, 513, 515,
+	512, 515, 514,
+	514, 515, 517,
+	514, 517, 516,
+	516, 517, 519,
+	516, 519, 518,
+	518, 519, 521,
+	518, 521, 520,
+	520, 521, 523,
+	520, 523, 522,
+	522, 523, 525,
+	522, 525, 524,
+	524, 525, 527,
+	524, 527, 526,
+	526, 527, 529,
+	526, 529, 528,
+	528, 529, 531,
+	528, 531, 530,
+	530, 531, 533,
+	530, 533, 532,
+	532, 533, 535,
+	532, 535, 534,
+	534, 535, 537,
+	534, 537, 536,
+	536, 537, 539,
+	536, 539, 538,
+	538, 539, 541,
+	538, 541, 540,
+	540, 541, 543,
+	540, 543, 542,
+	542, 543, 545,
+	542, 545, 544,
+	544, 545, 547,
+	544, 547, 546,
+	546, 547, 549,
+	546, 549, 548,
+	548, 549, 551,
+	548, 551, 550,
+	550, 551, 553,
+	550, 553, 552,
+	552, 553, 555,
+	552, 555, 554,
+	554, 555, 557,
+	554, 557, 556,
+	556, 557, 559,
+	556, 559, 558,
+	558, 559, 561,
+	558, 561, 560,
+	560, 561, 563,
+	560, 563, 562,
+	562, 563, 565,
+	562, 565, 564,
+	564, 565, 567,
+	564, 567, 566,
+	566, 567, 569,
+	566, 569, 568,
+	568, 569, 571,
+	568, 571, 570,
+	570, 571, 573,
+	570, 573, 572,
+	574, 575, 577,
+	574, 577, 576,
+	576, 577, 579,
+	576, 579, 578,
+	578, 579, 581,
+	578, 581, 580,
+	580, 581, 583,
+	580, 583, 582,
+	582, 583, 585,
+	582, 585, 584,
+	584, 585, 587,
+	584, 587, 586,
+	586, 587, 589,
+	586, 589, 588,
+	588, 589, 591,
+	588, 591, 590,
+	590, 591, 593,
+	590, 593, 592,
+	592, 593, 595,
+	592, 595, 594,
+	594, 595, 597,
+	594, 597, 596,
+	596, 597, 599,
+	596, 599, 598,
+	598, 599, 601,
+	598, 601, 600,
+	600, 601, 603,
+	600, 603, 602,
+	602, 603, 605,
+	602, 605, 604,
+	604, 605, 607,
+	604, 607, 606,
+	606, 607, 609,
+	606, 609, 608,
+	608, 609, 611,
+	608, 611, 610,
+	610, 611, 613,
+	610, 613, 612,
+	612, 613, 615,
+	612, 615, 614,
+	614, 615, 617,
+	614, 617, 616,
+	616, 617, 619,
+	616, 619, 618,
+	618, 619, 621,
+	618, 621, 620,
+	620, 621, 623,
+	620, 623, 622,
+	622, 623, 625,
+	622, 625, 624,
+	624, 625, 627,
+	624, 627, 626,
+	626, 627, 629,
+	626, 629, 628,
+	628, 629, 631,
+	628, 631, 630,
+	630, 631, 633,
+	630, 633, 632,
+	632, 633, 635,
+	632, 635, 634,
+	634, 635, 637,
+	634, 637, 636,
+	636, 637, 639,
+	636, 639, 638,
+	638, 639, 641,
+	638, 641, 640,
+	640, 641, 643,
+	640, 643, 642,
+	642, 643, 645,
+	642, 645, 644,
+	644, 645, 647,
+	644, 647, 646,
+	646, 647, 649,
+	646, 649, 648,
+	648, 649, 651,
+	648, 651, 650,
+	650, 651, 653,
+	650, 653, 652,
+	652, 653, 655,
+	652, 655, 654,
+	656, 657, 659,
+	656, 659, 658,
+	658, 659, 661,
+	658, 661, 660,
+	660, 661, 663,
+	660, 663, 662,
+	662, 663, 665,
+	662, 665, 664,
+	664, 665, 667,
+	664, 667, 666,
+	666, 667, 669,
+	666, 669, 668,
+	668, 669, 671,
+	668, 671, 670,
+	670, 671, 673,
+	670, 673, 672,
+	672, 673, 675,
+	672, 675, 674,
+	674, 675, 677,
+	674, 677, 676,
+	676, 677, 679,
+	676, 679, 678,
+	678, 679, 681,
+	678, 681, 680,
+	680, 681, 683,
+	680, 683, 682,
+	682, 683, 685,
+	682, 685, 684,
+	684, 685, 687,
+	684, 687, 686,
+	686, 687, 689,
+	686, 689, 688,
+	688, 689, 691,
+	688, 691, 690,
+	690, 691, 693,
+	690, 693, 692,
+	692, 693, 695,
+	692, 695, 694,
+	694, 695, 697,
+	694, 697, 696,
+	696, 697, 699,
+	696, 699, 698,
+	698, 699, 701,
+	698, 701, 700,
+	700, 701, 703,
+	700, 703, 702,
+	702, 703, 705,
+	702, 705, 704,
+	704, 705, 707,
+	704, 707, 706,
+	706, 707, 709,
+	706, 709, 708,
+	708, 709, 711,
+	708, 711, 710,
+	710, 711, 713,
+	710, 713, 712,
+	712, 713, 715,
+	712, 715, 714,
+	714, 715, 717,
+	714, 717, 716,
+	716, 717, 719,
+	716, 719, 718,
+	718, 719, 721,
+	718, 721, 720,
+	720, 721, 723,
+	720, 723, 722,
+	722, 723, 725,
+	722, 725, 724,
+	724, 725, 727,
+	724, 727, 726,
+	726, 727, 729,
+	726, 729, 728,
+	728, 729, 731,
+	728, 731, 730,
+	730, 731, 733,
+	730, 733, 732,
+	732, 733, 735,
+	732, 735, 734,
+	734, 735, 737,
+	734, 737, 736,
+	738, 739, 741,
+	738, 741, 740,
+	740, 741, 743,
+	740, 743, 742,
+	742, 743, 745,
+	742, 745, 744,
+	744, 745, 747,
+	744, 747, 746,
+	746, 747, 749,
+	746, 749, 748,
+	748, 749, 751,
+	748, 751, 750,
+	750, 751, 753,
+	750, 753, 752,
+	752, 753, 755,
+	752, 755, 754,
+	754, 755, 757,
+	754, 757, 756,
+	756, 757, 759,
+	756, 759, 758,
+	758, 759, 761,
+	758, 761, 760,
+	760, 761, 763,
+	760, 763, 762,
+	762, 763, 765,
+	762, 765, 764,
+	764, 765, 767,
+	764, 767, 766,
+	766, 767, 769,
+	766, 769, 768,
+	768, 769, 771,
+	768, 771, 770,
+	770, 771, 773,
+	770, 773, 772,
+	772, 773, 775,
+	772, 775, 774,
+	774, 775, 777,
+	774, 777, 776,
+	776, 777, 779,
+	776, 779, 778,
+	778, 779, 781,
+	778, 781, 780,
+	780, 781, 783,
+	780, 783, 782,
+	782, 783, 785,
+	782, 785, 784,
+	784, 785, 787,
+	784, 787, 786,
+	786, 787, 789,
+	786, 789, 788,
+	788, 789, 791,
+	788, 791, 790,
+	790, 791, 793,
+	790, 793, 792,
+	792, 793, 795,
+	792, 795, 794,
+	794, 795, 797,
+	794, 797, 796,
+	796, 797, 799,
+	796, 799, 798,
+	798, 799, 801,
+	798, 801, 800,
+	800, 801, 803,
+	800, 803, 802,
+	802, 803, 805,
+	802, 805, 804,
+	804, 805, 807,
+	804, 807, 806,
+	806, 807, 809,
+	806, 809, 808,
+	808, 809, 811,
+	808, 811, 810,
+	810, 811, 813,
+	810, 813, 812,
+	812, 813, 815,
+	812, 815, 814,
+	814, 815, 817,
+	814, 817, 816,
+	816, 817, 819,
+	816, 819, 818,
+	820, 821, 823,
+	820, 823, 822,
+	822, 823, 825,
+	822, 825, 824,
+	824, 825, 827,
+	824, 827, 826,
+	826, 827, 829,
+	826, 829, 828,
+	828, 829, 831,
+	828, 831, 830,
+	830, 831, 833,
+	830, 833, 832,
+	832, 833, 835,
+	832, 835, 834,
+	834, 835, 837,
+	834, 837, 836,
+	836, 837, 839,
+	836, 839, 838,
+	838, 839, 841,
+	838, 841, 840,
+	840, 841, 843,
+	840, 843, 842,
+	842, 843, 845,
+	842, 845, 844,
+	844, 845, 847,
+	844, 847, 846,
+	846, 847, 849,
+	846, 849, 848,
+	848, 849, 851,
+	848, 851, 850,
+	850, 851, 853,
+	850, 853, 852,
+	852, 853, 855,
+	852, 855, 854,
+	854, 855, 857,
+	854, 857, 856,
+	856, 857, 859,
+	856, 859, 858,
+	858, 859, 861,
+	858, 861, 860,
+	860, 861, 863,
+	860, 863, 862,
+	862, 863, 865,
+	862, 865, 864,
+	864, 865, 867,
+	864, 867, 866,
+	866, 867, 869,
+	866, 869, 868,
+	868, 869, 871,
+	868, 871, 870,
+	870, 871, 873,
+	870, 873, 872,
+	872, 873, 875,
+	872, 875, 874,
+	874, 875, 877,
+	874, 877, 876,
+	876, 877, 879,
+	876, 879, 878,
+	878, 879, 881,
+	878, 881, 880,
+	880, 881, 883,
+	880, 883, 882,
+	882, 883, 885,
+	882, 885, 884,
+	884, 885, 887,
+	884, 887, 886,
+	886, 887, 889,
+	886, 889, 888,
+	888, 889, 891,
+	888, 891, 890,
+	890, 891, 893,
+	890, 893, 892,
+	892, 893, 895,
+	892, 895, 894,
+	894, 895, 897,
+	894, 897, 896,
+	896, 897, 899,
+	896, 899, 898,
+	898, 899, 901,
+	898, 901, 900,
+	902, 903, 905,
+	902, 905, 904,
+	904, 905, 907,
+	904, 907, 906,
+	906, 907, 909,
+	906, 909, 908,
+	908, 909, 911,
+	908, 911, 910,
+	910, 911, 913,
+	910, 913, 912,
+	912, 913, 915,
+	912, 915, 914,
+	914, 915, 917,
+	914, 917, 916,
+	916, 917, 919,
+	916, 919, 918,
+	918, 919, 921,
+	918, 921, 920,
+	920, 921, 923,
+	920, 923, 922,
+	922, 923, 925,
+	922, 925, 924,
+	924, 925, 927,
+	924, 927, 926,
+	926, 927, 929,
+	926, 929, 928,
+	928, 929, 931,
+	928, 931, 930,
+	930, 931, 933,
+	930, 933, 932,
+	932, 933, 935,
+	932, 935, 934,
+	934, 935, 937,
+	934, 937, 936,
+	936, 937, 939,
+	936, 939, 938,
+	938, 939, 941,
+	938, 941, 940,
+	940, 941, 943,
+	940, 943, 942,
+	942, 943, 945,
+	942, 945, 944,
+	944, 945, 947,
+	944, 947, 946,
+	946, 947, 949,
+	946, 949, 948,
+	948, 949, 951,
+	948, 951, 950,
+	950, 951, 953,
+	950, 953, 952,
+	952, 953, 955,
+	952, 955, 954,
+	954, 955, 957,
+	954, 957, 956,
+	956, 957, 959,
+	956, 959, 958,
+	958, 959, 961,
+	958, 961, 960,
+	960, 961, 963,
+	960, 963, 962,
+	962, 963, 965,
+	962, 965, 964,
+	964, 965, 967,
+	964, 967, 966,
+	966, 967, 969,
+	966, 969, 968,
+	968, 969, 971,
+	968, 971, 970,
+	970, 971, 973,
+	970, 973, 972,
+	972, 973, 975,
+	972, 975, 974,
+	974, 975, 977,
+	974, 977, 976,
+	976, 977, 979,
+	976, 979, 978,
+	978, 979, 981,
+	978, 981, 980,
+	980, 981, 983,
+	980, 983, 982,
+	984, 985, 987,
+	984, 987, 986,
+	986, 987, 989,
+	986, 989, 988,
+	988, 989, 991,
+	988, 991, 990,
+	990, 991, 993,
+	990, 993, 992,
+	992, 993, 995,
+	992, 995, 994,
+	994, 995, 997,
+	994, 997, 996,
+	996, 997, 999,
+	996, 999, 998,
+	998, 999, 1001,
+	998, 1001, 1000,
+	1000, 1001, 1003,
+	1000, 1003, 1002,
+	1002, 1003, 1005,
+	1002, 1005, 1004,
+	1004, 1005, 1007,
+	1004, 1007, 1006,
+	1006, 1007, 1009,
+	1006, 1009, 1008,
+	1008, 1009, 1011,
+	1008, 1011, 1010,
+	1010, 1011, 1013,
+	1010, 1013, 1012,
+	1012, 1013, 1015,
+	1012, 1015, 1014,
+	1014, 1015, 1017,
+	1014, 1017, 1016,
+	1016, 1017, 1019,
+	1016, 1019, 1018,
+	1018, 1019, 1021,
+	1018, 1021, 1020,
+	1020, 1021, 1023,
+	1020, 1023, 1022,
+	1022, 1023, 1025,
+	1022, 1025, 1024,
+	1024, 1025, 1027,
+	1024, 1027, 1026,
+	1026, 1027, 1029,
+	1026, 1029, 1028,
+	1028, 1029, 1031,
+	1028, 1031, 1030,
+	1030, 1031, 1033,
+	1030, 1033, 1032,
+	1032, 1033, 1035,
+	1032, 1035, 1034,
+	1034, 1035, 1037,
+	1034, 1037, 1036,
+	1036, 1037, 1039,
+	1036, 1039, 1038,
+	1038, 1039, 1041,
+	1038, 1041, 1040,
+	1040, 1041, 1043,
+	1040, 1043, 1042,
+	1042, 1043, 1045,
+	1042, 1045, 1044,
+	1044, 1045, 1047,
+	1044, 1047, 1046,
+	1046, 1047, 1049,
+	1046, 1049, 1048,
+	1048, 1049, 1051,
+	1048, 1051, 1050,
+	1050, 1051, 1053,
+	1050, 1053, 1052,
+	1052, 1053, 1055,
+	1052, 1055, 1054,
+	1054, 1055, 1057,
+	1054, 1057, 1056,
+	1056, 1057, 1059,
+	1056, 1059, 1058,
+	1058, 1059, 1061,
+	1058, 1061, 1060,
+	1060, 1061, 1063,
+	1060, 1063, 1062,
+	1062, 1063, 1065,
+	1062, 1065, 1064,
+};
+
+echo_mesh limb_mesh = ECHO_LOD_MESH(limb_vertices, limb_indices, 0.075f, 6, &limb_lod1_mesh);
+#endif
+
 void draw_limb()
 {
 #ifndef ECHO_NDS
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.075f, -0.000f, 0.000f);
-		glVertex3f(0.065f, -0.000f, 0.037f);
-		glVertex3f(0.075f, -0.010f, 0.000f);
-		glVertex3f(0.065f, -0.010f, 0.037f);
-		glVertex3f(0.075f, -0.020f, 0.000f);
-		glVertex3f(0.065f, -0.020f, 0.037f);
-		glVertex3f(0.075f, -0.030f, 0.000f);
-		glVertex3f(0.065f, -0.030f, 0.037f);
-		glVertex3f(0.074f, -0.040f, 0.000f);
-		glVertex3f(0.064f, -0.040f, 0.037f);
-		glVertex3f(0.074f, -0.050f, 0.000f);
-		glVertex3f(0.064f, -0.050f, 0.037f);
-		glVertex3f(0.074f, -0.060f, 0.000f);
-		glVertex3f(0.064f, -0.060f, 0.037f);
-		glVertex3f(0.074f, -0.070f, 0.000f);
-		glVertex3f(0.064f, -0.070f, 0.037f);
-		glVertex3f(0.074f, -0.080f, 0.000f);
-		glVertex3f(0.064f, -0.080f, 0.037f);
-		glVertex3f(0.074f, -0.090f, 0.000f);
-		glVertex3f(0.064f, -0.090f, 0.037f);
-		glVertex3f(0.074f, -0.100f, 0.000f);
-		glVertex3f(0.064f, -0.100f, 0.037f);
-		glVertex3f(0.073f, -0.110f, 0.000f);
-		glVertex3f(0.064f, -0.110f, 0.037f);
-		glVertex3f(0.073f, -0.120f, 0.000f);
-		glVertex3f(0.063f, -0.120f, 0.037f);
-		glVertex3f(0.073f, -0.130f, 0.000f);
-		glVertex3f(0.063f, -0.130f, 0.037f);
-		glVertex3f(0.073f, -0.140f, 0.000f);
-		glVertex3f(0.063f, -0.140f, 0.036f);
-		glVertex3f(0.073f, -0.150f, 0.000f);
-		glVertex3f(0.063f, -0.150f, 0.036f);
-		glVertex3f(0.073f, -0.160f, 0.000f);
-		glVertex3f(0.063f, -0.160f, 0.036f);
-		glVertex3f(0.072f, -0.170f, 0.000f);
-		glVertex3f(0.063f, -0.170f, 0.036f);
-		glVertex3f(0.072f, -0.180f, 0.000f);
-		glVertex3f(0.063f, -0.180f, 0.036f);
-		glVertex3f(0.072f, -0.190f, 0.000f);
-		glVertex3f(0.062f, -0.190f, 0.036f);
-		glVertex3f(0.072f, -0.200f, 0.000f);
-		glVertex3f(0.062f, -0.200f, 0.036f);
-		glVertex3f(0.072f, -0.210f, 0.000f);
-		glVertex3f(0.062f, -0.210f, 0.036f);
-		glVertex3f(0.072f, -0.220f, 0.000f);
-		glVertex3f(0.062f, -0.220f, 0.036f);
-		glVertex3f(0.072f, -0.230f, 0.000f);
-		glVertex3f(0.062f, -0.230f, 0.036f);
-		glVertex3f(0.071f, -0.240f, 0.000f);
-		glVertex3f(0.062f, -0.240f, 0.036f);
-		glVertex3f(0.071f, -0.250f, 0.000f);
-		glVertex3f(0.062f, -0.250f, 0.036f);
-		glVertex3f(0.071f, -0.260f, 0.000f);
-		glVertex3f(0.062f, -0.260f, 0.036f);
-		glVertex3f(0.071f, -0.270f, 0.000f);
-		glVertex3f(0.061f, -0.270f, 0.035f);
-		glVertex3f(0.071f, -0.280f, 0.000f);
-		glVertex3f(0.061f, -0.280f, 0.035f);
-		glVertex3f(0.071f, -0.290f, 0.000f);
-		glVertex3f(0.061f, -0.290f, 0.035f);
-		glVertex3f(0.071f, -0.300f, 0.000f);
-		glVertex3f(0.061f, -0.300f, 0.035f);
-		glVertex3f(0.070f, -0.310f, 0.000f);
-		glVertex3f(0.061f, -0.310f, 0.035f);
-		glVertex3f(0.070f, -0.320f, 0.000f);
-		glVertex3f(0.061f, -0.320f, 0.035f);
-		glVertex3f(0.070f, -0.330f, 0.000f);
-		glVertex3f(0.061f, -0.330f, 0.035f);
-		glVertex3f(0.070f, -0.340f, 0.000f);
-		glVertex3f(0.061f, -0.340f, 0.035f);
-		glVertex3f(0.070f, -0.350f, 0.000f);
-		glVertex3f(0.060f, -0.350f, 0.035f);
-		glVertex3f(0.070f, -0.360f, 0.000f);
-		glVertex3f(0.060f, -0.360f, 0.035f);
-		glVertex3f(0.069f, -0.370f, 0.000f);
-		glVertex3f(0.060f, -0.370f, 0.035f);
-		glVertex3f(0.069f, -0.380f, 0.000f);
-		glVertex3f(0.060f, -0.380f, 0.035f);
-		glVertex3f(0.069f, -0.390f, 0.000f);
-		glVertex3f(0.060f, -0.390f, 0.035f);
-		glVertex3f(0.069f, -0.400f, 0.000f);
-		glVertex3f(0.060f, -0.400f, 0.034f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.065f, -0.000f, 0.037f);
-		glVertex3f(0.038f, -0.000f, 0.065f);
-		glVertex3f(0.065f, -0.010f, 0.037f);
-		glVertex3f(0.037f, -0.010f, 0.065f);
-		glVertex3f(0.065f, -0.020f, 0.037f);
-		glVertex3f(0.037f, -0.020f, 0.065f);
-		glVertex3f(0.065f, -0.030f, 0.037f);
-		glVertex3f(0.037f, -0.030f, 0.065f);
-		glVertex3f(0.064f, -0.040f, 0.037f);
-		glVertex3f(0.037f, -0.040f, 0.064f);
-		glVertex3f(0.064f, -0.050f, 0.037f);
-		glVertex3f(0.037f, -0.050f, 0.064f);
-		glVertex3f(0.064f, -0.060f, 0.037f);
-		glVertex3f(0.037f, -0.060f, 0.064f);
-		glVertex3f(0.064f, -0.070f, 0.037f);
-		glVertex3f(0.037f, -0.070f, 0.064f);
-		glVertex3f(0.064f, -0.080f, 0.037f);
-		glVertex3f(0.037f, -0.080f, 0.064f);
-		glVertex3f(0.064f, -0.090f, 0.037f);
-		glVertex3f(0.037f, -0.090f, 0.064f);
-		glVertex3f(0.064f, -0.100f, 0.037f);
-		glVertex3f(0.037f, -0.100f, 0.064f);
-		glVertex3f(0.064f, -0.110f, 0.037f);
-		glVertex3f(0.037f, -0.110f, 0.064f);
-		glVertex3f(0.063f, -0.120f, 0.037f);
-		glVertex3f(0.037f, -0.120f, 0.063f);
-		glVertex3f(0.063f, -0.130f, 0.037f);
-		glVertex3f(0.037f, -0.130f, 0.063f);
-		glVertex3f(0.063f, -0.140f, 0.036f);
-		glVertex3f(0.036f, -0.140f, 0.063f);
-		glVertex3f(0.063f, -0.150f, 0.036f);
-		glVertex3f(0.036f, -0.150f, 0.063f);
-		glVertex3f(0.063f, -0.160f, 0.036f);
-		glVertex3f(0.036f, -0.160f, 0.063f);
-		glVertex3f(0.063f, -0.170f, 0.036f);
-		glVertex3f(0.036f, -0.170f, 0.063f);
-		glVertex3f(0.063f, -0.180f, 0.036f);
-		glVertex3f(0.036f, -0.180f, 0.063f);
-		glVertex3f(0.062f, -0.190f, 0.036f);
-		glVertex3f(0.036f, -0.190f, 0.062f);
-		glVertex3f(0.062f, -0.200f, 0.036f);
-		glVertex3f(0.036f, -0.200f, 0.062f);
-		glVertex3f(0.062f, -0.210f, 0.036f);
-		glVertex3f(0.036f, -0.210f, 0.062f);
-		glVertex3f(0.062f, -0.220f, 0.036f);
-		glVertex3f(0.036f, -0.220f, 0.062f);
-		glVertex3f(0.062f, -0.230f, 0.036f);
-		glVertex3f(0.036f, -0.230f, 0.062f);
-		glVertex3f(0.062f, -0.240f, 0.036f);
-		glVertex3f(0.036f, -0.240f, 0.062f);
-		glVertex3f(0.062f, -0.250f, 0.036f);
-		glVertex3f(0.036f, -0.250f, 0.062f);
-		glVertex3f(0.062f, -0.260f, 0.036f);
-		glVertex3f(0.036f, -0.260f, 0.062f);
-		glVertex3f(0.061f, -0.270f, 0.035f);
-		glVertex3f(0.035f, -0.270f, 0.061f);
-		glVertex3f(0.061f, -0.280f, 0.035f);
-		glVertex3f(0.035f, -0.280f, 0.061f);
-		glVertex3f(0.061f, -0.290f, 0.035f);
-		glVertex3f(0.035f, -0.290f, 0.061f);
-		glVertex3f(0.061f, -0.300f, 0.035f);
-		glVertex3f(0.035f, -0.300f, 0.061f);
-		glVertex3f(0.061f, -0.310f, 0.035f);
-		glVertex3f(0.035f, -0.310f, 0.061f);
-		glVertex3f(0.061f, -0.320f, 0.035f);
-		glVertex3f(0.035f, -0.320f, 0.061f);
-		glVertex3f(0.061f, -0.330f, 0.035f);
-		glVertex3f(0.035f, -0.330f, 0.061f);
-		glVertex3f(0.061f, -0.340f, 0.035f);
-		glVertex3f(0.035f, -0.340f, 0.061f);
-		glVertex3f(0.060f, -0.350f, 0.035f);
-		glVertex3f(0.035f, -0.350f, 0.060f);
-		glVertex3f(0.060f, -0.360f, 0.035f);
-		glVertex3f(0.035f, -0.360f, 0.060f);
-		glVertex3f(0.060f, -0.370f, 0.035f);
-		glVertex3f(0.035f, -0.370f, 0.060f);
-		glVertex3f(0.060f, -0.380f, 0.035f);
-		glVertex3f(0.035f, -0.380f, 0.060f);
-		glVertex3f(0.060f, -0.390f, 0.035f);
-		glVertex3f(0.035f, -0.390f, 0.060f);
-		glVertex3f(0.060f, -0.400f, 0.034f);
-		glVertex3f(0.035f, -0.400f, 0.060f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.038f, -0.000f, 0.065f);
-		glVertex3f(0.000f, -0.000f, 0.075f);
-		glVertex3f(0.037f, -0.010f, 0.065f);
-		glVertex3f(0.000f, -0.010f, 0.075f);
-		glVertex3f(0.037f, -0.020f, 0.065f);
-		glVertex3f(0.000f, -0.020f, 0.075f);
-		glVertex3f(0.037f, -0.030f, 0.065f);
-		glVertex3f(0.000f, -0.030f, 0.075f);
-		glVertex3f(0.037f, -0.040f, 0.064f);
-		glVertex3f(0.000f, -0.040f, 0.074f);
-		glVertex3f(0.037f, -0.050f, 0.064f);
-		glVertex3f(0.000f, -0.050f, 0.074f);
-		glVertex3f(0.037f, -0.060f, 0.064f);
-		glVertex3f(0.000f, -0.060f, 0.074f);
-		glVertex3f(0.037f, -0.070f, 0.064f);
-		glVertex3f(0.000f, -0.070f, 0.074f);
-		glVertex3f(0.037f, -0.080f, 0.064f);
-		glVertex3f(0.000f, -0.080f, 0.074f);
-		glVertex3f(0.037f, -0.090f, 0.064f);
-		glVertex3f(0.000f, -0.090f, 0.074f);
-		glVertex3f(0.037f, -0.100f, 0.064f);
-		glVertex3f(0.000f, -0.100f, 0.074f);
-		glVertex3f(0.037f, -0.110f, 0.064f);
-		glVertex3f(0.000f, -0.110f, 0.073f);
-		glVertex3f(0.037f, -0.120f, 0.063f);
-		glVertex3f(0.000f, -0.120f, 0.073f);
-		glVertex3f(0.037f, -0.130f, 0.063f);
-		glVertex3f(0.000f, -0.130f, 0.073f);
-		glVertex3f(0.036f, -0.140f, 0.063f);
-		glVertex3f(0.000f, -0.140f, 0.073f);
-		glVertex3f(0.036f, -0.150f, 0.063f);
-		glVertex3f(0.000f, -0.150f, 0.073f);
-		glVertex3f(0.036f, -0.160f, 0.063f);
-		glVertex3f(0.000f, -0.160f, 0.073f);
-		glVertex3f(0.036f, -0.170f, 0.063f);
-		glVertex3f(0.000f, -0.170f, 0.072f);
-		glVertex3f(0.036f, -0.180f, 0.063f);
-		glVertex3f(0.000f, -0.180f, 0.072f);
-		glVertex3f(0.036f, -0.190f, 0.062f);
-		glVertex3f(0.000f, -0.190f, 0.072f);
-		glVertex3f(0.036f, -0.200f, 0.062f);
-		glVertex3f(0.000f, -0.200f, 0.072f);
-		glVertex3f(0.036f, -0.210f, 0.062f);
-		glVertex3f(0.000f, -0.210f, 0.072f);
-		glVertex3f(0.036f, -0.220f, 0.062f);
-		glVertex3f(0.000f, -0.220f, 0.072f);
-		glVertex3f(0.036f, -0.230f, 0.062f);
-		glVertex3f(0.000f, -0.230f, 0.072f);
-		glVertex3f(0.036f, -0.240f, 0.062f);
-		glVertex3f(0.000f, -0.240f, 0.071f);
-		glVertex3f(0.036f, -0.250f, 0.062f);
-		glVertex3f(0.000f, -0.250f, 0.071f);
-		glVertex3f(0.036f, -0.260f, 0.062f);
-		glVertex3f(0.000f, -0.260f, 0.071f);
-		glVertex3f(0.035f, -0.270f, 0.061f);
-		glVertex3f(0.000f, -0.270f, 0.071f);
-		glVertex3f(0.035f, -0.280f, 0.061f);
-		glVertex3f(0.000f, -0.280f, 0.071f);
-		glVertex3f(0.035f, -0.290f, 0.061f);
-		glVertex3f(0.000f, -0.290f, 0.071f);
-		glVertex3f(0.035f, -0.300f, 0.061f);
-		glVertex3f(0.000f, -0.300f, 0.071f);
-		glVertex3f(0.035f, -0.310f, 0.061f);
-		glVertex3f(0.000f, -0.310f, 0.070f);
-		glVertex3f(0.035f, -0.320f, 0.061f);
-		glVertex3f(0.000f, -0.320f, 0.070f);
-		glVertex3f(0.035f, -0.330f, 0.061f);
-		glVertex3f(0.000f, -0.330f, 0.070f);
-		glVertex3f(0.035f, -0.340f, 0.061f);
-		glVertex3f(0.000f, -0.340f, 0.070f);
-		glVertex3f(0.035f, -0.350f, 0.060f);
-		glVertex3f(0.000f, -0.350f, 0.070f);
-		glVertex3f(0.035f, -0.360f, 0.060f);
-		glVertex3f(0.000f, -0.360f, 0.070f);
-		glVertex3f(0.035f, -0.370f, 0.060f);
-		glVertex3f(0.000f, -0.370f, 0.069f);
-		glVertex3f(0.035f, -0.380f, 0.060f);
-		glVertex3f(0.000f, -0.380f, 0.069f);
-		glVertex3f(0.035f, -0.390f, 0.060f);
-		glVertex3f(0.000f, -0.390f, 0.069f);
-		glVertex3f(0.035f, -0.400f, 0.060f);
-		glVertex3f(0.000f, -0.400f, 0.069f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, -0.000f, 0.075f);
-		glVertex3f(-0.037f, -0.000f, 0.065f);
-		glVertex3f(0.000f, -0.010f, 0.075f);
-		glVertex3f(-0.037f, -0.010f, 0.065f);
-		glVertex3f(0.000f, -0.020f, 0.075f);
-		glVertex3f(-0.037f, -0.020f, 0.065f);
-		glVertex3f(0.000f, -0.030f, 0.075f);
-		glVertex3f(-0.037f, -0.030f, 0.065f);
-		glVertex3f(0.000f, -0.040f, 0.074f);
-		glVertex3f(-0.037f, -0.040f, 0.064f);
-		glVertex3f(0.000f, -0.050f, 0.074f);
-		glVertex3f(-0.037f, -0.050f, 0.064f);
-		glVertex3f(0.000f, -0.060f, 0.074f);
-		glVertex3f(-0.037f, -0.060f, 0.064f);
-		glVertex3f(0.000f, -0.070f, 0.074f);
-		glVertex3f(-0.037f, -0.070f, 0.064f);
-		glVertex3f(0.000f, -0.080f, 0.074f);
-		glVertex3f(-0.037f, -0.080f, 0.064f);
-		glVertex3f(0.000f, -0.090f, 0.074f);
-		glVertex3f(-0.037f, -0.090f, 0.064f);
-		glVertex3f(0.000f, -0.100f, 0.074f);
-		glVertex3f(-0.037f, -0.100f, 0.064f);
-		glVertex3f(0.000f, -0.110f, 0.073f);
-		glVertex3f(-0.037f, -0.110f, 0.064f);
-		glVertex3f(0.000f, -0.120f, 0.073f);
-		glVertex3f(-0.037f, -0.120f, 0.063f);
-		glVertex3f(0.000f, -0.130f, 0.073f);
-		glVertex3f(-0.037f, -0.130f, 0.063f);
-		glVertex3f(0.000f, -0.140f, 0.073f);
-		glVertex3f(-0.036f, -0.140f, 0.063f);
-		glVertex3f(0.000f, -0.150f, 0.073f);
-		glVertex3f(-0.036f, -0.150f, 0.063f);
-		glVertex3f(0.000f, -0.160f, 0.073f);
-		glVertex3f(-0.036f, -0.160f, 0.063f);
-		glVertex3f(0.000f, -0.170f, 0.072f);
-		glVertex3f(-0.036f, -0.170f, 0.063f);
-		glVertex3f(0.000f, -0.180f, 0.072f);
-		glVertex3f(-0.036f, -0.180f, 0.063f);
-		glVertex3f(0.000f, -0.190f, 0.072f);
-		glVertex3f(-0.036f, -0.190f, 0.062f);
-		glVertex3f(0.000f, -0.200f, 0.072f);
-		glVertex3f(-0.036f, -0.200f, 0.062f);
-		glVertex3f(0.000f, -0.210f, 0.072f);
-		glVertex3f(-0.036f, -0.210f, 0.062f);
-		glVertex3f(0.000f, -0.220f, 0.072f);
-		glVertex3f(-0.036f, -0.220f, 0.062f);
-		glVertex3f(0.000f, -0.230f, 0.072f);
-		glVertex3f(-0.036f, -0.230f, 0.062f);
-		glVertex3f(0.000f, -0.240f, 0.071f);
-		glVertex3f(-0.036f, -0.240f, 0.062f);
-		glVertex3f(0.000f, -0.250f, 0.071f);
-		glVertex3f(-0.036f, -0.250f, 0.062f);
-		glVertex3f(0.000f, -0.260f, 0.071f);
-		glVertex3f(-0.036f, -0.260f, 0.062f);
-		glVertex3f(0.000f, -0.270f, 0.071f);
-		glVertex3f(-0.035f, -0.270f, 0.061f);
-		glVertex3f(0.000f, -0.280f, 0.071f);
-		glVertex3f(-0.035f, -0.280f, 0.061f);
-		glVertex3f(0.000f, -0.290f, 0.071f);
-		glVertex3f(-0.035f, -0.290f, 0.061f);
-		glVertex3f(0.000f, -0.300f, 0.071f);
-		glVertex3f(-0.035f, -0.300f, 0.061f);
-		glVertex3f(0.000f, -0.310f, 0.070f);
-		glVertex3f(-0.035f, -0.310f, 0.061f);
-		glVertex3f(0.000f, -0.320f, 0.070f);
-		glVertex3f(-0.035f, -0.320f, 0.061f);
-		glVertex3f(0.000f, -0.330f, 0.070f);
-		glVertex3f(-0.035f, -0.330f, 0.061f);
-		glVertex3f(0.000f, -0.340f, 0.070f);
-		glVertex3f(-0.035f, -0.340f, 0.061f);
-		glVertex3f(0.000f, -0.350f, 0.070f);
-		glVertex3f(-0.035f, -0.350f, 0.060f);
-		glVertex3f(0.000f, -0.360f, 0.070f);
-		glVertex3f(-0.035f, -0.360f, 0.060f);
-		glVertex3f(0.000f, -0.370f, 0.069f);
-		glVertex3f(-0.035f, -0.370f, 0.060f);
-		glVertex3f(0.000f, -0.380f, 0.069f);
-		glVertex3f(-0.035f, -0.380f, 0.060f);
-		glVertex3f(0.000f, -0.390f, 0.069f);
-		glVertex3f(-0.035f, -0.390f, 0.060f);
-		glVertex3f(0.000f, -0.400f, 0.069f);
-		glVertex3f(-0.034f, -0.400f, 0.060f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.037f, -0.000f, 0.065f);
-		glVertex3f(-0.065f, -0.000f, 0.038f);
-		glVertex3f(-0.037f, -0.010f, 0.065f);
-		glVertex3f(-0.065f, -0.010f, 0.037f);
-		glVertex3f(-0.037f, -0.020f, 0.065f);
-		glVertex3f(-0.065f, -0.020f, 0.037f);
-		glVertex3f(-0.037f, -0.030f, 0.065f);
-		glVertex3f(-0.065f, -0.030f, 0.037f);
-		glVertex3f(-0.037f, -0.040f, 0.064f);
-		glVertex3f(-0.064f, -0.040f, 0.037f);
-		glVertex3f(-0.037f, -0.050f, 0.064f);
-		glVertex3f(-0.064f, -0.050f, 0.037f);
-		glVertex3f(-0.037f, -0.060f, 0.064f);
-		glVertex3f(-0.064f, -0.060f, 0.037f);
-		glVertex3f(-0.037f, -0.070f, 0.064f);
-		glVertex3f(-0.064f, -0.070f, 0.037f);
-		glVertex3f(-0.037f, -0.080f, 0.064f);
-		glVertex3f(-0.064f, -0.080f, 0.037f);
-		glVertex3f(-0.037f, -0.090f, 0.064f);
-		glVertex3f(-0.064f, -0.090f, 0.037f);
-		glVertex3f(-0.037f, -0.100f, 0.064f);
-		glVertex3f(-0.064f, -0.100f, 0.037f);
-		glVertex3f(-0.037f, -0.110f, 0.064f);
-		glVertex3f(-0.064f, -0.110f, 0.037f);
-		glVertex3f(-0.037f, -0.120f, 0.063f);
-		glVertex3f(-0.063f, -0.120f, 0.037f);
-		glVertex3f(-0.037f, -0.130f, 0.063f);
-		glVertex3f(-0.063f, -0.130f, 0.037f);
-		glVertex3f(-0.036f, -0.140f, 0.063f);
-		glVertex3f(-0.063f, -0.140f, 0.036f);
-		glVertex3f(-0.036f, -0.150f, 0.063f);
-		glVertex3f(-0.063f, -0.150f, 0.036f);
-		glVertex3f(-0.036f, -0.160f, 0.063f);
-		glVertex3f(-0.063f, -0.160f, 0.036f);
-		glVertex3f(-0.036f, -0.170f, 0.063f);
-		glVertex3f(-0.063f, -0.170f, 0.036f);
-		glVertex3f(-0.036f, -0.180f, 0.063f);
-		glVertex3f(-0.063f, -0.180f, 0.036f);
-		glVertex3f(-0.036f, -0.190f, 0.062f);
-		glVertex3f(-0.062f, -0.190f, 0.036f);
-		glVertex3f(-0.036f, -0.200f, 0.062f);
-		glVertex3f(-0.062f, -0.200f, 0.036f);
-		glVertex3f(-0.036f, -0.210f, 0.062f);
-		glVertex3f(-0.062f, -0.210f, 0.036f);
-		glVertex3f(-0.036f, -0.220f, 0.062f);
-		glVertex3f(-0.062f, -0.220f, 0.036f);
-		glVertex3f(-0.036f, -0.230f, 0.062f);
-		glVertex3f(-0.062f, -0.230f, 0.036f);
-		glVertex3f(-0.036f, -0.240f, 0.062f);
-		glVertex3f(-0.062f, -0.240f, 0.036f);
-		glVertex3f(-0.036f, -0.250f, 0.062f);
-		glVertex3f(-0.062f, -0.250f, 0.036f);
-		glVertex3f(-0.036f, -0.260f, 0.062f);
-		glVertex3f(-0.062f, -0.260f, 0.036f);
-		glVertex3f(-0.035f, -0.270f, 0.061f);
-		glVertex3f(-0.061f, -0.270f, 0.035f);
-		glVertex3f(-0.035f, -0.280f, 0.061f);
-		glVertex3f(-0.061f, -0.280f, 0.035f);
-		glVertex3f(-0.035f, -0.290f, 0.061f);
-		glVertex3f(-0.061f, -0.290f, 0.035f);
-		glVertex3f(-0.035f, -0.300f, 0.061f);
-		glVertex3f(-0.061f, -0.300f, 0.035f);
-		glVertex3f(-0.035f, -0.310f, 0.061f);
-		glVertex3f(-0.061f, -0.310f, 0.035f);
-		glVertex3f(-0.035f, -0.320f, 0.061f);
-		glVertex3f(-0.061f, -0.320f, 0.035f);
-		glVertex3f(-0.035f, -0.330f, 0.061f);
-		glVertex3f(-0.061f, -0.330f, 0.035f);
-		glVertex3f(-0.035f, -0.340f, 0.061f);
-		glVertex3f(-0.061f, -0.340f, 0.035f);
-		glVertex3f(-0.035f, -0.350f, 0.060f);
-		glVertex3f(-0.060f, -0.350f, 0.035f);
-		glVertex3f(-0.035f, -0.360f, 0.060f);
-		glVertex3f(-0.060f, -0.360f, 0.035f);
-		glVertex3f(-0.035f, -0.370f, 0.060f);
-		glVertex3f(-0.060f, -0.370f, 0.035f);
-		glVertex3f(-0.035f, -0.380f, 0.060f);
-		glVertex3f(-0.060f, -0.380f, 0.035f);
-		glVertex3f(-0.035f, -0.390f, 0.060f);
-		glVertex3f(-0.060f, -0.390f, 0.035f);
-		glVertex3f(-0.034f, -0.400f, 0.060f);
-		glVertex3f(-0.060f, -0.400f, 0.035f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.065f, -0.000f, 0.038f);
-		glVertex3f(-0.075f, -0.000f, 0.000f);
-		glVertex3f(-0.065f, -0.010f, 0.037f);
-		glVertex3f(-0.075f, -0.010f, 0.000f);
-		glVertex3f(-0.065f, -0.020f, 0.037f);
-		glVertex3f(-0.075f, -0.020f, 0.000f);
-		glVertex3f(-0.065f, -0.030f, 0.037f);
-		glVertex3f(-0.075f, -0.030f, 0.000f);
-		glVertex3f(-0.064f, -0.040f, 0.037f);
-		glVertex3f(-0.074f, -0.040f, 0.000f);
-		glVertex3f(-0.064f, -0.050f, 0.037f);
-		glVertex3f(-0.074f, -0.050f, 0.000f);
-		glVertex3f(-0.064f, -0.060f, 0.037f);
-		glVertex3f(-0.074f, -0.060f, 0.000f);
-		glVertex3f(-0.064f, -0.070f, 0.037f);
-		glVertex3f(-0.074f, -0.070f, 0.000f);
-		glVertex3f(-0.064f, -0.080f, 0.037f);
-		glVertex3f(-0.074f, -0.080f, 0.000f);
-		glVertex3f(-0.064f, -0.090f, 0.037f);
-		glVertex3f(-0.074f, -0.090f, 0.000f);
-		glVertex3f(-0.064f, -0.100f, 0.037f);
-		glVertex3f(-0.074f, -0.100f, 0.000f);
-		glVertex3f(-0.064f, -0.110f, 0.037f);
-		glVertex3f(-0.073f, -0.110f, 0.000f);
-		glVertex3f(-0.063f, -0.120f, 0.037f);
-		glVertex3f(-0.073f, -0.120f, 0.000f);
-		glVertex3f(-0.063f, -0.130f, 0.037f);
-		glVertex3f(-0.073f, -0.130f, 0.000f);
-		glVertex3f(-0.063f, -0.140f, 0.036f);
-		glVertex3f(-0.073f, -0.140f, 0.000f);
-		glVertex3f(-0.063f, -0.150f, 0.036f);
-		glVertex3f(-0.073f, -0.150f, 0.000f);
-		glVertex3f(-0.063f, -0.160f, 0.036f);
-		glVertex3f(-0.073f, -0.160f, 0.000f);
-		glVertex3f(-0.063f, -0.170f, 0.036f);
-		glVertex3f(-0.072f, -0.170f, 0.000f);
-		glVertex3f(-0.063f, -0.180f, 0.036f);
-		glVertex3f(-0.072f, -0.180f, 0.000f);
-		glVertex3f(-0.062f, -0.190f, 0.036f);
-		glVertex3f(-0.072f, -0.190f, 0.000f);
-		glVertex3f(-0.062f, -0.200f, 0.036f);
-		glVertex3f(-0.072f, -0.200f, 0.000f);
-		glVertex3f(-0.062f, -0.210f, 0.036f);
-		glVertex3f(-0.072f, -0.210f, 0.000f);
-		glVertex3f(-0.062f, -0.220f, 0.036f);
-		glVertex3f(-0.072f, -0.220f, 0.000f);
-		glVertex3f(-0.062f, -0.230f, 0.036f);
-		glVertex3f(-0.072f, -0.230f, 0.000f);
-		glVertex3f(-0.062f, -0.240f, 0.036f);
-		glVertex3f(-0.071f, -0.240f, 0.000f);
-		glVertex3f(-0.062f, -0.250f, 0.036f);
-		glVertex3f(-0.071f, -0.250f, 0.000f);
-		glVertex3f(-0.062f, -0.260f, 0.036f);
-		glVertex3f(-0.071f, -0.260f, 0.000f);
-		glVertex3f(-0.061f, -0.270f, 0.035f);
-		glVertex3f(-0.071f, -0.270f, 0.000f);
-		glVertex3f(-0.061f, -0.280f, 0.035f);
-		glVertex3f(-0.071f, -0.280f, 0.000f);
-		glVertex3f(-0.061f, -0.290f, 0.035f);
-		glVertex3f(-0.071f, -0.290f, 0.000f);
-		glVertex3f(-0.061f, -0.300f, 0.035f);
-		glVertex3f(-0.071f, -0.300f, 0.000f);
-		glVertex3f(-0.061f, -0.310f, 0.035f);
-		glVertex3f(-0.070f, -0.310f, 0.000f);
-		glVertex3f(-0.061f, -0.320f, 0.035f);
-		glVertex3f(-0.070f, -0.320f, 0.000f);
-		glVertex3f(-0.061f, -0.330f, 0.035f);
-		glVertex3f(-0.070f, -0.330f, 0.000f);
-		glVertex3f(-0.061f, -0.340f, 0.035f);
-		glVertex3f(-0.070f, -0.340f, 0.000f);
-		glVertex3f(-0.060f, -0.350f, 0.035f);
-		glVertex3f(-0.070f, -0.350f, 0.000f);
-		glVertex3f(-0.060f, -0.360f, 0.035f);
-		glVertex3f(-0.070f, -0.360f, 0.000f);
-		glVertex3f(-0.060f, -0.370f, 0.035f);
-		glVertex3f(-0.069f, -0.370f, 0.000f);
-		glVertex3f(-0.060f, -0.380f, 0.035f);
-		glVertex3f(-0.069f, -0.380f, 0.000f);
-		glVertex3f(-0.060f, -0.390f, 0.035f);
-		glVertex3f(-0.069f, -0.390f, 0.000f);
-		glVertex3f(-0.060f, -0.400f, 0.035f);
-		glVertex3f(-0.069f, -0.400f, 0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.075f, -0.000f, 0.000f);
-		glVertex3f(-0.065f, -0.000f, -0.037f);
-		glVertex3f(-0.075f, -0.010f, 0.000f);
-		glVertex3f(-0.065f, -0.010f, -0.037f);
-		glVertex3f(-0.075f, -0.020f, 0.000f);
-		glVertex3f(-0.065f, -0.020f, -0.037f);
-		glVertex3f(-0.075f, -0.030f, 0.000f);
-		glVertex3f(-0.065f, -0.030f, -0.037f);
-		glVertex3f(-0.074f, -0.040f, 0.000f);
-		glVertex3f(-0.064f, -0.040f, -0.037f);
-		glVertex3f(-0.074f, -0.050f, 0.000f);
-		glVertex3f(-0.064f, -0.050f, -0.037f);
-		glVertex3f(-0.074f, -0.060f, 0.000f);
-		glVertex3f(-0.064f, -0.060f, -0.037f);
-		glVertex3f(-0.074f, -0.070f, 0.000f);
-		glVertex3f(-0.064f, -0.070f, -0.037f);
-		glVertex3f(-0.074f, -0.080f, 0.000f);
-		glVertex3f(-0.064f, -0.080f, -0.037f);
-		glVertex3f(-0.074f, -0.090f, 0.000f);
-		glVertex3f(-0.064f, -0.090f, -0.037f);
-		glVertex3f(-0.074f, -0.100f, 0.000f);
-		glVertex3f(-0.064f, -0.100f, -0.037f);
-		glVertex3f(-0.073f, -0.110f, 0.000f);
-		glVertex3f(-0.064f, -0.110f, -0.037f);
-		glVertex3f(-0.073f, -0.120f, 0.000f);
-		glVertex3f(-0.063f, -0.120f, -0.037f);
-		glVertex3f(-0.073f, -0.130f, 0.000f);
-		glVertex3f(-0.063f, -0.130f, -0.037f);
-		glVertex3f(-0.073f, -0.140f, 0.000f);
-		glVertex3f(-0.063f, -0.140f, -0.036f);
-		glVertex3f(-0.073f, -0.150f, 0.000f);
-		glVertex3f(-0.063f, -0.150f, -0.036f);
-		glVertex3f(-0.073f, -0.160f, 0.000f);
-		glVertex3f(-0.063f, -0.160f, -0.036f);
-		glVertex3f(-0.072f, -0.170f, 0.000f);
-		glVertex3f(-0.063f, -0.170f, -0.036f);
-		glVertex3f(-0.072f, -0.180f, 0.000f);
-		glVertex3f(-0.063f, -0.180f, -0.036f);
-		glVertex3f(-0.072f, -0.190f, 0.000f);
-		glVertex3f(-0.062f, -0.190f, -0.036f);
-		glVertex3f(-0.072f, -0.200f, 0.000f);
-		glVertex3f(-0.062f, -0.200f, -0.036f);
-		glVertex3f(-0.072f, -0.210f, 0.000f);
-		glVertex3f(-0.062f, -0.210f, -0.036f);
-		glVertex3f(-0.072f, -0.220f, 0.000f);
-		glVertex3f(-0.062f, -0.220f, -0.036f);
-		glVertex3f(-0.072f, -0.230f, 0.000f);
-		glVertex3f(-0.062f, -0.230f, -0.036f);
-		glVertex3f(-0.071f, -0.240f, 0.000f);
-		glVertex3f(-0.062f, -0.240f, -0.036f);
-		glVertex3f(-0.071f, -0.250f, 0.000f);
-		glVertex3f(-0.062f, -0.250f, -0.036f);
-		glVertex3f(-0.071f, -0.260f, 0.000f);
-		glVertex3f(-0.062f, -0.260f, -0.036f);
-		glVertex3f(-0.071f, -0.270f, 0.000f);
-		glVertex3f(-0.061f, -0.270f, -0.035f);
-		glVertex3f(-0.071f, -0.280f, 0.000f);
-		glVertex3f(-0.061f, -0.280f, -0.035f);
-		glVertex3f(-0.071f, -0.290f, 0.000f);
-		glVertex3f(-0.061f, -0.290f, -0.035f);
-		glVertex3f(-0.071f, -0.300f, 0.000f);
-		glVertex3f(-0.061f, -0.300f, -0.035f);
-		glVertex3f(-0.070f, -0.310f, 0.000f);
-		glVertex3f(-0.061f, -0.310f, -0.035f);
-		glVertex3f(-0.070f, -0.320f, 0.000f);
-		glVertex3f(-0.061f, -0.320f, -0.035f);
-		glVertex3f(-0.070f, -0.330f, 0.000f);
-		glVertex3f(-0.061f, -0.330f, -0.035f);
-		glVertex3f(-0.070f, -0.340f, 0.000f);
-		glVertex3f(-0.061f, -0.340f, -0.035f);
-		glVertex3f(-0.070f, -0.350f, 0.000f);
-		glVertex3f(-0.060f, -0.350f, -0.035f);
-		glVertex3f(-0.070f, -0.360f, 0.000f);
-		glVertex3f(-0.060f, -0.360f, -0.035f);
-		glVertex3f(-0.069f, -0.370f, 0.000f);
-		glVertex3f(-0.060f, -0.370f, -0.035f);
-		glVertex3f(-0.069f, -0.380f, 0.000f);
-		glVertex3f(-0.060f, -0.380f, -0.035f);
-		glVertex3f(-0.069f, -0.390f, 0.000f);
-		glVertex3f(-0.060f, -0.390f, -0.035f);
-		glVertex3f(-0.069f, -0.400f, 0.000f);
-		glVertex3f(-0.060f, -0.400f, -0.034f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.065f, -0.000f, -0.037f);
-		glVertex3f(-0.038f, -0.000f, -0.065f);
-		glVertex3f(-0.065f, -0.010f, -0.037f);
-		glVertex3f(-0.037f, -0.010f, -0.065f);
-		glVertex3f(-0.065f, -0.020f, -0.037f);
-		glVertex3f(-0.037f, -0.020f, -0.065f);
-		glVertex3f(-0.065f, -0.030f, -0.037f);
-		glVertex3f(-0.037f, -0.030f, -0.065f);
-		glVertex3f(-0.064f, -0.040f, -0.037f);
-		glVertex3f(-0.037f, -0.040f, -0.064f);
-		glVertex3f(-0.064f, -0.050f, -0.037f);
-		glVertex3f(-0.037f, -0.050f, -0.064f);
-		glVertex3f(-0.064f, -0.060f, -0.037f);
-		glVertex3f(-0.037f, -0.060f, -0.064f);
-		glVertex3f(-0.064f, -0.070f, -0.037f);
-		glVertex3f(-0.037f, -0.070f, -0.064f);
-		glVertex3f(-0.064f, -0.080f, -0.037f);
-		glVertex3f(-0.037f, -0.080f, -0.064f);
-		glVertex3f(-0.064f, -0.090f, -0.037f);
-		glVertex3f(-0.037f, -0.090f, -0.064f);
-		glVertex3f(-0.064f, -0.100f, -0.037f);
-		glVertex3f(-0.037f, -0.100f, -0.064f);
-		glVertex3f(-0.064f, -0.110f, -0.037f);
-		glVertex3f(-0.037f, -0.110f, -0.064f);
-		glVertex3f(-0.063f, -0.120f, -0.037f);
-		glVertex3f(-0.037f, -0.120f, -0.063f);
-		glVertex3f(-0.063f, -0.130f, -0.037f);
-		glVertex3f(-0.037f, -0.130f, -0.063f);
-		glVertex3f(-0.063f, -0.140f, -0.036f);
-		glVertex3f(-0.036f, -0.140f, -0.063f);
-		glVertex3f(-0.063f, -0.150f, -0.036f);
-		glVertex3f(-0.036f, -0.150f, -0.063f);
-		glVertex3f(-0.063f, -0.160f, -0.036f);
-		glVertex3f(-0.036f, -0.160f, -0.063f);
-		glVertex3f(-0.063f, -0.170f, -0.036f);
-		glVertex3f(-0.036f, -0.170f, -0.063f);
-		glVertex3f(-0.063f, -0.180f, -0.036f);
-		glVertex3f(-0.036f, -0.180f, -0.063f);
-		glVertex3f(-0.062f, -0.190f, -0.036f);
-		glVertex3f(-0.036f, -0.190f, -0.062f);
-		glVertex3f(-0.062f, -0.200f, -0.036f);
-		glVertex3f(-0.036f, -0.200f, -0.062f);
-		glVertex3f(-0.062f, -0.210f, -0.036f);
-		glVertex3f(-0.036f, -0.210f, -0.062f);
-		glVertex3f(-0.062f, -0.220f, -0.036f);
-		glVertex3f(-0.036f, -0.220f, -0.062f);
-		glVertex3f(-0.062f, -0.230f, -0.036f);
-		glVertex3f(-0.036f, -0.230f, -0.062f);
-		glVertex3f(-0.062f, -0.240f, -0.036f);
-		glVertex3f(-0.036f, -0.240f, -0.062f);
-		glVertex3f(-0.062f, -0.250f, -0.036f);
-		glVertex3f(-0.036f, -0.250f, -0.062f);
-		glVertex3f(-0.062f, -0.260f, -0.036f);
-		glVertex3f(-0.036f, -0.260f, -0.062f);
-		glVertex3f(-0.061f, -0.270f, -0.035f);
-		glVertex3f(-0.035f, -0.270f, -0.061f);
-		glVertex3f(-0.061f, -0.280f, -0.035f);
-		glVertex3f(-0.035f, -0.280f, -0.061f);
-		glVertex3f(-0.061f, -0.290f, -0.035f);
-		glVertex3f(-0.035f, -0.290f, -0.061f);
-		glVertex3f(-0.061f, -0.300f, -0.035f);
-		glVertex3f(-0.035f, -0.300f, -0.061f);
-		glVertex3f(-0.061f, -0.310f, -0.035f);
-		glVertex3f(-0.035f, -0.310f, -0.061f);
-		glVertex3f(-0.061f, -0.320f, -0.035f);
-		glVertex3f(-0.035f, -0.320f, -0.061f);
-		glVertex3f(-0.061f, -0.330f, -0.035f);
-		glVertex3f(-0.035f, -0.330f, -0.061f);
-		glVertex3f(-0.061f, -0.340f, -0.035f);
-		glVertex3f(-0.035f, -0.340f, -0.061f);
-		glVertex3f(-0.060f, -0.350f, -0.035f);
-		glVertex3f(-0.035f, -0.350f, -0.060f);
-		glVertex3f(-0.060f, -0.360f, -0.035f);
-		glVertex3f(-0.035f, -0.360f, -0.060f);
-		glVertex3f(-0.060f, -0.370f, -0.035f);
-		glVertex3f(-0.035f, -0.370f, -0.060f);
-		glVertex3f(-0.060f, -0.380f, -0.035f);
-		glVertex3f(-0.035f, -0.380f, -0.060f);
-		glVertex3f(-0.060f, -0.390f, -0.035f);
-		glVertex3f(-0.035f, -0.390f, -0.060f);
-		glVertex3f(-0.060f, -0.400f, -0.034f);
-		glVertex3f(-0.035f, -0.400f, -0.060f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.038f, -0.000f, -0.065f);
-		glVertex3f(-0.000f, -0.000f, -0.075f);
-		glVertex3f(-0.037f, -0.010f, -0.065f);
-		glVertex3f(-0.000f, -0.010f, -0.075f);
-		glVertex3f(-0.037f, -0.020f, -0.065f);
-		glVertex3f(-0.000f, -0.020f, -0.075f);
-		glVertex3f(-0.037f, -0.030f, -0.065f);
-		glVertex3f(-0.000f, -0.030f, -0.075f);
-		glVertex3f(-0.037f, -0.040f, -0.064f);
-		glVertex3f(-0.000f, -0.040f, -0.074f);
-		glVertex3f(-0.037f, -0.050f, -0.064f);
-		glVertex3f(-0.000f, -0.050f, -0.074f);
-		glVertex3f(-0.037f, -0.060f, -0.064f);
-		glVertex3f(-0.000f, -0.060f, -0.074f);
-		glVertex3f(-0.037f, -0.070f, -0.064f);
-		glVertex3f(-0.000f, -0.070f, -0.074f);
-		glVertex3f(-0.037f, -0.080f, -0.064f);
-		glVertex3f(-0.000f, -0.080f, -0.074f);
-		glVertex3f(-0.037f, -0.090f, -0.064f);
-		glVertex3f(-0.000f, -0.090f, -0.074f);
-		glVertex3f(-0.037f, -0.100f, -0.064f);
-		glVertex3f(-0.000f, -0.100f, -0.074f);
-		glVertex3f(-0.037f, -0.110f, -0.064f);
-		glVertex3f(-0.000f, -0.110f, -0.073f);
-		glVertex3f(-0.037f, -0.120f, -0.063f);
-		glVertex3f(-0.000f, -0.120f, -0.073f);
-		glVertex3f(-0.037f, -0.130f, -0.063f);
-		glVertex3f(-0.000f, -0.130f, -0.073f);
-		glVertex3f(-0.036f, -0.140f, -0.063f);
-		glVertex3f(-0.000f, -0.140f, -0.073f);
-		glVertex3f(-0.036f, -0.150f, -0.063f);
-		glVertex3f(-0.000f, -0.150f, -0.073f);
-		glVertex3f(-0.036f, -0.160f, -0.063f);
-		glVertex3f(-0.000f, -0.160f, -0.073f);
-		glVertex3f(-0.036f, -0.170f, -0.063f);
-		glVertex3f(-0.000f, -0.170f, -0.072f);
-		glVertex3f(-0.036f, -0.180f, -0.063f);
-		glVertex3f(-0.000f, -0.180f, -0.072f);
-		glVertex3f(-0.036f, -0.190f, -0.062f);
-		glVertex3f(-0.000f, -0.190f, -0.072f);
-		glVertex3f(-0.036f, -0.200f, -0.062f);
-		glVertex3f(-0.000f, -0.200f, -0.072f);
-		glVertex3f(-0.036f, -0.210f, -0.062f);
-		glVertex3f(-0.000f, -0.210f, -0.072f);
-		glVertex3f(-0.036f, -0.220f, -0.062f);
-		glVertex3f(-0.000f, -0.220f, -0.072f);
-		glVertex3f(-0.036f, -0.230f, -0.062f);
-		glVertex3f(-0.000f, -0.230f, -0.072f);
-		glVertex3f(-0.036f, -0.240f, -0.062f);
-		glVertex3f(-0.000f, -0.240f, -0.071f);
-		glVertex3f(-0.036f, -0.250f, -0.062f);
-		glVertex3f(-0.000f, -0.250f, -0.071f);
-		glVertex3f(-0.036f, -0.260f, -0.062f);
-		glVertex3f(-0.000f, -0.260f, -0.071f);
-		glVertex3f(-0.035f, -0.270f, -0.061f);
-		glVertex3f(-0.000f, -0.270f, -0.071f);
-		glVertex3f(-0.035f, -0.280f, -0.061f);
-		glVertex3f(-0.000f, -0.280f, -0.071f);
-		glVertex3f(-0.035f, -0.290f, -0.061f);
-		glVertex3f(-0.000f, -0.290f, -0.071f);
-		glVertex3f(-0.035f, -0.300f, -0.061f);
-		glVertex3f(-0.000f, -0.300f, -0.071f);
-		glVertex3f(-0.035f, -0.310f, -0.061f);
-		glVertex3f(-0.000f, -0.310f, -0.070f);
-		glVertex3f(-0.035f, -0.320f, -0.061f);
-		glVertex3f(-0.000f, -0.320f, -0.070f);
-		glVertex3f(-0.035f, -0.330f, -0.061f);
-		glVertex3f(-0.000f, -0.330f, -0.070f);
-		glVertex3f(-0.035f, -0.340f, -0.061f);
-		glVertex3f(-0.000f, -0.340f, -0.070f);
-		glVertex3f(-0.035f, -0.350f, -0.060f);
-		glVertex3f(-0.000f, -0.350f, -0.070f);
-		glVertex3f(-0.035f, -0.360f, -0.060f);
-		glVertex3f(-0.000f, -0.360f, -0.070f);
-		glVertex3f(-0.035f, -0.370f, -0.060f);
-		glVertex3f(-0.000f, -0.370f, -0.069f);
-		glVertex3f(-0.035f, -0.380f, -0.060f);
-		glVertex3f(-0.000f, -0.380f, -0.069f);
-		glVertex3f(-0.035f, -0.390f, -0.060f);
-		glVertex3f(-0.000f, -0.390f, -0.069f);
-		glVertex3f(-0.035f, -0.400f, -0.060f);
-		glVertex3f(-0.000f, -0.400f, -0.069f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, -0.000f, -0.075f);
-		glVertex3f(0.037f, -0.000f, -0.065f);
-		glVertex3f(-0.000f, -0.010f, -0.075f);
-		glVertex3f(0.037f, -0.010f, -0.065f);
-		glVertex3f(-0.000f, -0.020f, -0.075f);
-		glVertex3f(0.037f, -0.020f, -0.065f);
-		glVertex3f(-0.000f, -0.030f, -0.075f);
-		glVertex3f(0.037f, -0.030f, -0.065f);
-		glVertex3f(-0.000f, -0.040f, -0.074f);
-		glVertex3f(0.037f, -0.040f, -0.064f);
-		glVertex3f(-0.000f, -0.050f, -0.074f);
-		glVertex3f(0.037f, -0.050f, -0.064f);
-		glVertex3f(-0.000f, -0.060f, -0.074f);
-		glVertex3f(0.037f, -0.060f, -0.064f);
-		glVertex3f(-0.000f, -0.070f, -0.074f);
-		glVertex3f(0.037f, -0.070f, -0.064f);
-		glVertex3f(-0.000f, -0.080f, -0.074f);
-		glVertex3f(0.037f, -0.080f, -0.064f);
-		glVertex3f(-0.000f, -0.090f, -0.074f);
-		glVertex3f(0.037f, -0.090f, -0.064f);
-		glVertex3f(-0.000f, -0.100f, -0.074f);
-		glVertex3f(0.037f, -0.100f, -0.064f);
-		glVertex3f(-0.000f, -0.110f, -0.073f);
-		glVertex3f(0.037f, -0.110f, -0.064f);
-		glVertex3f(-0.000f, -0.120f, -0.073f);
-		glVertex3f(0.037f, -0.120f, -0.063f);
-		glVertex3f(-0.000f, -0.130f, -0.073f);
-		glVertex3f(0.037f, -0.130f, -0.063f);
-		glVertex3f(-0.000f, -0.140f, -0.073f);
-		glVertex3f(0.036f, -0.140f, -0.063f);
-		glVertex3f(-0.000f, -0.150f, -0.073f);
-		glVertex3f(0.036f, -0.150f, -0.063f);
-		glVertex3f(-0.000f, -0.160f, -0.073f);
-		glVertex3f(0.036f, -0.160f, -0.063f);
-		glVertex3f(-0.000f, -0.170f, -0.072f);
-		glVertex3f(0.036f, -0.170f, -0.063f);
-		glVertex3f(-0.000f, -0.180f, -0.072f);
-		glVertex3f(0.036f, -0.180f, -0.063f);
-		glVertex3f(-0.000f, -0.190f, -0.072f);
-		glVertex3f(0.036f, -0.190f, -0.062f);
-		glVertex3f(-0.000f, -0.200f, -0.072f);
-		glVertex3f(0.036f, -0.200f, -0.062f);
-		glVertex3f(-0.000f, -0.210f, -0.072f);
-		glVertex3f(0.036f, -0.210f, -0.062f);
-		glVertex3f(-0.000f, -0.220f, -0.072f);
-		glVertex3f(0.036f, -0.220f, -0.062f);
-		glVertex3f(-0.000f, -0.230f, -0.072f);
-		glVertex3f(0.036f, -0.230f, -0.062f);
-		glVertex3f(-0.000f, -0.240f, -0.071f);
-		glVertex3f(0.036f, -0.240f, -0.062f);
-		glVertex3f(-0.000f, -0.250f, -0.071f);
-		glVertex3f(0.036f, -0.250f, -0.062f);
-		glVertex3f(-0.000f, -0.260f, -0.071f);
-		glVertex3f(0.036f, -0.260f, -0.062f);
-		glVertex3f(-0.000f, -0.270f, -0.071f);
-		glVertex3f(0.035f, -0.270f, -0.061f);
-		glVertex3f(-0.000f, -0.280f, -0.071f);
-		glVertex3f(0.035f, -0.280f, -0.061f);
-		glVertex3f(-0.000f, -0.290f, -0.071f);
-		glVertex3f(0.035f, -0.290f, -0.061f);
-		glVertex3f(-0.000f, -0.300f, -0.071f);
-		glVertex3f(0.035f, -0.300f, -0.061f);
-		glVertex3f(-0.000f, -0.310f, -0.070f);
-		glVertex3f(0.035f, -0.310f, -0.061f);
-		glVertex3f(-0.000f, -0.320f, -0.070f);
-		glVertex3f(0.035f, -0.320f, -0.061f);
-		glVertex3f(-0.000f, -0.330f, -0.070f);
-		glVertex3f(0.035f, -0.330f, -0.061f);
-		glVertex3f(-0.000f, -0.340f, -0.070f);
-		glVertex3f(0.035f, -0.340f, -0.061f);
-		glVertex3f(-0.000f, -0.350f, -0.070f);
-		glVertex3f(0.035f, -0.350f, -0.060f);
-		glVertex3f(-0.000f, -0.360f, -0.070f);
-		glVertex3f(0.035f, -0.360f, -0.060f);
-		glVertex3f(-0.000f, -0.370f, -0.069f);
-		glVertex3f(0.035f, -0.370f, -0.060f);
-		glVertex3f(-0.000f, -0.380f, -0.069f);
-		glVertex3f(0.035f, -0.380f, -0.060f);
-		glVertex3f(-0.000f, -0.390f, -0.069f);
-		glVertex3f(0.035f, -0.390f, -0.060f);
-		glVertex3f(-0.000f, -0.400f, -0.069f);
-		glVertex3f(0.034f, -0.400f, -0.060f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.037f, -0.000f, -0.065f);
-		glVertex3f(0.065f, -0.000f, -0.038f);
-		glVertex3f(0.037f, -0.010f, -0.065f);
-		glVertex3f(0.065f, -0.010f, -0.037f);
-		glVertex3f(0.037f, -0.020f, -0.065f);
-		glVertex3f(0.065f, -0.020f, -0.037f);
-		glVertex3f(0.037f, -0.030f, -0.065f);
-		glVertex3f(0.065f, -0.030f, -0.037f);
-		glVertex3f(0.037f, -0.040f, -0.064f);
-		glVertex3f(0.064f, -0.040f, -0.037f);
-		glVertex3f(0.037f, -0.050f, -0.064f);
-		glVertex3f(0.064f, -0.050f, -0.037f);
-		glVertex3f(0.037f, -0.060f, -0.064f);
-		glVertex3f(0.064f, -0.060f, -0.037f);
-		glVertex3f(0.037f, -0.070f, -0.064f);
-		glVertex3f(0.064f, -0.070f, -0.037f);
-		glVertex3f(0.037f, -0.080f, -0.064f);
-		glVertex3f(0.064f, -0.080f, -0.037f);
-		glVertex3f(0.037f, -0.090f, -0.064f);
-		glVertex3f(0.064f, -0.090f, -0.037f);
-		glVertex3f(0.037f, -0.100f, -0.064f);
-		glVertex3f(0.064f, -0.100f, -0.037f);
-		glVertex3f(0.037f, -0.110f, -0.064f);
-		glVertex3f(0.064f, -0.110f, -0.037f);
-		glVertex3f(0.037f, -0.120f, -0.063f);
-		glVertex3f(0.063f, -0.120f, -0.037f);
-		glVertex3f(0.037f, -0.130f, -0.063f);
-		glVertex3f(0.063f, -0.130f, -0.037f);
-		glVertex3f(0.036f, -0.140f, -0.063f);
-		glVertex3f(0.063f, -0.140f, -0.036f);
-		glVertex3f(0.036f, -0.150f, -0.063f);
-		glVertex3f(0.063f, -0.150f, -0.036f);
-		glVertex3f(0.036f, -0.160f, -0.063f);
-		glVertex3f(0.063f, -0.160f, -0.036f);
-		glVertex3f(0.036f, -0.170f, -0.063f);
-		glVertex3f(0.063f, -0.170f, -0.036f);
-		glVertex3f(0.036f, -0.180f, -0.063f);
-		glVertex3f(0.063f, -0.180f, -0.036f);
-		glVertex3f(0.036f, -0.190f, -0.062f);
-		glVertex3f(0.062f, -0.190f, -0.036f);
-		glVertex3f(0.036f, -0.200f, -0.062f);
-		glVertex3f(0.062f, -0.200f, -0.036f);
-		glVertex3f(0.036f, -0.210f, -0.062f);
-		glVertex3f(0.062f, -0.210f, -0.036f);
-		glVertex3f(0.036f, -0.220f, -0.062f);
-		glVertex3f(0.062f, -0.220f, -0.036f);
-		glVertex3f(0.036f, -0.230f, -0.062f);
-		glVertex3f(0.062f, -0.230f, -0.036f);
-		glVertex3f(0.036f, -0.240f, -0.062f);
-		glVertex3f(0.062f, -0.240f, -0.036f);
-		glVertex3f(0.036f, -0.250f, -0.062f);
-		glVertex3f(0.062f, -0.250f, -0.036f);
-		glVertex3f(0.036f, -0.260f, -0.062f);
-		glVertex3f(0.062f, -0.260f, -0.036f);
-		glVertex3f(0.035f, -0.270f, -0.061f);
-		glVertex3f(0.061f, -0.270f, -0.035f);
-		glVertex3f(0.035f, -0.280f, -0.061f);
-		glVertex3f(0.061f, -0.280f, -0.035f);
-		glVertex3f(0.035f, -0.290f, -0.061f);
-		glVertex3f(0.061f, -0.290f, -0.035f);
-		glVertex3f(0.035f, -0.300f, -0.061f);
-		glVertex3f(0.061f, -0.300f, -0.035f);
-		glVertex3f(0.035f, -0.310f, -0.061f);
-		glVertex3f(0.061f, -0.310f, -0.035f);
-		glVertex3f(0.035f, -0.320f, -0.061f);
-		glVertex3f(0.061f, -0.320f, -0.035f);
-		glVertex3f(0.035f, -0.330f, -0.061f);
-		glVertex3f(0.061f, -0.330f, -0.035f);
-		glVertex3f(0.035f, -0.340f, -0.061f);
-		glVertex3f(0.061f, -0.340f, -0.035f);
-		glVertex3f(0.035f, -0.350f, -0.060f);
-		glVertex3f(0.060f, -0.350f, -0.035f);
-		glVertex3f(0.035f, -0.360f, -0.060f);
-		glVertex3f(0.060f, -0.360f, -0.035f);
-		glVertex3f(0.035f, -0.370f, -0.060f);
-		glVertex3f(0.060f, -0.370f, -0.035f);
-		glVertex3f(0.035f, -0.380f, -0.060f);
-		glVertex3f(0.060f, -0.380f, -0.035f);
-		glVertex3f(0.035f, -0.390f, -0.060f);
-		glVertex3f(0.060f, -0.390f, -0.035f);
-		glVertex3f(0.034f, -0.400f, -0.060f);
-		glVertex3f(0.060f, -0.400f, -0.035f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.065f, -0.000f, -0.038f);
-		glVertex3f(0.075f, -0.000f, -0.000f);
-		glVertex3f(0.065f, -0.010f, -0.037f);
-		glVertex3f(0.075f, -0.010f, -0.000f);
-		glVertex3f(0.065f, -0.020f, -0.037f);
-		glVertex3f(0.075f, -0.020f, -0.000f);
-		glVertex3f(0.065f, -0.030f, -0.037f);
-		glVertex3f(0.075f, -0.030f, -0.000f);
-		glVertex3f(0.064f, -0.040f, -0.037f);
-		glVertex3f(0.074f, -0.040f, -0.000f);
-		glVertex3f(0.064f, -0.050f, -0.037f);
-		glVertex3f(0.074f, -0.050f, -0.000f);
-		glVertex3f(0.064f, -0.060f, -0.037f);
-		glVertex3f(0.074f, -0.060f, -0.000f);
-		glVertex3f(0.064f, -0.070f, -0.037f);
-		glVertex3f(0.074f, -0.070f, -0.000f);
-		glVertex3f(0.064f, -0.080f, -0.037f);
-		glVertex3f(0.074f, -0.080f, -0.000f);
-		glVertex3f(0.064f, -0.090f, -0.037f);
-		glVertex3f(0.074f, -0.090f, -0.000f);
-		glVertex3f(0.064f, -0.100f, -0.037f);
-		glVertex3f(0.074f, -0.100f, -0.000f);
-		glVertex3f(0.064f, -0.110f, -0.037f);
-		glVertex3f(0.073f, -0.110f, -0.000f);
-		glVertex3f(0.063f, -0.120f, -0.037f);
-		glVertex3f(0.073f, -0.120f, -0.000f);
-		glVertex3f(0.063f, -0.130f, -0.037f);
-		glVertex3f(0.073f, -0.130f, -0.000f);
-		glVertex3f(0.063f, -0.140f, -0.036f);
-		glVertex3f(0.073f, -0.140f, -0.000f);
-		glVertex3f(0.063f, -0.150f, -0.036f);
-		glVertex3f(0.073f, -0.150f, -0.000f);
-		glVertex3f(0.063f, -0.160f, -0.036f);
-		glVertex3f(0.073f, -0.160f, -0.000f);
-		glVertex3f(0.063f, -0.170f, -0.036f);
-		glVertex3f(0.072f, -0.170f, -0.000f);
-		glVertex3f(0.063f, -0.180f, -0.036f);
-		glVertex3f(0.072f, -0.180f, -0.000f);
-		glVertex3f(0.062f, -0.190f, -0.036f);
-		glVertex3f(0.072f, -0.190f, -0.000f);
-		glVertex3f(0.062f, -0.200f, -0.036f);
-		glVertex3f(0.072f, -0.200f, -0.000f);
-		glVertex3f(0.062f, -0.210f, -0.036f);
-		glVertex3f(0.072f, -0.210f, -0.000f);
-		glVertex3f(0.062f, -0.220f, -0.036f);
-		glVertex3f(0.072f, -0.220f, -0.000f);
-		glVertex3f(0.062f, -0.230f, -0.036f);
-		glVertex3f(0.072f, -0.230f, -0.000f);
-		glVertex3f(0.062f, -0.240f, -0.036f);
-		glVertex3f(0.071f, -0.240f, -0.000f);
-		glVertex3f(0.062f, -0.250f, -0.036f);
-		glVertex3f(0.071f, -0.250f, -0.000f);
-		glVertex3f(0.062f, -0.260f, -0.036f);
-		glVertex3f(0.071f, -0.260f, -0.000f);
-		glVertex3f(0.061f, -0.270f, -0.035f);
-		glVertex3f(0.071f, -0.270f, -0.000f);
-		glVertex3f(0.061f, -0.280f, -0.035f);
-		glVertex3f(0.071f, -0.280f, -0.000f);
-		glVertex3f(0.061f, -0.290f, -0.035f);
-		glVertex3f(0.071f, -0.290f, -0.000f);
-		glVertex3f(0.061f, -0.300f, -0.035f);
-		glVertex3f(0.071f, -0.300f, -0.000f);
-		glVertex3f(0.061f, -0.310f, -0.035f);
-		glVertex3f(0.070f, -0.310f, -0.000f);
-		glVertex3f(0.061f, -0.320f, -0.035f);
-		glVertex3f(0.070f, -0.320f, -0.000f);
-		glVertex3f(0.061f, -0.330f, -0.035f);
-		glVertex3f(0.070f, -0.330f, -0.000f);
-		glVertex3f(0.061f, -0.340f, -0.035f);
-		glVertex3f(0.070f, -0.340f, -0.000f);
-		glVertex3f(0.060f, -0.350f, -0.035f);
-		glVertex3f(0.070f, -0.350f, -0.000f);
-		glVertex3f(0.060f, -0.360f, -0.035f);
-		glVertex3f(0.070f, -0.360f, -0.000f);
-		glVertex3f(0.060f, -0.370f, -0.035f);
-		glVertex3f(0.069f, -0.370f, -0.000f);
-		glVertex3f(0.060f, -0.380f, -0.035f);
-		glVertex3f(0.069f, -0.380f, -0.000f);
-		glVertex3f(0.060f, -0.390f, -0.035f);
-		glVertex3f(0.069f, -0.390f, -0.000f);
-		glVertex3f(0.060f, -0.400f, -0.035f);
-		glVertex3f(0.069f, -0.400f, -0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.075f, -0.000f, -0.000f);
-		glVertex3f(0.065f, -0.000f, 0.037f);
-		glVertex3f(0.075f, -0.010f, -0.000f);
-		glVertex3f(0.065f, -0.010f, 0.037f);
-		glVertex3f(0.075f, -0.020f, -0.000f);
-		glVertex3f(0.065f, -0.020f, 0.037f);
-		glVertex3f(0.075f, -0.030f, -0.000f);
-		glVertex3f(0.065f, -0.030f, 0.037f);
-		glVertex3f(0.074f, -0.040f, -0.000f);
-		glVertex3f(0.064f, -0.040f, 0.037f);
-		glVertex3f(0.074f, -0.050f, -0.000f);
-		glVertex3f(0.064f, -0.050f, 0.037f);
-		glVertex3f(0.074f, -0.060f, -0.000f);
-		glVertex3f(0.064f, -0.060f, 0.037f);
-		glVertex3f(0.074f, -0.070f, -0.000f);
-		glVertex3f(0.064f, -0.070f, 0.037f);
-		glVertex3f(0.074f, -0.080f, -0.000f);
-		glVertex3f(0.064f, -0.080f, 0.037f);
-		glVertex3f(0.074f, -0.090f, -0.000f);
-		glVertex3f(0.064f, -0.090f, 0.037f);
-		glVertex3f(0.074f, -0.100f, -0.000f);
-		glVertex3f(0.064f, -0.100f, 0.037f);
-		glVertex3f(0.073f, -0.110f, -0.000f);
-		glVertex3f(0.064f, -0.110f, 0.037f);
-		glVertex3f(0.073f, -0.120f, -0.000f);
-		glVertex3f(0.063f, -0.120f, 0.037f);
-		glVertex3f(0.073f, -0.130f, -0.000f);
-		glVertex3f(0.063f, -0.130f, 0.037f);
-		glVertex3f(0.073f, -0.140f, -0.000f);
-		glVertex3f(0.063f, -0.140f, 0.036f);
-		glVertex3f(0.073f, -0.150f, -0.000f);
-		glVertex3f(0.063f, -0.150f, 0.036f);
-		glVertex3f(0.073f, -0.160f, -0.000f);
-		glVertex3f(0.063f, -0.160f, 0.036f);
-		glVertex3f(0.072f, -0.170f, -0.000f);
-		glVertex3f(0.063f, -0.170f, 0.036f);
-		glVertex3f(0.072f, -0.180f, -0.000f);
-		glVertex3f(0.063f, -0.180f, 0.036f);
-		glVertex3f(0.072f, -0.190f, -0.000f);
-		glVertex3f(0.062f, -0.190f, 0.036f);
-		glVertex3f(0.072f, -0.200f, -0.000f);
-		glVertex3f(0.062f, -0.200f, 0.036f);
-		glVertex3f(0.072f, -0.210f, -0.000f);
-		glVertex3f(0.062f, -0.210f, 0.036f);
-		glVertex3f(0.072f, -0.220f, -0.000f);
-		glVertex3f(0.062f, -0.220f, 0.036f);
-		glVertex3f(0.072f, -0.230f, -0.000f);
-		glVertex3f(0.062f, -0.230f, 0.036f);
-		glVertex3f(0.071f, -0.240f, -0.000f);
-		glVertex3f(0.062f, -0.240f, 0.036f);
-		glVertex3f(0.071f, -0.250f, -0.000f);
-		glVertex3f(0.062f, -0.250f, 0.036f);
-		glVertex3f(0.071f, -0.260f, -0.000f);
-		glVertex3f(0.062f, -0.260f, 0.036f);
-		glVertex3f(0.071f, -0.270f, -0.000f);
-		glVertex3f(0.061f, -0.270f, 0.035f);
-		glVertex3f(0.071f, -0.280f, -0.000f);
-		glVertex3f(0.061f, -0.280f, 0.035f);
-		glVertex3f(0.071f, -0.290f, -0.000f);
-		glVertex3f(0.061f, -0.290f, 0.035f);
-		glVertex3f(0.071f, -0.300f, -0.000f);
-		glVertex3f(0.061f, -0.300f, 0.035f);
-		glVertex3f(0.070f, -0.310f, -0.000f);
-		glVertex3f(0.061f, -0.310f, 0.035f);
-		glVertex3f(0.070f, -0.320f, -0.000f);
-		glVertex3f(0.061f, -0.320f, 0.035f);
-		glVertex3f(0.070f, -0.330f, -0.000f);
-		glVertex3f(0.061f, -0.330f, 0.035f);
-		glVertex3f(0.070f, -0.340f, -0.000f);
-		glVertex3f(0.061f, -0.340f, 0.035f);
-		glVertex3f(0.070f, -0.350f, -0.000f);
-		glVertex3f(0.060f, -0.350f, 0.035f);
-		glVertex3f(0.070f, -0.360f, -0.000f);
-		glVertex3f(0.060f, -0.360f, 0.035f);
-		glVertex3f(0.069f, -0.370f, -0.000f);
-		glVertex3f(0.060f, -0.370f, 0.035f);
-		glVertex3f(0.069f, -0.380f, -0.000f);
-		glVertex3f(0.060f, -0.380f, 0.035f);
-		glVertex3f(0.069f, -0.390f, -0.000f);
-		glVertex3f(0.060f, -0.390f, 0.035f);
-		glVertex3f(0.069f, -0.400f, -0.000f);
-		glVertex3f(0.060f, -0.400f, 0.034f);
-	glEnd();
+	mesh_draw(&limb_mesh);
 #else
 	glBegin(GL_QUAD_STRIP);
 		glVertex3v16(-307, 0, 307);
@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -34,113 +35,150 @@
 
 
 //stats: LATS: 6, ANGLE_INCR: 0.523599, NDS_LATS: 2, NDS_ANGLE_INCR: 1.570796
+#ifndef ECHO_NDS
+static const float lower_body_vertices[] = {
+	0.100f, 0.260f, 0.000f,
+	0.087f, 0.260f, 0.037f,
+	0.173f, 0.150f, 0.000f,
+	0.150f, 0.150f, 0.065f,
+	0.200f, 0.000f, 0.000f,
+	0.173f, 0.000f, 0.075f,
+	0.087f, 0.260f, 0.037f,
+	0.050f, 0.260f, 0.065f,
+	0.150f, 0.150f, 0.065f,
+	0.087f, 0.150f, 0.113f,
+	0.173f, 0.000f, 0.075f,
+	0.100f, 0.000f, 0.130f,
+	0.050f, 0.260f, 0.065f,
+	0.000f, 0.260f, 0.075f,
+	0.087f, 0.150f, 0.113f,
+	0.000f, 0.150f, 0.130f,
+	0.100f, 0.000f, 0.130f,
+	0.000f, 0.000f, 0.150f,
+	0.000f, 0.260f, 0.075f,
+	-0.050f, 0.260f, 0.065f,
+	0.000f, 0.150f, 0.130f,
+	-0.087f, 0.150f, 0.113f,
+	0.000f, 0.000f, 0.150f,
+	-0.100f, 0.000f, 0.130f,
+	-0.050f, 0.260f, 0.065f,
+	-0.087f, 0.260f, 0.038f,
+	-0.087f, 0.150f, 0.113f,
+	-0.150f, 0.150f, 0.065f,
+	-0.100f, 0.000f, 0.130f,
+	-0.173f, 0.000f, 0.075f,
+	-0.087f, 0.260f, 0.038f,
+	-0.100f, 0.260f, 0.000f,
+	-0.150f, 0.150f, 0.065f,
+	-0.173f, 0.150f, 0.000f,
+	-0.173f, 0.000f, 0.075f,
+	-0.200f, 0.000f, 0.000f,
+	-0.100f, 0.260f, 0.000f,
+	-0.087f, 0.260f, -0.037f,
+	-0.173f, 0.150f, 0.000f,
+	-0.150f, 0.150f, -0.065f,
+	-0.200f, 0.000f, 0.000f,
+	-0.173f, 0.000f, -0.075f,
+	-0.087f, 0.260f, -0.037f,
+	-0.050f, 0.260f, -0.065f,
+	-0.150f, 0.150f, -0.065f,
+	-0.087f, 0.150f, -0.112f,
+	-0.173f, 0.000f, -0.075f,
+	-0.100f, 0.000f, -0.130f,
+	-0.050f, 0.260f, -0.065f,
+	-0.000f, 0.260f, -0.075f,
+	-0.087f, 0.150f, -0.112f,
+	-0.000f, 0.150f, -0.130f,
+	-0.100f, 0.000f, -0.130f,
+	-0.000f, 0.000f, -0.150f,
+	-0.000f, 0.260f, -0.075f,
+	0.050f, 0.260f, -0.065f,
+	-0.000f, 0.150f, -0.130f,
+	0.087f, 0.150f, -0.113f,
+	-0.000f, 0.000f, -0.150f,
+	0.100f, 0.000f, -0.130f,
+	0.050f, 0.260f, -0.065f,
+	0.087f, 0.260f, -0.038f,
+	0.087f, 0.150f, -0.113f,
+	0.150f, 0.150f, -0.065f,
+	0.100f, 0.000f, -0.130f,
+	0.173f, 0.000f, -0.075f,
+	0.087f, 0.260f, -0.038f,
+	0.100f, 0.260f, -0.000f,
+	0.150f, 0.150f, -0.065f,
+	0.173f, 0.150f, -0.000f,
+	0.173f, 0.000f, -0.075f,
+	0.200f, 0.000f, -0.000f,
+	0.100f, 0.260f, -0.000f,
+	0.087f, 0.260f, 0.037f,
+	0.173f, 0.150f, -0.000f,
+	0.150f, 0.150f, 0.065f,
+	0.200f, 0.000f, -0.000f,
+	0.173f, 0.000f, 0.075f,
+};
+
+static const unsigned short lower_body_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	30, 31, 33,
+	30, 33, 32,
+	32, 33, 35,
+	32, 35, 34,
+	36, 37, 39,
+	36, 39, 38,
+	38, 39, 41,
+	38, 41, 40,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	48, 49, 51,
+	48, 51, 50,
+	50, 51, 53,
+	50, 53, 52,
+	54, 55, 57,
+	54, 57, 56,
+	56, 57, 59,
+	56, 59, 58,
+	60, 61, 63,
+	60, 63, 62,
+	62, 63, 65,
+	62, 65, 64,
+	66, 67, 69,
+	66, 69, 68,
+	68, 69, 71,
+	68, 71, 70,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+};
+
+echo_mesh lower_body_mesh = ECHO_MESH(lower_body_vertices, lower_body_indices);
+#endif
+
 void draw_lower_body()
 {
 #ifndef ECHO_NDS
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.100f, 0.260f, 0.000f);
-		glVertex3f(0.087f, 0.260f, 0.037f);
-		glVertex3f(0.173f, 0.150f, 0.000f);
-		glVertex3f(0.150f, 0.150f, 0.065f);
-		glVertex3f(0.200f, 0.000f, 0.000f);
-		glVertex3f(0.173f, 0.000f, 0.075f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.087f, 0.260f, 0.037f);
-		glVertex3f(0.050f, 0.260f, 0.065f);
-		glVertex3f(0.150f, 0.150f, 0.065f);
-		glVertex3f(0.087f, 0.150f, 0.112f);
-		glVertex3f(0.173f, 0.000f, 0.075f);
-		glVertex3f(0.100f, 0.000f, 0.130f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.050f, 0.260f, 0.065f);
-		glVertex3f(0.000f, 0.260f, 0.075f);
-		glVertex3f(0.087f, 0.150f, 0.112f);
-		glVertex3f(0.000f, 0.150f, 0.130f);
-		glVertex3f(0.100f, 0.000f, 0.130f);
-		glVertex3f(0.000f, 0.000f, 0.150f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.000f, 0.260f, 0.075f);
-		glVertex3f(-0.050f, 0.260f, 0.065f);
-		glVertex3f(0.000f, 0.150f, 0.130f);
-		glVertex3f(-0.087f, 0.150f, 0.113f);
-		glVertex3f(0.000f, 0.000f, 0.150f);
-		glVertex3f(-0.100f, 0.000f, 0.130f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.050f, 0.260f, 0.065f);
-		glVertex3f(-0.087f, 0.260f, 0.038f);
-		glVertex3f(-0.087f, 0.150f, 0.113f);
-		glVertex3f(-0.150f, 0.150f, 0.065f);
-		glVertex3f(-0.100f, 0.000f, 0.130f);
-		glVertex3f(-0.173f, 0.000f, 0.075f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.087f, 0.260f, 0.038f);
-		glVertex3f(-0.100f, 0.260f, 0.000f);
-		glVertex3f(-0.150f, 0.150f, 0.065f);
-		glVertex3f(-0.173f, 0.150f, 0.000f);
-		glVertex3f(-0.173f, 0.000f, 0.075f);
-		glVertex3f(-0.200f, 0.000f, 0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.100f, 0.260f, 0.000f);
-		glVertex3f(-0.087f, 0.260f, -0.037f);
-		glVertex3f(-0.173f, 0.150f, 0.000f);
-		glVertex3f(-0.150f, 0.150f, -0.065f);
-		glVertex3f(-0.200f, 0.000f, 0.000f);
-		glVertex3f(-0.173f, 0.000f, -0.075f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.087f, 0.260f, -0.037f);
-		glVertex3f(-0.050f, 0.260f, -0.065f);
-		glVertex3f(-0.150f, 0.150f, -0.065f);
-		glVertex3f(-0.087f, 0.150f, -0.112f);
-		glVertex3f(-0.173f, 0.000f, -0.075f);
-		glVertex3f(-0.100f, 0.000f, -0.130f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.050f, 0.260f, -0.065f);
-		glVertex3f(-0.000f, 0.260f, -0.075f);
-		glVertex3f(-0.087f, 0.150f, -0.112f);
-		glVertex3f(-0.000f, 0.150f, -0.130f);
-		glVertex3f(-0.100f, 0.000f, -0.130f);
-		glVertex3f(-0.000f, 0.000f, -0.150f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(-0.000f, 0.260f, -0.075f);
-		glVertex3f(0.050f, 0.260f, -0.065f);
-		glVertex3f(-0.000f, 0.150f, -0.130f);
-		glVertex3f(0.087f, 0.150f, -0.113f);
-		glVertex3f(-0.000f, 0.000f, -0.150f);
-		glVertex3f(0.100f, 0.000f, -0.130f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.050f, 0.260f, -0.065f);
-		glVertex3f(0.087f, 0.260f, -0.038f);
-		glVertex3f(0.087f, 0.150f, -0.113f);
-		glVertex3f(0.150f, 0.150f, -0.065f);
-		glVertex3f(0.100f, 0.000f, -0.130f);
-		glVertex3f(0.173f, 0.000f, -0.075f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.087f, 0.260f, -0.038f);
-		glVertex3f(0.100f, 0.260f, -0.000f);
-		glVertex3f(0.150f, 0.150f, -0.065f);
-		glVertex3f(0.173f, 0.150f, -0.000f);
-		glVertex3f(0.173f, 0.000f, -0.075f);
-		glVertex3f(0.200f, 0.000f, -0.000f);
-	glEnd();
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.100f, 0.260f, -0.000f);
-		glVertex3f(0.087f, 0.260f, 0.037f);
-		glVertex3f(0.173f, 0.150f, -0.000f);
-		glVertex3f(0.150f, 0.150f, 0.065f);
-		glVertex3f(0.200f, 0.000f, -0.000f);
-		glVertex3f(0.173f, 0.000f, 0.075f);
-	glEnd();
+	mesh_draw(&lower_body_mesh);
 #else
 	glBegin(GL_QUAD_STRIP);
 		glVertex3v16(-819, -614, 614);
@@ -1,4 +1,4 @@
-// echo_model_sphere.cpp
+// echo_model_sphere_point1.cpp
 
 /*
     This file is part of L-Echo.
@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -34,10 +35,590 @@
 
 
 //stats: LATS: 6, ANGLE_INCR: 0.523599, NDS_LATS: 2, NDS_ANGLE_INCR: 1.570796
+#ifndef ECHO_NDS
+static const float sphere_point1_lod2_vertices[] = {
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.100f, 0.000f, 0.000f,
+	0.000f, 0.000f, 0.100f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	0.000f, 0.000f, 0.100f,
+	-0.100f, 0.000f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, -0.000f,
+	-0.100f, 0.000f, 0.000f,
+	0.000f, 0.000f, -0.100f,
+	-0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.000f, -0.100f,
+	0.100f, 0.000f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.100f, 0.000f, -0.000f,
+	0.000f, 0.000f, 0.100f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, 0.000f,
+};
+
+static const unsigned short sphere_point1_lod2_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+};
+
+static echo_mesh sphere_point1_lod2_mesh = ECHO_LOD_MESH(sphere_point1_lod2_vertices, sphere_point1_lod2_indices, 0.100f, 2, NULL);
+#endif
+
+#ifndef ECHO_NDS
+static const float sphere_point1_lod1_vertices[] = {
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.071f, 0.071f, 0.000f,
+	0.050f, 0.071f, 0.050f,
+	0.100f, 0.000f, 0.000f,
+	0.071f, 0.000f, 0.071f,
+	0.071f, -0.071f, 0.000f,
+	0.050f, -0.071f, 0.050f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.050f, 0.071f, 0.050f,
+	0.000f, 0.071f, 0.071f,
+	0.071f, 0.000f, 0.071f,
+	0.000f, 0.000f, 0.100f,
+	0.050f, -0.071f, 0.050f,
+	0.000f, -0.071f, 0.071f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	0.000f, 0.071f, 0.071f,
+	-0.050f, 0.071f, 0.050f,
+	0.000f, 0.000f, 0.100f,
+	-0.071f, 0.000f, 0.071f,
+	0.000f, -0.071f, 0.071f,
+	-0.050f, -0.071f, 0.050f,
+	0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.050f, 0.071f, 0.050f,
+	-0.071f, 0.071f, 0.000f,
+	-0.071f, 0.000f, 0.071f,
+	-0.100f, 0.000f, 0.000f,
+	-0.050f, -0.071f, 0.050f,
+	-0.071f, -0.071f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.071f, 0.071f, 0.000f,
+	-0.050f, 0.071f, -0.050f,
+	-0.100f, 0.000f, 0.000f,
+	-0.071f, 0.000f, -0.071f,
+	-0.071f, -0.071f, 0.000f,
+	-0.050f, -0.071f, -0.050f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.050f, 0.071f, -0.050f,
+	-0.000f, 0.071f, -0.071f,
+	-0.071f, 0.000f, -0.071f,
+	-0.000f, 0.000f, -0.100f,
+	-0.050f, -0.071f, -0.050f,
+	-0.000f, -0.071f, -0.071f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	-0.000f, 0.071f, -0.071f,
+	0.050f, 0.071f, -0.050f,
+	-0.000f, 0.000f, -0.100f,
+	0.071f, 0.000f, -0.071f,
+	-0.000f, -0.071f, -0.071f,
+	0.050f, -0.071f, -0.050f,
+	-0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.050f, 0.071f, -0.050f,
+	0.071f, 0.071f, -0.000f,
+	0.071f, 0.000f, -0.071f,
+	0.100f, 0.000f, -0.000f,
+	0.050f, -0.071f, -0.050f,
+	0.071f, -0.071f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.071f, 0.071f, -0.000f,
+	0.050f, 0.071f, 0.050f,
+	0.100f, 0.000f, -0.000f,
+	0.071f, 0.000f, 0.071f,
+	0.071f, -0.071f, -0.000f,
+	0.050f, -0.071f, 0.050f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, 0.000f,
+};
+
+static const unsigned short sphere_point1_lod1_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	6, 7, 9,
+	6, 9, 8,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	16, 17, 19,
+	16, 19, 18,
+	20, 21, 23,
+	20, 23, 22,
+	22, 23, 25,
+	22, 25, 24,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+	30, 31, 33,
+	30, 33, 32,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	40, 41, 43,
+	40, 43, 42,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	46, 47, 49,
+	46, 49, 48,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+	54, 55, 57,
+	54, 57, 56,
+	56, 57, 59,
+	56, 59, 58,
+	60, 61, 63,
+	60, 63, 62,
+	62, 63, 65,
+	62, 65, 64,
+	64, 65, 67,
+	64, 67, 66,
+	66, 67, 69,
+	66, 69, 68,
+	70, 71, 73,
+	70, 73, 72,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+	76, 77, 79,
+	76, 79, 78,
+	80, 81, 83,
+	80, 83, 82,
+	82, 83, 85,
+	82, 85, 84,
+	84, 85, 87,
+	84, 87, 86,
+	86, 87, 89,
+	86, 89, 88,
+};
+
+static echo_mesh sphere_point1_lod1_mesh = ECHO_LOD_MESH(sphere_point1_lod1_vertices, sphere_point1_lod1_indices, 0.100f, 4, &sphere_point1_lod2_mesh);
+#endif
+
+#ifndef ECHO_NDS
+static const float sphere_point1_vertices[] = {
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.050f, 0.087f, 0.000f,
+	0.043f, 0.087f, 0.025f,
+	0.087f, 0.050f, 0.000f,
+	0.075f, 0.050f, 0.043f,
+	0.100f, 0.000f, 0.000f,
+	0.087f, 0.000f, 0.050f,
+	0.087f, -0.050f, 0.000f,
+	0.075f, -0.050f, 0.043f,
+	0.050f, -0.087f, 0.000f,
+	0.043f, -0.087f, 0.025f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.043f, 0.087f, 0.025f,
+	0.025f, 0.087f, 0.043f,
+	0.075f, 0.050f, 0.043f,
+	0.043f, 0.050f, 0.075f,
+	0.087f, 0.000f, 0.050f,
+	0.050f, 0.000f, 0.087f,
+	0.075f, -0.050f, 0.043f,
+	0.043f, -0.050f, 0.075f,
+	0.043f, -0.087f, 0.025f,
+	0.025f, -0.087f, 0.043f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.025f, 0.087f, 0.043f,
+	0.000f, 0.087f, 0.050f,
+	0.043f, 0.050f, 0.075f,
+	0.000f, 0.050f, 0.087f,
+	0.050f, 0.000f, 0.087f,
+	0.000f, 0.000f, 0.100f,
+	0.043f, -0.050f, 0.075f,
+	0.000f, -0.050f, 0.087f,
+	0.025f, -0.087f, 0.043f,
+	0.000f, -0.087f, 0.050f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, -0.100f, 0.000f,
+	0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	0.000f, 0.087f, 0.050f,
+	-0.025f, 0.087f, 0.043f,
+	0.000f, 0.050f, 0.087f,
+	-0.043f, 0.050f, 0.075f,
+	0.000f, 0.000f, 0.100f,
+	-0.050f, 0.000f, 0.087f,
+	0.000f, -0.050f, 0.087f,
+	-0.043f, -0.050f, 0.075f,
+	0.000f, -0.087f, 0.050f,
+	-0.025f, -0.087f, 0.043f,
+	0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.025f, 0.087f, 0.043f,
+	-0.043f, 0.087f, 0.025f,
+	-0.043f, 0.050f, 0.075f,
+	-0.075f, 0.050f, 0.043f,
+	-0.050f, 0.000f, 0.087f,
+	-0.087f, 0.000f, 0.050f,
+	-0.043f, -0.050f, 0.075f,
+	-0.075f, -0.050f, 0.043f,
+	-0.025f, -0.087f, 0.043f,
+	-0.043f, -0.087f, 0.025f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.043f, 0.087f, 0.025f,
+	-0.050f, 0.087f, 0.000f,
+	-0.075f, 0.050f, 0.043f,
+	-0.087f, 0.050f, 0.000f,
+	-0.087f, 0.000f, 0.050f,
+	-0.100f, 0.000f, 0.000f,
+	-0.075f, -0.050f, 0.043f,
+	-0.087f, -0.050f, 0.000f,
+	-0.043f, -0.087f, 0.025f,
+	-0.050f, -0.087f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, 0.100f, 0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.050f, 0.087f, 0.000f,
+	-0.043f, 0.087f, -0.025f,
+	-0.087f, 0.050f, 0.000f,
+	-0.075f, 0.050f, -0.043f,
+	-0.100f, 0.000f, 0.000f,
+	-0.087f, 0.000f, -0.050f,
+	-0.087f, -0.050f, 0.000f,
+	-0.075f, -0.050f, -0.043f,
+	-0.050f, -0.087f, 0.000f,
+	-0.043f, -0.087f, -0.025f,
+	-0.000f, -0.100f, 0.000f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.043f, 0.087f, -0.025f,
+	-0.025f, 0.087f, -0.043f,
+	-0.075f, 0.050f, -0.043f,
+	-0.043f, 0.050f, -0.075f,
+	-0.087f, 0.000f, -0.050f,
+	-0.050f, 0.000f, -0.087f,
+	-0.075f, -0.050f, -0.043f,
+	-0.043f, -0.050f, -0.075f,
+	-0.043f, -0.087f, -0.025f,
+	-0.025f, -0.087f, -0.043f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	-0.025f, 0.087f, -0.043f,
+	-0.000f, 0.087f, -0.050f,
+	-0.043f, 0.050f, -0.075f,
+	-0.000f, 0.050f, -0.087f,
+	-0.050f, 0.000f, -0.087f,
+	-0.000f, 0.000f, -0.100f,
+	-0.043f, -0.050f, -0.075f,
+	-0.000f, -0.050f, -0.087f,
+	-0.025f, -0.087f, -0.043f,
+	-0.000f, -0.087f, -0.050f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, -0.100f, -0.000f,
+	-0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	-0.000f, 0.087f, -0.050f,
+	0.025f, 0.087f, -0.043f,
+	-0.000f, 0.050f, -0.087f,
+	0.043f, 0.050f, -0.075f,
+	-0.000f, 0.000f, -0.100f,
+	0.050f, 0.000f, -0.087f,
+	-0.000f, -0.050f, -0.087f,
+	0.043f, -0.050f, -0.075f,
+	-0.000f, -0.087f, -0.050f,
+	0.025f, -0.087f, -0.043f,
+	-0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.025f, 0.087f, -0.043f,
+	0.043f, 0.087f, -0.025f,
+	0.043f, 0.050f, -0.075f,
+	0.075f, 0.050f, -0.043f,
+	0.050f, 0.000f, -0.087f,
+	0.087f, 0.000f, -0.050f,
+	0.043f, -0.050f, -0.075f,
+	0.075f, -0.050f, -0.043f,
+	0.025f, -0.087f, -0.043f,
+	0.043f, -0.087f, -0.025f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.043f, 0.087f, -0.025f,
+	0.050f, 0.087f, -0.000f,
+	0.075f, 0.050f, -0.043f,
+	0.087f, 0.050f, -0.000f,
+	0.087f, 0.000f, -0.050f,
+	0.100f, 0.000f, -0.000f,
+	0.075f, -0.050f, -0.043f,
+	0.087f, -0.050f, -0.000f,
+	0.043f, -0.087f, -0.025f,
+	0.050f, -0.087f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, 0.100f, -0.000f,
+	0.000f, 0.100f, 0.000f,
+	0.050f, 0.087f, -0.000f,
+	0.043f, 0.087f, 0.025f,
+	0.087f, 0.050f, -0.000f,
+	0.075f, 0.050f, 0.043f,
+	0.100f, 0.000f, -0.000f,
+	0.087f, 0.000f, 0.050f,
+	0.087f, -0.050f, -0.000f,
+	0.075f, -0.050f, 0.043f,
+	0.050f, -0.087f, -0.000f,
+	0.043f, -0.087f, 0.025f,
+	0.000f, -0.100f, -0.000f,
+	0.000f, -0.100f, 0.000f,
+};
+
+static const unsigned short sphere_point1_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	10, 11, 13,
+	10, 13, 12,
+	14, 15, 17,
+	14, 17, 16,
+	16, 17, 19,
+	16, 19, 18,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	22, 23, 25,
+	22, 25, 24,
+	24, 25, 27,
+	24, 27, 26,
+	28, 29, 31,
+	28, 31, 30,
+	30, 31, 33,
+	30, 33, 32,
+	32, 33, 35,
+	32, 35, 34,
+	34, 35, 37,
+	34, 37, 36,
+	36, 37, 39,
+	36, 39, 38,
+	38, 39, 41,
+	38, 41, 40,
+	42, 43, 45,
+	42, 45, 44,
+	44, 45, 47,
+	44, 47, 46,
+	46, 47, 49,
+	46, 49, 48,
+	48, 49, 51,
+	48, 51, 50,
+	50, 51, 53,
+	50, 53, 52,
+	52, 53, 55,
+	52, 55, 54,
+	56, 57, 59,
+	56, 59, 58,
+	58, 59, 61,
+	58, 61, 60,
+	60, 61, 63,
+	60, 63, 62,
+	62, 63, 65,
+	62, 65, 64,
+	64, 65, 67,
+	64, 67, 66,
+	66, 67, 69,
+	66, 69, 68,
+	70, 71, 73,
+	70, 73, 72,
+	72, 73, 75,
+	72, 75, 74,
+	74, 75, 77,
+	74, 77, 76,
+	76, 77, 79,
+	76, 79, 78,
+	78, 79, 81,
+	78, 81, 80,
+	80, 81, 83,
+	80, 83, 82,
+	84, 85, 87,
+	84, 87, 86,
+	86, 87, 89,
+	86, 89, 88,
+	88, 89, 91,
+	88, 91, 90,
+	90, 91, 93,
+	90, 93, 92,
+	92, 93, 95,
+	92, 95, 94,
+	94, 95, 97,
+	94, 97, 96,
+	98, 99, 101,
+	98, 101, 100,
+	100, 101, 103,
+	100, 103, 102,
+	102, 103, 105,
+	102, 105, 104,
+	104, 105, 107,
+	104, 107, 106,
+	106, 107, 109,
+	106, 109, 108,
+	108, 109, 111,
+	108, 111, 110,
+	112, 113, 115,
+	112, 115, 114,
+	114, 115, 117,
+	114, 117, 116,
+	116, 117, 119,
+	116, 119, 118,
+	118, 119, 121,
+	118, 121, 120,
+	120, 121, 123,
+	120, 123, 122,
+	122, 123, 125,
+	122, 125, 124,
+	126, 127, 129,
+	126, 129, 128,
+	128, 129, 131,
+	128, 131, 130,
+	130, 131, 133,
+	130, 133, 132,
+	132, 133, 135,
+	132, 135, 134,
+	134, 135, 137,
+	134, 137, 136,
+	136, 137, 139,
+	136, 139, 138,
+	140, 141, 143,
+	140, 143, 142,
+	142, 143, 145,
+	142, 145, 144,
+	144, 145, 147,
+	144, 147, 146,
+	146, 147, 149,
+	146, 149, 148,
+	148, 149, 151,
+	148, 151, 150,
+	150, 151, 153,
+	150, 153, 152,
+	154, 155, 157,
+	154, 157, 156,
+	156, 157, 159,
+	156, 159, 158,
+	158, 159, 161,
+	158, 161, 160,
+	160, 161, 163,
+	160, 163, 162,
+	162, 163, 165,
+	162, 165, 164,
+	164, 165, 167,
+	164, 167, 166,
+	168, 169, 171,
+	168, 171, 170,
+	170, 171, 173,
+	170, 173, 172,
+	172, 173, 175,
+	172, 175, 174,
+	174, 175, 177,
+	174, 177, 176,
+	176, 177, 179,
+	176, 179, 178,
+	178, 179, 181,
+	178, 181, 180,
+};
+
+echo_mesh sphere_point1_mesh = ECHO_LOD_MESH(sphere_point1_vertices, sphere_point1_indices, 0.100f, 6, &sphere_point1_lod1_mesh);
+#endif
+
 void draw_sphere_point1()
 {
 #ifndef ECHO_NDS
-	glutSolidSphere(0.100f, 6, 6);
+	mesh_draw(&sphere_point1_mesh);
 #else
 	glBegin(GL_QUAD_STRIP);
 		glVertex3v16(-409, 409, -409);
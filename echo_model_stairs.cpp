@@ -19,6 +19,7 @@
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
@@ -40,41 +41,78 @@
 	#define SET_ID(id)
 #endif
 
+#ifndef ECHO_NDS
+static const float stairs_vertices[] = {
+	0.500f, -0.500f, -0.500f,
+	-0.500f, -0.500f, -0.500f,
+	0.500f, -0.500f, -0.334f,
+	-0.500f, -0.500f, -0.334f,
+	0.500f, -0.334f, -0.334f,
+	-0.500f, -0.334f, -0.334f,
+	0.500f, -0.334f, -0.168f,
+	-0.500f, -0.334f, -0.168f,
+	0.500f, -0.168f, -0.168f,
+	-0.500f, -0.168f, -0.168f,
+	0.500f, -0.168f, -0.002f,
+	-0.500f, -0.168f, -0.002f,
+	0.500f, -0.002f, -0.002f,
+	-0.500f, -0.002f, -0.002f,
+	0.500f, -0.002f, 0.164f,
+	-0.500f, -0.002f, 0.164f,
+	0.500f, 0.164f, 0.164f,
+	-0.500f, 0.164f, 0.164f,
+	0.500f, 0.164f, 0.330f,
+	-0.500f, 0.164f, 0.330f,
+	0.500f, 0.330f, 0.330f,
+	-0.500f, 0.330f, 0.330f,
+	0.500f, 0.330f, 0.496f,
+	-0.500f, 0.330f, 0.496f,
+	0.500f, 0.496f, 0.496f,
+	-0.500f, 0.496f, 0.496f,
+	0.500f, 0.496f, 0.662f,
+	-0.500f, 0.496f, 0.662f,
+	0.500f, 0.500f, 0.500f,
+	-0.500f, 0.500f, 0.500f,
+};
+
+static const unsigned short stairs_indices[] = {
+	0, 1, 3,
+	0, 3, 2,
+	2, 3, 5,
+	2, 5, 4,
+	4, 5, 7,
+	4, 7, 6,
+	6, 7, 9,
+	6, 9, 8,
+	8, 9, 11,
+	8, 11, 10,
+	10, 11, 13,
+	10, 13, 12,
+	12, 13, 15,
+	12, 15, 14,
+	14, 15, 17,
+	14, 17, 16,
+	16, 17, 19,
+	16, 19, 18,
+	18, 19, 21,
+	18, 21, 20,
+	20, 21, 23,
+	20, 23, 22,
+	22, 23, 25,
+	22, 25, 24,
+	24, 25, 27,
+	24, 27, 26,
+	26, 27, 29,
+	26, 29, 28,
+};
+
+echo_mesh stairs_mesh = ECHO_MESH(stairs_vertices, stairs_indices);
+#endif
+
 void draw_stairs()
 {
 #ifndef ECHO_NDS
-	glBegin(GL_QUAD_STRIP);
-		glVertex3f(0.5f, -0.500f, -0.500f);
-		glVertex3f(-0.5f, -0.500f, -0.500f);
-		glVertex3f(0.5f, -0.500f, -0.334f);
-		glVertex3f(-0.5f, -0.500f, -0.334f);
-		glVertex3f(0.5f, -0.334f, -0.334f);
-		glVertex3f(-0.5f, -0.334f, -0.334f);
-		glVertex3f(0.5f, -0.334f, -0.168f);
-		glVertex3f(-0.5f, -0.334f, -0.168f);
-		glVertex3f(0.5f, -0.168f, -0.168f);
-		glVertex3f(-0.5f, -0.168f, -0.168f);
-		glVertex3f(0.5f, -0.168f, -0.002f);
-		glVertex3f(-0.5f, -0.168f, -0.002f);
-		glVertex3f(0.5f, -0.002f, -0.002f);
-		glVertex3f(-0.5f, -0.002f, -0.002f);
-		glVertex3f(0.5f, -0.002f, 0.164f);
-		glVertex3f(-0.5f, -0.002f, 0.164f);
-		glVertex3f(0.5f, 0.164f, 0.164f);
-		glVertex3f(-0.5f, 0.164f, 0.164f);
-		glVertex3f(0.5f, 0.164f, 0.330f);
-		glVertex3f(-0.5f, 0.164f, 0.330f);
-		glVertex3f(0.5f, 0.330f, 0.330f);
-		glVertex3f(-0.5f, 0.330f, 0.330f);
-		glVertex3f(0.5f, 0.330f, 0.496f);
-		glVertex3f(-0.5f, 0.330f, 0.496f);
-		glVertex3f(0.5f, 0.496f, 0.496f);
-		glVertex3f(-0.5f, 0.496f, 0.496f);
-		glVertex3f(0.5f, 0.496f, 0.662f);
-		glVertex3f(-0.5f, 0.496f, 0.662f);
-		glVertex3f(0.5f, 0.5f, 0.5f);
-		glVertex3f(-0.5f, 0.5f, 0.5f);
-	glEnd();
+	mesh_draw(&stairs_mesh);
 #else
 	SET_ID(16);
 	draw_rectv16(2048, -1359, -1359, 2048, -2039, -1359
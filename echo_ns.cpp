@@ -17,181 +17,122 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <cstdlib>
-#include <iostream>
-#include <set>
 
 #include "echo_platform.h"
 #include "echo_error.h"
 #include "echo_character.h"
 #include "echo_math.h"
+#include "echo_world.h"
 #include "echo_ns.h"
-#include "echo_gfx.h"
-
-#include "grid.h"
-#include "hole.h"
-
-/// The minimum opacity of the "stand-in mannequin" 
-#define NULL_CHAR_OPACITY_MIN   0.25f
 
 /// Holds important stuff
 namespace echo_ns
 {
-	/** Opacity of the "stand-in" mannequin, or the mannequin that marks
-	 * where the character initially lands.
-	 */
-	float null_char_opacity = NULL_CHAR_OPACITY_MIN;
-	/// Are we increasing the character's opacity or decreasing?
-	int opacity_incr = true;
+	/// The world the game plays
+	echo_world world;
 	/// The world's rotation angle.  _VERY_ important variable
-	vector3f angle;
-	/// The main character; the protagonist, the one the player controls
-	echo_char* main_char = NULL;
+	vector3f& angle = world.angle;
 	/// The current stage
-	stage* current_stage = NULL;
-	/// Has the game started yet?
-	int started = false;
+	stage*& current_stage = world.current_stage;
+	/// The main character; the protagonist, the one the player controls
+	echo_char*& main_char = world.main_char;
+	
+	/** Gets the rotations of angle; only rebuilt if angle changed since the last call
+	 * @return The camera_basis of angle
+	 */
+	const camera_basis& get_basis()
+	{
+		return(world.get_basis());
+	}
 	/// Deallocate everything: stage and character
 	void deallocate()
 	{
-		if(current_stage != NULL)
-			delete current_stage;
-		if(main_char != NULL)
-			delete main_char;
+		world.deallocate();
 	}
 	/// Initialize everything with the stage (which will be delete if deallocate is called)
 	void init(stage* st)
 	{
-		if(current_stage != NULL)
-			delete current_stage;
-		current_stage = st;
-		if(st != NULL)
-		{
-			main_char = new echo_char(st->get_start());
-			
-		}
-		else
-			main_char = NULL;
+		world.init(st);
 	}
 	/// Get the ball rolling!
 	void start()
 	{
-		started = true;
+		world.start();
 	}
 	/// Get the lowest level in the current stage
 	float get_lowest_level()
 	{
-		return(current_stage->get_lowest_level());
+		return(world.get_lowest_level());
+	}
+	/// Moves the character (or fades the "stand-in" mannequin) by one tick of WAIT
+	void update()
+	{
+		world.update();
 	}
-	/// Draws the stage and the character, or a "stand-in" mannequin
+	/** Runs as many updates as fit in the time since the last call, keeping the rest for
+	 * the next call, so the game plays the same at any frame rate
+	 * @param elapsed Time since the last call, in milliseconds
+	 * @return How many updates ran
+	 */
+	int advance(float elapsed)
+	{
+		return(world.advance(elapsed));
+	}
+	/// Draws the stage and the character (between the last two updates), or a "stand-in" mannequin
 	void draw()
 	{
-		if(current_stage != NULL)
-		{
-			current_stage->draw(angle);
-			if(started)
-			{
-				main_char->step();
-			}
-			/// Need a stand-in mannequin
-			else
-			{
-				/// Get the starting grid's info
-				grid* g = current_stage->get_start();
-				if(g)
-				{
-					grid_info_t* info = g->get_info(echo_ns::angle);
-					if(info)
-					{
-						gfx_push_matrix();
-						gfx_translatef(info->pos->x, info->pos->y, info->pos->z);
-#ifndef ECHO_NDS
-						gfx_outline_start();
-						draw_character(NULL);
-						gfx_outline_mid();
-#endif
-						gfx_color3f(null_char_opacity, null_char_opacity, null_char_opacity);
-						draw_character(NULL);
+		world.draw();
+	}
 #ifndef ECHO_NDS
-						gfx_outline_end();
-#endif
-						gfx_pop_matrix();
-						
-						/// Change the opacity
-						/// If we're increasing the opacity
-						if(opacity_incr)
-						{
-							/// Increase the opacity slightly
-							null_char_opacity += 0.05f;
-							/// If the opacity is greater than (or equal to) 1
-							if(null_char_opacity >= 1)
-							{
-								/// Change it back to one
-								null_char_opacity = 1;
-								/// Start decreasing the opacity
-								opacity_incr = false;
-							}
-						}
-						/// Else, we're decreasing...
-						else
-						{
-							/// Decrease the opacity slightly
-							null_char_opacity -= 0.05f;
-							/// If the opacity is less than the minimum
-							if(null_char_opacity <= NULL_CHAR_OPACITY_MIN)
-								/// Start increasing the opacity
-								/// (don't need to change to NULL_CHAR_OPACITY_MIN because it's OK to cross the threshold)
-								opacity_incr = true;
-						}
-					}
-				}
-			}
-		}
+	/// Draws the goals on their own; for after the screen-space outline, since they have none
+	void draw_goals()
+	{
+		world.draw_goals();
 	}
+#endif
 	/// Pause or unpause the game
 	void toggle_pause()
 	{
-		if(main_char != NULL)
-			main_char->toggle_pause();
+		world.toggle_pause();
 	}
 	/// Is the game paused?
 	int is_paused()
 	{
-		return(main_char->is_paused());
+		return(world.is_paused());
 	}
 	/// How many goals are there on this stage?
 	int num_goals()
 	{
-		return(current_stage->get_num_goals());
+		return(world.num_goals());
 	}
 	/// How goals has the many character reached?
 	int num_goals_reached()
 	{
-		return(main_char->num_goals_reached());
+		return(world.num_goals_reached());
 	}
 	/// How many goals are left?
 	int goals_left()
 	{
-		return(current_stage->get_num_goals() - num_goals_reached());
+		return(world.goals_left());
 	}
 	/// Get the speed of the character (see echo_char#speed)
 	float get_speed()
 	{
-		return(main_char->get_speed());
+		return(world.get_speed());
 	}
 	/// Change speed to running if we can
 	void start_run()
 	{
-		main_char->start_run();
+		world.start_run();
 	}
 	/// Change speed to walking if we can
 	void start_step()
 	{
-		main_char->start_step();
+		world.start_step();
 	}
 	/// Toggle running
 	void toggle_run()
 	{
-		main_char->toggle_run();
+		world.toggle_run();
 	}
 };
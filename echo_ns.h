@@ -23,19 +23,26 @@
 #include "echo_math.h"
 #include "grid.h"
 #include "echo_stage.h"
+#include "echo_world.h"
 
 #ifndef __ECHO_NS__
 #define __ECHO_NS__
 
-/// Holds important stuff
+/// Holds important stuff; the game's echo_world, and shortcuts to it
 namespace echo_ns
 {
+	/// The world the game plays
+	extern echo_world world;
 	/// The world's rotation angle.  _VERY_ important variable
-	extern vector3f angle;
+	extern vector3f& angle;
+	/** Gets the rotations of angle; only rebuilt if angle changed since the last call
+	 * @return The camera_basis of angle
+	 */
+	const camera_basis& get_basis();
 	/// The current stage
-	extern stage* current_stage;
+	extern stage*& current_stage;
 	/// The main character; the protagonist, the one the player controls
-	extern echo_char* main_char;
+	extern echo_char*& main_char;
 	
 	/// Deallocate everything: stage and character
 	void deallocate();
@@ -48,8 +55,20 @@ namespace echo_ns
 	/// Is the game paused?
 	int is_paused();
 	void setup_char(grid* g1);
-	/// Draws the stage and the character, or a "stand-in" mannequin
+	/// Moves the character (or fades the "stand-in" mannequin) by one tick of WAIT
+	void update();
+	/** Runs as many updates as fit in the time since the last call, keeping the rest for
+	 * the next call, so the game plays the same at any frame rate
+	 * @param elapsed Time since the last call, in milliseconds
+	 * @return How many updates ran
+	 */
+	int advance(float elapsed);
+	/// Draws the stage and the character (between the last two updates), or a "stand-in" mannequin
 	void draw();
+#ifndef ECHO_NDS
+	/// Draws the goals on their own; for after the screen-space outline, since they have none
+	void draw_goals();
+#endif
 	/// How many goals are there on this stage?
 	int num_goals();
 	/// How goals has the many character reached?
@@ -0,0 +1,208 @@
+// echo_offscreen.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+
+#include "echo_platform.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_glext.h"
+#include "echo_offscreen.h"
+
+#ifdef ECHO_UNIX
+
+#include <dlfcn.h>
+
+/// The bits of EGL used here (so the EGL headers aren't needed to build)
+typedef void* egl_display_t;
+typedef void* egl_config_t;
+typedef void* egl_surface_t;
+typedef void* egl_context_t;
+typedef int egl_int_t;
+
+#define EGL_NONE						0x3038
+#define EGL_SURFACE_TYPE				0x3033
+#define EGL_PBUFFER_BIT					0x0001
+#define EGL_RENDERABLE_TYPE				0x3040
+#define EGL_OPENGL_BIT					0x0008
+#define EGL_RED_SIZE					0x3024
+#define EGL_GREEN_SIZE					0x3023
+#define EGL_BLUE_SIZE					0x3022
+#define EGL_ALPHA_SIZE					0x3021
+#define EGL_DEPTH_SIZE					0x3025
+#define EGL_WIDTH						0x3057
+#define EGL_HEIGHT						0x3056
+#define EGL_OPENGL_API					0x30A2
+#define EGL_PLATFORM_SURFACELESS_MESA	0x31DD
+
+typedef void* (*egl_get_proc_address_t)(const char* name);
+typedef egl_display_t (*egl_get_display_t)(void* native);
+typedef egl_display_t (*egl_get_platform_display_t)(unsigned int platform, void* native, const egl_int_t* attribs);
+typedef unsigned int (*egl_initialize_t)(egl_display_t dpy, egl_int_t* major, egl_int_t* minor);
+typedef unsigned int (*egl_choose_config_t)(egl_display_t dpy, const egl_int_t* attribs
+	, egl_config_t* configs, egl_int_t size, egl_int_t* num);
+typedef egl_surface_t (*egl_create_pbuffer_surface_t)(egl_display_t dpy, egl_config_t config
+	, const egl_int_t* attribs);
+typedef unsigned int (*egl_bind_api_t)(unsigned int api);
+typedef egl_context_t (*egl_create_context_t)(egl_display_t dpy, egl_config_t config
+	, egl_context_t share, const egl_int_t* attribs);
+typedef unsigned int (*egl_make_current_t)(egl_display_t dpy, egl_surface_t draw
+	, egl_surface_t read, egl_context_t ctx);
+typedef unsigned int (*egl_swap_buffers_t)(egl_display_t dpy, egl_surface_t surface);
+typedef unsigned int (*egl_destroy_surface_t)(egl_display_t dpy, egl_surface_t surface);
+typedef unsigned int (*egl_destroy_context_t)(egl_display_t dpy, egl_context_t ctx);
+typedef unsigned int (*egl_terminate_t)(egl_display_t dpy);
+
+/// libEGL, from dlopen
+static void* lib = NULL;
+static egl_get_proc_address_t egl_get_proc_address = NULL;
+static egl_swap_buffers_t egl_swap_buffers = NULL;
+static egl_make_current_t egl_make_current = NULL;
+static egl_destroy_surface_t egl_destroy_surface = NULL;
+static egl_destroy_context_t egl_destroy_context = NULL;
+static egl_terminate_t egl_terminate = NULL;
+/// The display, pbuffer and context offscreen_init made
+static egl_display_t display = NULL;
+static egl_surface_t surface = NULL;
+static egl_context_t context = NULL;
+
+/// Hands eglGetProcAddress to echo_glext_set_loader
+static void* get_proc(const char* name)
+{
+	return(egl_get_proc_address(name));
+}
+
+STATUS offscreen_init(int w, int h)
+{
+	lib = dlopen("libEGL.so.1", RTLD_NOW | RTLD_LOCAL);
+	if(!lib)
+		lib = dlopen("libEGL.so", RTLD_NOW | RTLD_LOCAL);
+	if(!lib)
+	{
+		ECHO_PRINT("offscreen: can't load libEGL (%s)\n", dlerror());
+		return(FAIL);
+	}
+	egl_get_proc_address = (egl_get_proc_address_t)dlsym(lib, "eglGetProcAddress");
+	egl_get_display_t egl_get_display = (egl_get_display_t)dlsym(lib, "eglGetDisplay");
+	egl_initialize_t egl_initialize = (egl_initialize_t)dlsym(lib, "eglInitialize");
+	egl_choose_config_t egl_choose_config = (egl_choose_config_t)dlsym(lib, "eglChooseConfig");
+	egl_create_pbuffer_surface_t egl_create_pbuffer_surface
+		= (egl_create_pbuffer_surface_t)dlsym(lib, "eglCreatePbufferSurface");
+	egl_bind_api_t egl_bind_api = (egl_bind_api_t)dlsym(lib, "eglBindAPI");
+	egl_create_context_t egl_create_context = (egl_create_context_t)dlsym(lib, "eglCreateContext");
+	egl_make_current = (egl_make_current_t)dlsym(lib, "eglMakeCurrent");
+	egl_swap_buffers = (egl_swap_buffers_t)dlsym(lib, "eglSwapBuffers");
+	egl_destroy_surface = (egl_destroy_surface_t)dlsym(lib, "eglDestroySurface");
+	egl_destroy_context = (egl_destroy_context_t)dlsym(lib, "eglDestroyContext");
+	egl_terminate = (egl_terminate_t)dlsym(lib, "eglTerminate");
+	if(!egl_get_proc_address || !egl_get_display || !egl_initialize || !egl_choose_config
+		|| !egl_create_pbuffer_surface || !egl_bind_api || !egl_create_context || !egl_make_current
+		|| !egl_swap_buffers || !egl_destroy_surface || !egl_destroy_context || !egl_terminate)
+	{
+		ECHO_PRINT("offscreen: libEGL is missing functions\n");
+		offscreen_free();
+		return(FAIL);
+	}
+	
+	/// Mesa's surfaceless platform needs no X server or GPU; otherwise take the default display
+	egl_get_platform_display_t egl_get_platform_display
+		= (egl_get_platform_display_t)egl_get_proc_address("eglGetPlatformDisplayEXT");
+	if(egl_get_platform_display)
+		display = egl_get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, NULL, NULL);
+	if(!display || !egl_initialize(display, NULL, NULL))
+	{
+		display = egl_get_display(NULL);
+		if(!display || !egl_initialize(display, NULL, NULL))
+		{
+			ECHO_PRINT("offscreen: no EGL display\n");
+			display = NULL;
+			offscreen_free();
+			return(FAIL);
+		}
+	}
+	const egl_int_t config_attribs[] = 
+	{
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT
+		, EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8
+		, EGL_DEPTH_SIZE, 24, EGL_NONE
+	};
+	egl_config_t config = NULL;
+	egl_int_t num_configs = 0;
+	if(!egl_choose_config(display, config_attribs, &config, 1, &num_configs) || num_configs < 1)
+	{
+		ECHO_PRINT("offscreen: no desktop GL pbuffer config\n");
+		offscreen_free();
+		return(FAIL);
+	}
+	const egl_int_t surface_attribs[] = {EGL_WIDTH, w, EGL_HEIGHT, h, EGL_NONE};
+	surface = egl_create_pbuffer_surface(display, config, surface_attribs);
+	egl_bind_api(EGL_OPENGL_API);
+	context = egl_create_context(display, config, NULL, NULL);
+	if(!surface || !context || !egl_make_current(display, surface, surface, context))
+	{
+		ECHO_PRINT("offscreen: can't make a %ix%i context\n", w, h);
+		offscreen_free();
+		return(FAIL);
+	}
+	/// GLX's lookup isn't guaranteed to work with an EGL context
+	echo_glext_set_loader(&get_proc);
+	return(WIN);
+}
+
+void offscreen_swap()
+{
+	if(surface)
+		egl_swap_buffers(display, surface);
+}
+
+void offscreen_free()
+{
+	if(display)
+	{
+		egl_make_current(display, NULL, NULL, NULL);
+		if(context)
+			egl_destroy_context(display, context);
+		if(surface)
+			egl_destroy_surface(display, surface);
+		egl_terminate(display);
+	}
+	display = surface = context = NULL;
+	echo_glext_set_loader(NULL);
+	if(lib)
+		dlclose(lib);
+	lib = NULL;
+}
+
+#elif !defined(ECHO_NDS)
+
+STATUS offscreen_init(int w, int h)
+{
+	ECHO_PRINT("offscreen: only EGL (Linux/BSD with Mesa) is supported\n");
+	return(FAIL);
+}
+
+void offscreen_swap()
+{
+}
+
+void offscreen_free()
+{
+}
+
+#endif
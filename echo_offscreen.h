@@ -0,0 +1,42 @@
+// echo_offscreen.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+
+#ifndef __ECHO_OFFSCREEN__
+#define __ECHO_OFFSCREEN__
+
+#ifndef ECHO_NDS
+/** Makes a GL context with no window (EGL pbuffer on Mesa's surfaceless
+ * platform, so no display is needed) and makes it current, for the -o
+ * benchmark.  libEGL is loaded at run time, so L-Echo doesn't link to it.
+ * @param w Width of the pbuffer
+ * @param h Height of the pbuffer
+ * @return WIN if the context is current, FAIL if there is no EGL (or not on this platform)
+ */
+STATUS offscreen_init(int w, int h);
+/// Swaps the pbuffer (the end of a frame)
+void offscreen_swap();
+/// Destroys the context and unloads libEGL
+void offscreen_free();
+#endif
+
+#endif
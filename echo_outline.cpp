@@ -0,0 +1,278 @@
+// echo_outline.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+
+#ifndef ECHO_NDS
+
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_glext.h"
+#include "echo_outline.h"
+
+#ifdef ECHO_OSX	//OS X
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// How far behind a surface (world units) the next one has to be to get an outline
+#define OUTLINE_GAP			0.02f
+/// Steepest surface (tangent of its tilt away from the screen) whose slope is followed
+#define OUTLINE_MAX_SLOPE	4.0f
+
+static const char* vertex_source =
+	"void main()\n"
+	"{\n"
+	"	gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+	"	gl_Position = gl_Vertex;\n"
+	"}\n";
+
+/** A pixel is outlined when a surface within RADIUS pixels, extended to the
+ * pixel along its slope, is in front of it by more than gap.  The slope is
+ * the surface's own, or the pixel's if the surface is too thin to tell (a
+ * slope steeper than max_slope is likely another surface); like the
+ * thick lines of the two-pass outline, the outline lands outside the nearer
+ * surface.  Depth is linear in screen space (the projection is orthogonal),
+ * so planes extend exactly.
+ */
+static const char* fragment_source =
+	"#define RADIUS 2\n"
+	"uniform sampler2D color_tex;\n"
+	"uniform sampler2D depth_tex;\n"
+	"uniform vec2 texel;\n"
+	"uniform float gap;\n"
+	"uniform float max_slope;\n"
+	"void main()\n"
+	"{\n"
+	"	vec2 uv = gl_TexCoord[0].st;\n"
+	"	float d = texture2D(depth_tex, uv).r;\n"
+	"	float nearest = d;\n"
+	"	for(int x = -1; x <= 1; x++)\n"
+	"	{\n"
+	"		for(int y = -1; y <= 1; y++)\n"
+	"		{\n"
+	"			if(x == 0 && y == 0)\n"
+	"				continue;\n"
+	"			vec2 dir = vec2(float(x), float(y)) * texel;\n"
+	"			float back = texture2D(depth_tex, uv - dir).r;\n"
+	"			float own = abs(d - back) < max_slope && back < 1.0 ? d - back : 0.0;\n"
+	"			for(int r = 1; r <= RADIUS; r++)\n"
+	"			{\n"
+	"				float n1 = texture2D(depth_tex, uv + dir * float(r)).r;\n"
+	"				float n2 = texture2D(depth_tex, uv + dir * float(r + 1)).r;\n"
+	"				float slope = abs(n2 - n1) < max_slope && n2 < 1.0 ? n2 - n1 : own;\n"
+	"				if(n1 < 1.0 && d > n1 - slope * float(r) + gap)\n"
+	"					nearest = min(nearest, n1);\n"
+	"			}\n"
+	"		}\n"
+	"	}\n"
+	"	if(nearest < d)\n"
+	"	{\n"
+	"		gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
+	"		gl_FragDepth = nearest;\n"
+	"	}\n"
+	"	else if(d >= 1.0)\n"
+	"		discard;\n"
+	"	else\n"
+	"	{\n"
+	"		gl_FragColor = texture2D(color_tex, uv);\n"
+	"		gl_FragDepth = d;\n"
+	"	}\n"
+	"}\n";
+
+/// The current mode (OUTLINE_TWO_PASS or OUTLINE_SCREEN)
+static int mode = OUTLINE_TWO_PASS;
+/// Did gfx_screen_outline_init succeed?
+static int supported = 0;
+/// Is the world being drawn offscreen right now?
+static int active = 0;
+/// The offscreen target and its color and depth textures
+static GLuint fbo = 0, color_tex = 0, depth_tex = 0;
+/// The edge shader
+static GLuint program = 0;
+static GLint texel_loc = -1, gap_loc = -1, max_slope_loc = -1;
+/// Size of the textures
+static int tex_w = 0, tex_h = 0;
+/// Gap between surfaces, in depth buffer units
+static float depth_gap = 0;
+
+STATUS gfx_screen_outline_init()
+{
+	echo_glext_init();
+	if(program)
+		return(WIN);
+	if(!echo_glext_has_fbo() || !echo_glext_has_glsl())
+	{
+		ECHO_PRINT("no framebuffers or shaders; outlines are drawn in two passes\n");
+		return(FAIL);
+	}
+	program = echo_glext_program(vertex_source, fragment_source, "outline");
+	if(!program)
+		return(FAIL);
+	echo_glUseProgram(program);
+	echo_glUniform1i(echo_glGetUniformLocation(program, "color_tex"), 0);
+	echo_glUniform1i(echo_glGetUniformLocation(program, "depth_tex"), 1);
+	texel_loc = echo_glGetUniformLocation(program, "texel");
+	gap_loc = echo_glGetUniformLocation(program, "gap");
+	max_slope_loc = echo_glGetUniformLocation(program, "max_slope");
+	echo_glUseProgram(0);
+	supported = 1;
+	return(WIN);
+}
+
+/// Makes one of the offscreen textures
+static GLuint make_texture(GLint format, GLenum data_format, GLenum type, int w, int h)
+{
+	GLuint tex = 0;
+	glGenTextures(1, &tex);
+	glBindTexture(GL_TEXTURE_2D, tex);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, data_format, type, NULL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return(tex);
+}
+/// Deletes the offscreen target and its textures
+static void delete_targets()
+{
+	if(fbo)
+		echo_glDeleteFramebuffers(1, &fbo);
+	if(color_tex)
+		glDeleteTextures(1, &color_tex);
+	if(depth_tex)
+		glDeleteTextures(1, &depth_tex);
+	fbo = color_tex = depth_tex = 0;
+	tex_w = tex_h = 0;
+}
+
+void gfx_screen_outline_resize(int w, int h, float depth)
+{
+	depth_gap = depth > 0 ? OUTLINE_GAP / (2 * depth) : 0;
+	if(!supported || (w == tex_w && h == tex_h))
+		return;
+	delete_targets();
+	color_tex = make_texture(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, w, h);
+	depth_tex = make_texture(GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, w, h);
+	echo_glGenFramebuffers(1, &fbo);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	echo_glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_tex, 0);
+	echo_glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depth_tex, 0);
+	const GLenum status = echo_glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if(status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		ECHO_PRINT("outline framebuffer is incomplete (0x%x); outlines are drawn in two passes\n", status);
+		delete_targets();
+		supported = 0;
+		mode = OUTLINE_TWO_PASS;
+		return;
+	}
+	tex_w = w;
+	tex_h = h;
+}
+
+void gfx_screen_outline_free()
+{
+	delete_targets();
+	if(program)
+		echo_glDeleteProgram(program);
+	program = 0;
+	supported = 0;
+	mode = OUTLINE_TWO_PASS;
+}
+
+int gfx_set_outline_mode(int new_mode)
+{
+	mode = (new_mode == OUTLINE_SCREEN && supported) ? OUTLINE_SCREEN : OUTLINE_TWO_PASS;
+	return(mode);
+}
+
+int gfx_get_outline_mode()
+{
+	return(mode);
+}
+
+void gfx_screen_outline_begin()
+{
+	if(mode != OUTLINE_SCREEN || !fbo)
+		return;
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	active = 1;
+}
+
+int gfx_screen_outline_end()
+{
+	if(!active)
+		return(0);
+	active = 0;
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	
+	glPushAttrib(GL_ALL_ATTRIB_BITS);
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	
+	/// The world was already blended offscreen; the depth test keeps the HUD's order
+	glDisable(GL_BLEND);
+	glEnable(GL_DEPTH_TEST);
+	echo_glUseProgram(program);
+	echo_glUniform2f(texel_loc, 1.0f / tex_w, 1.0f / tex_h);
+	echo_glUniform1f(gap_loc, depth_gap);
+	/// Depth changes by the tangent over the height per pixel (the projection is 2 * depth tall and deep)
+	echo_glUniform1f(max_slope_loc, OUTLINE_MAX_SLOPE / tex_h);
+	echo_glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, depth_tex);
+	echo_glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, color_tex);
+	glBegin(GL_QUADS);
+	{
+		glTexCoord2f(0, 0);	glVertex2f(-1, -1);
+		glTexCoord2f(1, 0);	glVertex2f(1, -1);
+		glTexCoord2f(1, 1);	glVertex2f(1, 1);
+		glTexCoord2f(0, 1);	glVertex2f(-1, 1);
+	}
+	glEnd();
+	glBindTexture(GL_TEXTURE_2D, 0);
+	echo_glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	echo_glActiveTexture(GL_TEXTURE0);
+	echo_glUseProgram(0);
+	
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	glPopAttrib();
+	return(1);
+}
+
+int gfx_screen_outline_active()
+{
+	return(active);
+}
+
+#endif
@@ -0,0 +1,61 @@
+// echo_outline.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+
+#ifndef __ECHO_OUTLINE__
+#define __ECHO_OUTLINE__
+
+#ifndef ECHO_NDS
+/// Outline by drawing everything twice: thick lines, then the fill (see gfx_outline_start)
+#define OUTLINE_TWO_PASS	0
+/// Outline by drawing once offscreen, then finding the edges in the depth buffer
+#define OUTLINE_SCREEN		1
+
+/** Compiles the edge shader; needs a context.
+ * @return WIN if OUTLINE_SCREEN can be used
+ */
+STATUS gfx_screen_outline_init();
+/** Resizes the offscreen targets to the window
+ * @param w Window width (pixels)
+ * @param h Window height (pixels)
+ * @param depth Half the depth of the projection (see resize() in main.cpp)
+ */
+void gfx_screen_outline_resize(int w, int h, float depth);
+/// Deletes the offscreen targets and the shader
+void gfx_screen_outline_free();
+/** Picks how outlines are drawn; OUTLINE_SCREEN falls back to OUTLINE_TWO_PASS if it isn't supported
+ * @return The mode that is now used
+ */
+int gfx_set_outline_mode(int mode);
+/// Gets how outlines are drawn
+int gfx_get_outline_mode();
+/// Call before drawing the world; with OUTLINE_SCREEN, the world is drawn offscreen
+void gfx_screen_outline_begin();
+/** Call after drawing the world; with OUTLINE_SCREEN, finds the edges and puts the world on the screen
+ * @return Was the world drawn offscreen?  (then the goals still have to be drawn)
+ */
+int gfx_screen_outline_end();
+/// Is the world being drawn offscreen right now?  (then gfx_outline_start skips the line pass)
+int gfx_screen_outline_active();
+#endif
+
+#endif
@@ -41,3 +41,7 @@
         #endif
 #endif
 
+#if defined(ECHO_PC) && defined(__SSE2__)
+        /// The batch kernels (see camera_basis, lineSeg_intersect_batch) can use SSE2
+        #define                                                         ECHO_SSE                1
+#endif
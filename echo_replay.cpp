@@ -0,0 +1,406 @@
+// echo_replay.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "echo_platform.h"
+#include "echo_sys.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_math.h"
+#include "echo_loader.h"
+#include "echo_stage.h"
+#include "echo_character.h"
+#include "echo_world.h"
+#include "echo_thread.h"
+#include "echo_bench.h"
+#include "echo_replay.h"
+
+#ifndef ECHO_NDS
+
+/// Longest line of a script
+#define REPLAY_LINE_MAX		256
+/// How far turn may tilt the camera up or down (like the arrow keys in main.cpp)
+#define REPLAY_PITCH_MAX	60
+/// The default script turns the camera this much...
+#define REPLAY_TURN			5
+/// ...every this many frames (and tilts it every REPLAY_TILT_EVERY)
+#define REPLAY_TURN_EVERY	7
+#define REPLAY_TILT_EVERY	11
+/// The default script toggles running every this many frames
+#define REPLAY_RUN_EVERY	97
+
+/// What a line of a script does
+enum REPLAY_ACTION { REPLAY_START, REPLAY_PAUSE, REPLAY_WALK, REPLAY_RUN, REPLAY_TOGGLE_RUN
+						, REPLAY_ANGLE, REPLAY_TURN_BY, REPLAY_NUM_ACTIONS };
+/// How the actions are spelled in a script
+static const char* replay_action_names[REPLAY_NUM_ACTIONS] = {"start", "pause", "walk", "run", "toggle_run", "angle", "turn"};
+
+/// A line of a script
+struct replay_event
+{
+	/// The frame it happens on (before that frame's update)
+	int frame;
+	/// A REPLAY_ACTION
+	int action;
+	/// The angles of angle and turn
+	float x, y;
+};
+
+/** Reads a script
+ * @param script_name The file
+ * @param events Where to add its lines
+ * @return WIN if it was read, FAIL otherwise (and the problem is printed)
+ */
+static STATUS read_script(char* script_name, std::vector<replay_event>* events)
+{
+	FILE* script = fopen(script_name, "r");
+	if(script == NULL)
+	{
+		ECHO_PRINT("couldn't open %s\n", script_name);
+		return(FAIL);
+	}
+	char line[REPLAY_LINE_MAX];
+	int line_num = 0, last_frame = 0;
+	STATUS ret = WIN;
+	while(ret == WIN && fgets(line, REPLAY_LINE_MAX, script) != NULL)
+	{
+		line_num++;
+		replay_event event;
+		char action[REPLAY_LINE_MAX];
+		event.x = event.y = 0;
+		const int fields = sscanf(line, "%d %s %f %f", &event.frame, action, &event.x, &event.y);
+		/// Blank lines and comments
+		if(fields <= 0 || line[strspn(line, " \t")] == '#')
+			ret = WIN;
+		else if(fields < 2 || event.frame < last_frame)
+		{
+			ECHO_PRINT("%s:%i: expected a frame (no earlier than the last) and an action\n", script_name, line_num);
+			ret = FAIL;
+		}
+		else
+		{
+			event.action = 0;
+			while(event.action < REPLAY_NUM_ACTIONS && strcmp(action, replay_action_names[event.action]))
+				event.action++;
+			if(event.action == REPLAY_NUM_ACTIONS)
+			{
+				ECHO_PRINT("%s:%i: unknown action %s\n", script_name, line_num, action);
+				ret = FAIL;
+			}
+			else if((event.action == REPLAY_ANGLE || event.action == REPLAY_TURN_BY) && fields < 4)
+			{
+				ECHO_PRINT("%s:%i: %s needs an x and a y angle\n", script_name, line_num, action);
+				ret = FAIL;
+			}
+			else
+			{
+				last_frame = event.frame;
+				events->push_back(event);
+			}
+		}
+	}
+	fclose(script);
+	return(ret);
+}
+
+/** Makes the script used when there is none: start at once, turn the camera
+ * left and tilt it up and down now and then, and toggle running
+ * @param frames Number of frames it covers
+ * @param events Where to add its lines
+ */
+static void default_script(int frames, std::vector<replay_event>* events)
+{
+	replay_event event;
+	event.frame = 0;
+	event.action = REPLAY_START;
+	event.x = event.y = 0;
+	events->push_back(event);
+	/// Where the camera is tilted to, and which way it is going
+	float pitch = 0, tilt = REPLAY_TURN;
+	int frame = 0;
+	while(frame < frames)
+	{
+		event.frame = frame;
+		event.x = event.y = 0;
+		if(frame % REPLAY_TURN_EVERY == 0)
+			event.y = REPLAY_TURN;
+		if(frame % REPLAY_TILT_EVERY == 0)
+		{
+			/// Bounce between the limits
+			if(pitch + tilt > REPLAY_PITCH_MAX || pitch + tilt < -REPLAY_PITCH_MAX)
+				tilt = -tilt;
+			pitch += tilt;
+			event.x = tilt;
+		}
+		if(event.x != 0 || event.y != 0)
+		{
+			event.action = REPLAY_TURN_BY;
+			events->push_back(event);
+		}
+		if(frame % REPLAY_RUN_EVERY == 0)
+		{
+			event.action = REPLAY_TOGGLE_RUN;
+			events->push_back(event);
+		}
+		frame++;
+	}
+}
+
+/** Does what a line of a script says
+ * @param world The world it happens in
+ * @param event The line
+ */
+static void replay_do(echo_world* world, const replay_event* event)
+{
+	switch(event->action)
+	{
+		case REPLAY_START:
+			world->start();
+			break;
+		case REPLAY_PAUSE:
+			world->toggle_pause();
+			break;
+		case REPLAY_WALK:
+			world->start_step();
+			break;
+		case REPLAY_RUN:
+			world->start_run();
+			break;
+		case REPLAY_TOGGLE_RUN:
+			world->toggle_run();
+			break;
+		case REPLAY_ANGLE:
+			world->angle.x = event->x;
+			world->angle.y = event->y;
+			break;
+		case REPLAY_TURN_BY:
+			/// Tilt no further than the arrow keys can
+			world->angle.x += event->x;
+			if(world->angle.x > REPLAY_PITCH_MAX)
+				world->angle.x = REPLAY_PITCH_MAX;
+			else if(world->angle.x < -REPLAY_PITCH_MAX)
+				world->angle.x = -REPLAY_PITCH_MAX;
+			world->angle.y += event->y;
+			if(world->angle.y > 180)
+				world->angle.y -= 360;
+			else if(world->angle.y < -180)
+				world->angle.y += 360;
+			break;
+	}
+}
+
+/** Plays a world through a script
+ * @param world The world, with its stage loaded
+ * @param events The script
+ * @param frames Number of frames to play
+ * @return The hash of the character's state over every frame
+ */
+static unsigned int replay_play(echo_world* world, const std::vector<replay_event>* events, int frames)
+{
+	world->angle.set(0, 0, 0);
+	unsigned int hash = 2166136261u;
+	unsigned int next = 0;
+	int frame = 0;
+	while(frame < frames)
+	{
+		while(next < events->size() && (*events)[next].frame == frame)
+		{
+			replay_do(world, &(*events)[next]);
+			next++;
+		}
+		world->update();
+		hash = world->hash_state(hash);
+		frame++;
+	}
+	return(hash);
+}
+
+/** Plays a stage without the GL or a window, as fast as the CPU goes, following
+ * a script of inputs; one frame is one update (WAIT of game time).
+ * @param file_name The stage file
+ * @param script_name The script, or NULL to start at once and turn the camera now and then
+ * @param frames Number of frames to play
+ * @return 0 if it played, 1 if the stage or script couldn't be read (usable as an exit code)
+ */
+int echo_replay(char* file_name, char* script_name, int frames)
+{
+	std::vector<replay_event> events;
+	if(script_name != NULL)
+	{
+		if(read_script(script_name, &events) == FAIL)
+			return(1);
+	}
+	else
+		default_script(frames, &events);
+	
+	stage* st = load_stage(file_name);
+	if(st == NULL)
+	{
+		ECHO_PRINT("couldn't load %s\n", file_name);
+		return(1);
+	}
+	echo_world world;
+	world.init(st);
+	
+	const double start = echo_bench_now();
+	const unsigned int hash = replay_play(&world, &events, frames);
+	const double time = echo_bench_now() - start;
+	
+	ECHO_PRINT("%s: %i frames (%.1f s of game time), %s\n", file_name, frames, frames * WAIT / 1000
+			, script_name != NULL ? script_name : "default script");
+	ECHO_PRINT("\tgoals       %i of %i\n", world.num_goals_reached(), world.num_goals());
+	ECHO_PRINT("\tstate hash  %08x\n", hash);
+	ECHO_PRINT("\ttime        %.0f ns/frame, %.0fx real time\n", time / frames * 1e9
+			, time > 0 ? frames * WAIT / 1000 / time : 0);
+	if(events.size() > 0 && events.back().frame >= frames)
+		ECHO_PRINT("\t(some lines of the script are past the last frame)\n");
+	return(0);
+}
+
+/// A batch replay: the worlds, and what to play them through
+struct replay_batch
+{
+	/// One world per stage
+	echo_world* worlds;
+	/// The hash each world's replay ended with
+	unsigned int* hashes;
+	/// The script, and how many frames to play
+	const std::vector<replay_event>* events;
+	int frames;
+};
+
+/** A job of the batch replay: plays one world
+ * @param arg The replay_batch
+ * @param index Which world
+ */
+static void replay_job(void* arg, int index)
+{
+	replay_batch* batch = (replay_batch*)arg;
+	batch->hashes[index] = replay_play(&batch->worlds[index], batch->events, batch->frames);
+}
+
+/** Loads a batch of stages (each into a world of its own) and fills in a replay_batch for them
+ * @param batch The batch; worlds and hashes get allocated
+ * @param file_names The stage files
+ * @param num_files How many
+ * @return WIN if they all loaded
+ */
+static STATUS load_batch(replay_batch* batch, char** file_names, int num_files)
+{
+	batch->worlds = new echo_world[num_files];
+	batch->hashes = new unsigned int[num_files];
+	int each = 0;
+	while(each < num_files)
+	{
+		stage* st = load_stage(file_names[each]);
+		if(st == NULL)
+		{
+			ECHO_PRINT("couldn't load %s\n", file_names[each]);
+			return(FAIL);
+		}
+		batch->worlds[each].init(st);
+		each++;
+	}
+	return(WIN);
+}
+
+/** Plays many stages, each in an echo_world of its own, with the default script of echo_replay;
+ * first one after the other, then all at once on a pool of threads. Prints the goals and hash of
+ * each stage, checks that both runs agree, and prints how long each run took.
+ * @param file_names The stage files
+ * @param num_files How many
+ * @param threads Number of threads to play them on (0 for one per CPU)
+ * @param frames Number of frames to play each stage
+ * @return 0 if both runs agree, 1 if they don't or a stage couldn't be read (usable as an exit code)
+ */
+int echo_replay_batch(char** file_names, int num_files, int threads, int frames)
+{
+	if(threads <= 0)
+		threads = echo_cpu_count();
+	std::vector<replay_event> events;
+	default_script(frames, &events);
+	
+	/// One after the other...
+	replay_batch serial, pooled;
+	serial.worlds = pooled.worlds = NULL;
+	serial.hashes = pooled.hashes = NULL;
+	serial.events = &events;
+	serial.frames = frames;
+	int ret = load_batch(&serial, file_names, num_files) == WIN ? 0 : 1;
+	double serial_time = 0;
+	if(ret == 0)
+	{
+		const double start = echo_bench_now();
+		int each = 0;
+		while(each < num_files)
+		{
+			replay_job(&serial, each);
+			each++;
+		}
+		serial_time = echo_bench_now() - start;
+	}
+	
+	/// ...then all at once, on fresh copies of the stages
+	pooled.events = &events;
+	pooled.frames = frames;
+	if(ret == 0)
+		ret = load_batch(&pooled, file_names, num_files) == WIN ? 0 : 1;
+	double pooled_time = 0;
+	if(ret == 0)
+	{
+		echo_pool pool;
+		/// The calling thread is one of the threads
+		echo_pool_start(&pool, threads - 1);
+		const double start = echo_bench_now();
+		echo_pool_run(&pool, replay_job, &pooled, num_files);
+		pooled_time = echo_bench_now() - start;
+		echo_pool_stop(&pool);
+	}
+	
+	if(ret == 0)
+	{
+		ECHO_PRINT("%i stages, %i frames each, default script\n", num_files, frames);
+		ECHO_PRINT("\tstage                        goals    hash      on the pool\n");
+		int each = 0;
+		while(each < num_files)
+		{
+			const int same = serial.hashes[each] == pooled.hashes[each];
+			ECHO_PRINT("\t%-26s %3i of %-3i %08x  %s\n", file_names[each]
+					, serial.worlds[each].num_goals_reached(), serial.worlds[each].num_goals()
+					, serial.hashes[each], same ? "same" : "DIFFERENT");
+			if(!same)
+				ret = 1;
+			each++;
+		}
+		const double total = (double)num_files * frames;
+		ECHO_PRINT("\tone thread   %10.3f s, %.0f ns/frame\n", serial_time, serial_time / total * 1e9);
+		ECHO_PRINT("\t%2i threads   %10.3f s, %.0f ns/frame, %.2fx\n", threads, pooled_time
+				, pooled_time / total * 1e9, pooled_time > 0 ? serial_time / pooled_time : 0);
+	}
+	delete[] serial.worlds;
+	delete[] serial.hashes;
+	delete[] pooled.worlds;
+	delete[] pooled.hashes;
+	return(ret);
+}
+#endif
@@ -0,0 +1,51 @@
+// echo_replay.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+
+#ifndef __ECHO_REPLAY__
+#define __ECHO_REPLAY__
+#ifndef ECHO_NDS
+/** Plays a stage without the GL or a window, as fast as the CPU goes, following
+ * a script of inputs; one frame is one update (WAIT of game time).\n
+ * Prints the goals reached, a hash of the character's state over every frame
+ * (the same on every run, so it can be checked against a known good one) and the time per frame.\n
+ * Each line of the script is a frame number and what happens then, in order of frame:\n
+ * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp; start, pause (toggles), walk, run, toggle_run,\n
+ * &nbsp;&nbsp;&nbsp;&nbsp;&nbsp; angle x y (sets the camera angle), turn x y (turns it, like the arrow keys)\n
+ * Blank lines and lines starting with # are skipped.
+ * @param file_name The stage file
+ * @param script_name The script, or NULL to start at once and turn the camera now and then
+ * @param frames Number of frames to play
+ * @return 0 if it played, 1 if the stage or script couldn't be read (usable as an exit code)
+ */
+int echo_replay(char* file_name, char* script_name, int frames);
+/** Plays many stages, each in an echo_world of its own, with the default script of echo_replay;
+ * first one after the other, then all at once on a pool of threads. Prints the goals and hash of
+ * each stage, checks that both runs agree, and prints how long each run took.
+ * @param file_names The stage files
+ * @param num_files How many
+ * @param threads Number of threads to play them on (0 for one per CPU)
+ * @param frames Number of frames to play each stage
+ * @return 0 if both runs agree, 1 if they don't or a stage couldn't be read (usable as an exit code)
+ */
+int echo_replay_batch(char** file_names, int num_files, int threads, int frames);
+#endif
+#endif
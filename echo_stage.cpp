@@ -28,6 +28,12 @@
 #include "grid.h"
 #include "echo_stage.h"
 #include "echo_gfx.h"
+#include "echo_outline.h"
+
+/// How far past its corners a grid can draw: stairs, markers and the outline (world units)
+#define CULL_MARGIN			1.0f
+/// How far past its corners a goal can draw: the mannequin standing on it
+#define CULL_GOAL_MARGIN	3.0f
 
 stage::stage()
 {
@@ -43,7 +49,26 @@ void stage::init(grid* my_start, std::string* my_name, int my_num_goals)
 {
 	farthest = 0;
 	lowest = FLT_MAX;
-	grids = new STAGE_MAP();
+	names = new STAGE_NAMES();
+	arena = new grid_arena();
+	top_grids = new std::vector<grid*>();
+	
+	corner_x = corner_y = corner_z = NULL;
+	proj_x = proj_y = NULL;
+	edge_x1 = edge_y1 = edge_x2 = edge_y2 = NULL;
+	edge_owner = NULL;
+	edge_hits = NULL;
+	num_edges = 0;
+	visible = NULL;
+	num_drawn = num_culled = 0;
+	landing_index = new screen_index();
+	view = new stage_view();
+#ifndef ECHO_NDS
+	mesh = NULL;
+#endif
+	num_corners = 0;
+	corners_built = 0;
+	projected = 0;
 	
 	
 	start = my_start;
@@ -56,23 +81,43 @@ stage::~stage()
 	if(name != NULL)
 		delete name;
 	
-	STAGE_MAP::iterator it = grids->begin();
-	STAGE_MAP::iterator end = grids->end();
-	while(it != end)
-	{
-		if(it->second != NULL)
-			delete it->second;
-	    ++it;
-	}
-	delete grids;
+	delete names;
+	delete top_grids;
+	
+	delete[] corner_x;
+	delete[] corner_y;
+	delete[] corner_z;
+	delete[] proj_x;
+	delete[] proj_y;
+	delete[] edge_x1;
+	delete[] edge_y1;
+	delete[] edge_x2;
+	delete[] edge_y2;
+	delete[] edge_owner;
+	delete[] edge_hits;
+	delete[] visible;
+	delete landing_index;
+	delete view;
+#ifndef ECHO_NDS
+	delete mesh;
+#endif
+	/// The grids and everything they have are in the arena, so they go with it, without being destructed
+	delete arena;
 }
 /** Adds the grid with the id.
  * @param id The id of the grid to add
  * @param ptr The grid to add
  */
-void stage::add(std::string id, grid* ptr)
+grid_id_t stage::add(std::string id, grid* ptr)
 {
-    grids->insert(STAGE_MAP::value_type(id, ptr));
+    const grid_id_t new_id = (grid_id_t)top_grids->size();
+    std::pair<STAGE_NAMES::iterator, bool> added = names->insert(STAGE_NAMES::value_type(id, new_id));
+    if(!added.second)
+        return(added.first->second);
+    top_grids->push_back(ptr);
+    /// The corner arrays will have to be rebuilt
+    corners_built = 0;
+    return(new_id);
 }
 /** Adds the position of the grid.  It was used in the old holes and launchers
  * implementation, but used right now just to calculate the lowest position.
@@ -92,45 +137,194 @@ float stage::get_lowest_level()
 /// Gets a grid with the given string id
 grid* stage::get(std::string id)
 {
-    STAGE_MAP::iterator pos = grids->find(id);
-    if(pos == grids->end())
+    if(names == NULL)
+        return(NULL);
+    STAGE_NAMES::iterator pos = names->find(id);
+    if(pos == names->end())
         return(NULL);
-    return(pos->second);
+    return((*top_grids)[pos->second]);
+}
+/// Gets a grid with the given dense id (NULL if there's no such grid)
+grid* stage::get(grid_id_t id)
+{
+    return(id < top_grids->size() ? (*top_grids)[id] : NULL);
+}
+/// Gets the number of top-level grids; the dense ids go from 0 to this
+grid_id_t stage::get_num_grids()
+{
+    return((grid_id_t)top_grids->size());
+}
+/** Forgets the string ids, and renumbers the grids in string id order; the loader is done linking the grids,
+ * so their ids from add are no good after this
+ */
+void stage::drop_names()
+{
+    if(names == NULL)
+        return;
+    /// The string ids are sorted, so this is the order the stage kept its grids in before it had dense ids
+    std::vector<grid*> sorted;
+    sorted.reserve(top_grids->size());
+    STAGE_NAMES::iterator it = names->begin();
+    while(it != names->end())
+    {
+        sorted.push_back((*top_grids)[it->second]);
+        it++;
+    }
+    top_grids->swap(sorted);
+    /// The corner arrays will have to be rebuilt
+    corners_built = 0;
+    delete names;
+    names = NULL;
+}
+/// Gets the arena the stage's grids (and everything they have) should be allocated in
+grid_arena* stage::get_arena()
+{
+    return(arena);
+}
+#ifdef ECHO_NDS
+/** Draws a grid of the view: the grid it resolves to, and whatever each grid on the way adds over that
+ * @param view The view
+ * @param index Index of the grid in the view
+ * @param angle Current camera angle
+ */
+static void draw_view_grid(const stage_view* view, int index, vector3f angle)
+{
+	grid* g = view->get_grid(index);
+	grid* active = view->get_active(index);
+	active->draw(angle);
+	/// A hole or launcher can be an esc of an escgrid, and so on
+	while(g != NULL && g != active)
+	{
+		g->draw_marker(view->get_pos(index));
+		g = g->resolve_step(angle);
+	}
 }
-/// Draws all the grids
+#endif
+/** Marks the grids of the view whose corners (plus a margin for stairs,
+ * outlines and goals) overlap the projection (see gfx_set_view)
+ * @param v The view, built for angle
+ * @param angle Current camera angle
+ */
+void stage::cull(const stage_view* v, vector3f angle)
+{
+	if(!corners_built)
+		build_corners();
+	/** The modelview turns about y, then x (see main.cpp), the opposite order of
+	 * Screen Position, so proj_x and proj_y can't be used here
+	 */
+	const camera_basis basis(angle);
+	num_drawn = num_culled = 0;
+	const int size = v->get_size();
+	int index = 0;
+	while(index < size)
+	{
+		visible[index] = 0;
+		if(v->should_draw(index))
+		{
+			const int c = v->get_active(index)->get_corner_index();
+			/// Without corners there is nothing to go by
+			int in = 1;
+			if(c >= 0)
+			{
+				vector3f eye = basis.neg_rotate_yx(vector3f(corner_x[c], corner_y[c], corner_z[c]));
+				float min_x = eye.x, max_x = eye.x, min_y = eye.y, max_y = eye.y;
+				int pt = 1;
+				while(pt < 4)
+				{
+					eye = basis.neg_rotate_yx(vector3f(corner_x[c + pt], corner_y[c + pt], corner_z[c + pt]));
+					if(eye.x < min_x)
+						min_x = eye.x;
+					if(eye.x > max_x)
+						max_x = eye.x;
+					if(eye.y < min_y)
+						min_y = eye.y;
+					if(eye.y > max_y)
+						max_y = eye.y;
+					pt++;
+				}
+				/// A goal's mannequin stands well above its grid
+				const float margin = v->is_goal(index) ? CULL_GOAL_MARGIN : CULL_MARGIN;
+				in = gfx_rect_in_view(min_x - margin, min_y - margin, max_x + margin, max_y + margin);
+			}
+			visible[index] = in;
+			if(in)
+				num_drawn++;
+			else
+				num_culled++;
+		}
+		index++;
+	}
+}
+/// Draws all the grids that are on the screen
 void stage::draw(vector3f angle)
 {
-	STAGE_MAP::iterator it = grids->begin();
-	STAGE_MAP::iterator end = grids->end();
+	const stage_view* v = get_view(angle);
+	cull(v, angle);
 #ifndef ECHO_NDS
-	gfx_outline_start();
-	while(it != end)
+	if(!mesh)
 	{
-	    if(it->second->should_draw())
-		    it->second->draw(angle);
-	    ++it;
+		mesh = new stage_mesh();
+		CHKPTR(mesh);
+		mesh->init(v);
 	}
+	/// Only patches the grids whose active grid changed since the last draw
+	mesh->sync(v, angle);
+	if(gfx_outline_start())
+		mesh->draw(1, visible);
 	gfx_outline_mid();
-	it = grids->begin();
-	while(it != end)
-	{
-	    if(it->second->should_draw())
-		    it->second->draw(angle);
-	    ++it;
-	}
+	mesh->draw(0, visible);
+	/// The goals have no outline, which the screen-space pass would give them
+	if(!gfx_screen_outline_active())
+		mesh->draw_goals(v, angle, visible);
 	gfx_outline_end();
 #else
-	while(it != end)
+	const int size = v->get_size();
+	int each = 0;
+	while(each < size)
 	{
-	    if(it->second->should_draw())
+	    if(visible[each])
 	    {
-		    gfx_set_polyID(it->second->get_polyID(angle));
-		    it->second->draw(angle);
+		    gfx_set_polyID(v->get_active(each)->get_polyID(angle));
+		    draw_view_grid(v, each, angle);
 	    }
-	    ++it;
+	    each++;
 	}
 #endif
 }
+#ifndef ECHO_NDS
+/// Draws the goals; draw leaves them out while the world is drawn for the screen-space outline
+void stage::draw_goals(vector3f angle)
+{
+	if(mesh)
+		mesh->draw_goals(get_view(angle), angle, visible);
+}
+/** Finds the grid drawn at a pixel of the window (see stage_mesh::pick)
+ * @param x Window x-coordinate, from the left
+ * @param y Window y-coordinate, from the top
+ * @param angle Current camera angle
+ * @return The grid found, as drawn at angle (NULL if none, or nothing came back yet)
+ */
+grid* stage::pick(int x, int y, vector3f angle)
+{
+	/// The mesh is made by the first draw
+	if(!mesh)
+		return(NULL);
+	const stage_view* v = get_view(angle);
+	mesh->sync(v, angle);
+	const int slice = mesh->pick(x, y, angle);
+	return(slice >= 0 && slice < v->get_size() ? v->get_active(slice) : NULL);
+}
+#endif
+/// Gets how many grids the last draw drew
+int stage::get_num_drawn()
+{
+	return(num_drawn);
+}
+/// Gets how many grids the last draw left out, because they were off the screen
+int stage::get_num_culled()
+{
+	return(num_culled);
+}
 /// Sets the initial starting point of the stage
 void stage::set_start(grid* g)
 {
@@ -165,38 +359,217 @@ int stage::get_num_goals()
  * Screen Position points
  * @param p1 Screen Position; point 1 of the line
  * @param p2 Screen Position; point 2 of the line
- * @param angle Current camera angle
+ * @param basis Rotations of the current camera angle
  */
-grid* stage::get_grid_intersection(vector3f* p1, vector3f* p2, vector3f angle)
+grid* stage::get_grid_intersection(vector3f* p1, vector3f* p2, const camera_basis& basis)
 {
 	grid* ret = NULL;
 	float shortest_dist = FLT_MAX;
-	STAGE_MAP::iterator it = grids->begin();
-	STAGE_MAP::iterator end = grids->end();
-	while(it != end)
+	project_corners(basis);
+	const stage_view* v = get_view(basis.angle);
+	
+	/// Index into top_grids of ret; used to break ties the way a scan in order would
+	int ret_owner = -1;
+	/// Only the edges in the cells the line passes through can be hit
+	int found = landing_index->query(p1, p2);
+	const int* found_edges = landing_index->get_results();
+	/// If the line crosses most of the stage anyways, test every edge in one batch instead
+	if(found * 2 > num_edges)
+	{
+		found = lineSeg_intersect_batch(p1, p2, edge_x1, edge_y1, edge_x2, edge_y2, edge_hits, num_edges) ? num_edges : 0;
+		found_edges = NULL;
+	}
+	int each = 0;
+	while(each < found)
 	{
-		/// Short-circuit if you can't land on the line anyways
-		if(it->second->should_land(angle) && it->second->projected_line_intersect(p1, p2, angle))
+		const int edge = found_edges ? found_edges[each] : each;
+		const int hit = found_edges ? lineSeg_intersect(p1, p2, edge_x1[edge], edge_y1[edge], edge_x2[edge], edge_y2[edge])
+							: edge_hits[edge];
+		const int owner = edge_owner[edge];
+		if(hit && owner != ret_owner)
 		{
 			/// The line intersects, but we want the nearest grid
-			grid_info_t* info = it->second->get_info(angle);
-			if(info != NULL)
+			vector3f* pos = v->get_pos(owner);
+			if(pos != NULL)
 			{
 				/// Get the distance from the first point
-				vector3f* rot = info->pos->rotate_xy(angle);
-				float dist = p1->dist(rot);
-				if(dist < shortest_dist)
+				float dist = p1->dist(basis.rotate_xy(*pos));
+				/// On a tie, the grid that comes first in the stage wins
+				if(dist < shortest_dist || (dist == shortest_dist && owner < ret_owner))
 				{
-					ret = it->second;
+					ret = v->get_grid(owner);
+					ret_owner = owner;
 					shortest_dist = dist;
 				}
-				delete rot;
 			}
 		}
-		it++;
+		each++;
 	}
 	return(ret);
 }
+/// Copies the points of every grid into the corner arrays; the loader does this once, after loading
+void stage::build_corners()
+{
+	std::vector<grid*> all;
+	std::vector<grid*>::iterator it = top_grids->begin();
+	while(it != top_grids->end())
+	{
+		if(*it != NULL)
+			(*it)->list_grids(&all);
+		it++;
+	}
+	
+	delete[] corner_x;
+	delete[] corner_y;
+	delete[] corner_z;
+	delete[] proj_x;
+	delete[] proj_y;
+	delete[] edge_x1;
+	delete[] edge_y1;
+	delete[] edge_x2;
+	delete[] edge_y2;
+	delete[] edge_owner;
+	delete[] edge_hits;
+	delete[] visible;
+	
+	visible = new unsigned char[top_grids->size() > 0 ? top_grids->size() : 1];
+	CHKPTR(visible);
+	/// At most 4 edges per top-level grid
+	const int max_edges = (int)top_grids->size() * 4;
+	edge_x1 = new float[max_edges];
+	CHKPTR(edge_x1);
+	edge_y1 = new float[max_edges];
+	CHKPTR(edge_y1);
+	edge_x2 = new float[max_edges];
+	CHKPTR(edge_x2);
+	edge_y2 = new float[max_edges];
+	CHKPTR(edge_y2);
+	edge_owner = new int[max_edges];
+	CHKPTR(edge_owner);
+	edge_hits = new unsigned char[max_edges];
+	CHKPTR(edge_hits);
+	num_edges = 0;
+	
+	/// At most 4 corners per grid; grids without points are skipped
+	const int max_corners = (int)all.size() * 4;
+	corner_x = new float[max_corners];
+	CHKPTR(corner_x);
+	corner_y = new float[max_corners];
+	CHKPTR(corner_y);
+	corner_z = new float[max_corners];
+	CHKPTR(corner_z);
+	proj_x = new float[max_corners];
+	CHKPTR(proj_x);
+	proj_y = new float[max_corners];
+	CHKPTR(proj_y);
+	
+	num_corners = 0;
+	std::vector<grid*>::iterator each = all.begin();
+	while(each != all.end())
+	{
+		grid* g = *each;
+		vector3f* points = g->get_points();
+		g->set_corner_index(-1);
+		if(points != NULL)
+		{
+			g->set_corner_index(num_corners);
+			int pt = 0;
+			while(pt < 4)
+			{
+				corner_x[num_corners] = points[pt].x;
+				corner_y[num_corners] = points[pt].y;
+				corner_z[num_corners] = points[pt].z;
+				num_corners++;
+				pt++;
+			}
+		}
+		each++;
+	}
+	view->init(top_grids);
+#ifndef ECHO_NDS
+	/// The slices are numbered like the view
+	delete mesh;
+	mesh = NULL;
+#endif
+	corners_built = 1;
+	projected = 0;
+	/// Project once now, so the landing index allocates its memory while loading
+	project_corners(camera_basis());
+}
+/** Projects all the corners to Screen Position, unless they already are for this angle
+ * @param basis Rotations of the current camera angle
+ */
+void stage::project_corners(const camera_basis& basis)
+{
+	if(!corners_built)
+		build_corners();
+	if(projected && basis.is_for(projected_angle))
+		return;
+	basis.neg_rotate_xy(corner_x, corner_y, corner_z, proj_x, proj_y, num_corners);
+	projected_angle = basis.angle;
+	projected = 1;
+	
+	/// Gather the edges of the grids that can be landed on at this angle (same edges as grid::projected_line_intersect)
+	const stage_view* v = get_view(basis.angle);
+	num_edges = 0;
+	int index = 0;
+	const int size = v->get_size();
+	while(index < size)
+	{
+		if(v->should_land(index))
+		{
+			const int c = v->get_active(index)->get_corner_index();
+			if(c >= 0)
+			{
+				int pt = 0;
+				while(pt < 4)
+				{
+					const int next = c + (pt + 1) % 4;
+					edge_x1[num_edges] = proj_x[c + pt];
+					edge_y1[num_edges] = proj_y[c + pt];
+					edge_x2[num_edges] = proj_x[next];
+					edge_y2[num_edges] = proj_y[next];
+					edge_owner[num_edges] = index;
+					num_edges++;
+					pt++;
+				}
+			}
+		}
+		index++;
+	}
+	landing_index->build(edge_x1, edge_y1, edge_x2, edge_y2, num_edges);
+}
+/** Gets the top-level grids resolved at that angle; only rebuilt if the angle
+ * changed, or if invalidate_view was called since
+ * @param angle Current camera angle
+ */
+const stage_view* stage::get_view(vector3f angle)
+{
+	if(!corners_built)
+		build_corners();
+	if(!view->is_for(angle))
+		view->build(angle);
+	return(view);
+}
+/// Makes the view rebuild on its next use; call after toggling a goal
+void stage::invalidate_view()
+{
+	view->invalidate();
+}
+/** Gets the projected x-coordinates of all the corners (see project_corners)
+ * @return Array of num_corners Screen x-coordinates, indexed by grid::get_corner_index
+ */
+const float* stage::get_projected_x()
+{
+	return(proj_x);
+}
+/** Gets the projected y-coordinates of all the corners (see project_corners)
+ * @return Array of num_corners Screen y-coordinates, indexed by grid::get_corner_index
+ */
+const float* stage::get_projected_y()
+{
+	return(proj_y);
+}
 /// Set the farthest position
 void stage::set_farthest(float new_far)
 {
@@ -21,22 +21,33 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <stdint.h>
 
 #include "grid.h"
+#include "grid_arena.h"
 #include "echo_math.h"
+#include "screen_index.h"
+#include "stage_view.h"
+#include "stage_mesh.h"
 
 #ifndef __ECHO_CLASS_STAGE__
 #define __ECHO_CLASS_STAGE__
 
-/// A map from the id of the grid to the grid
-typedef std::map<std::string, grid*> STAGE_MAP;
+/// Dense id of a top-level grid in its stage; the index into the stage's grids
+typedef uint32_t grid_id_t;
+/// A map from the string id of the grid (from the stage file) to its dense id; only kept while loading
+typedef std::map<std::string, grid_id_t> STAGE_NAMES;
 
 /// @brief Holds a list of grids and basic info about the grid (number of goals, name, etc.)
 class stage
 {
     protected:
-    	/// The list of grids in the stage; needed for drawing
-        STAGE_MAP* grids;
+    	/// The string ids of the grids; NULL once the loader is done with them (see drop_names)
+        STAGE_NAMES* names;
+	/** Where the stage's grids (and their escs, infos, triggers, etc.) are allocated;
+	 * see grid::get_arena.  Deleting it frees them all without destructing them
+	 */
+	grid_arena* arena;
 	/// The initial starting point (changes as the mannequin acquires goals)
         grid* start;
 	/// The name od the stage
@@ -47,6 +58,60 @@ class stage
 	float farthest;
 	/// Y-Coordinate of the lowest grid THAT CAN BE LANDED ON!!!!!!!!!!!!!!
 	float lowest;
+	/** The top-level grids, indexed by id; in the order they were added while
+	 * loading, then in string id order (see drop_names), the order they're drawn
+	 * and break ties in
+	 */
+	std::vector<grid*>* top_grids;
+	/** Every point of every grid and esc in the stage, 4 per grid, split into
+	 * separate x, y and z arrays so they can be projected in one streaming pass
+	 * (see grid::get_corner_index)
+	 */
+	float* corner_x;
+	float* corner_y;
+	float* corner_z;
+	/// The corners in Screen Position, as of projected_angle
+	float* proj_x;
+	float* proj_y;
+	/// The number of corners (always a multiple of 4)
+	int num_corners;
+	/// Have the corner arrays been built yet?
+	int corners_built;
+	/// Are proj_x and proj_y up to date for projected_angle?
+	int projected;
+	/// The angle the corners were last projected at
+	vector3f projected_angle;
+	/** The projected edges of the grids that can be landed on at projected_angle,
+	 * 4 per grid, packed for lineSeg_intersect_batch
+	 */
+	float* edge_x1;
+	float* edge_y1;
+	float* edge_x2;
+	float* edge_y2;
+	/// Which of top_grids each landing edge belongs to
+	int* edge_owner;
+	/// Results of the last lineSeg_intersect_batch over the landing edges
+	unsigned char* edge_hits;
+	/// Number of landing edges
+	int num_edges;
+	/// Spatial index over the landing edges; rebuilt with them
+	screen_index* landing_index;
+	/// The top-level grids resolved at the current camera angle; numbered with the corners
+	stage_view* view;
+	/// Which grids of the view are on the screen, as of the last draw (see cull)
+	unsigned char* visible;
+	/// Grids the last draw drew and left out
+	int num_drawn, num_culled;
+	/** Marks the grids of the view whose projected corners (plus a margin for
+	 * stairs, outlines and goals) overlap the projection (see gfx_set_view)
+	 * @param v The view, built for angle
+	 * @param angle Current camera angle
+	 */
+	void cull(const stage_view* v, vector3f angle);
+#ifndef ECHO_NDS
+	/// The grids baked into vertex buffers; made by the first draw, dropped with the view
+	stage_mesh* mesh;
+#endif
 	/** Internal initialization function
 	 * @param my_start Initial starting point
 	 * @param my_name The stage's name
@@ -65,20 +130,49 @@ class stage
 	/// Deletes the stage's name and the all the grids in it
         ~stage();
         /** Adds the grid with the id.
-	 * @param id The id of the grid to add
-	 * @param ptr The grid to add
+	 * @param id The string id of the grid to add
+	 * @param ptr The grid to add; should be allocated in get_arena()
+	 * @return The grid's dense id (the existing grid's, if the string id was already taken)
 	 */
-        void add(std::string id, grid* ptr);
+        grid_id_t add(std::string id, grid* ptr);
 	/** Adds the position of the grid.  It was used in the old holes and launchers
 	 * implementation, but used right now just to calculate the lowest position.
 	 * @param pos The position of the grid.  Just has to be the position of the grid at some angle.
 	 * @param g The grid (isn't used now)
 	 */
 	void add_pos(vector3f* pos, grid* g);
-	/// Gets a grid with the given string id
+	/// Gets a grid with the given string id, while the names are still around (NULL otherwise)
         grid* get(std::string id);
-	/// Draws all the grids
+	/// Gets a grid with the given dense id (NULL if there's no such grid)
+        grid* get(grid_id_t id);
+	/// Gets the number of top-level grids; the dense ids go from 0 to this
+	grid_id_t get_num_grids();
+	/** Forgets the string ids, and renumbers the grids in string id order; the loader is done linking the grids,
+	 * so their ids from add are no good after this
+	 */
+	void drop_names();
+	/// Gets the arena the stage's grids (and everything they have) should be allocated in
+	grid_arena* get_arena();
+	/// Draws all the grids that are on the screen
         void draw(vector3f angle);
+	/// Gets how many grids the last draw drew
+	int get_num_drawn();
+	/// Gets how many grids the last draw left out, because they were off the screen
+	int get_num_culled();
+#ifndef ECHO_NDS
+	/// Draws the goals; draw leaves them out while the world is drawn for the screen-space outline
+	void draw_goals(vector3f angle);
+	/** Finds the grid drawn at a pixel of the window, by drawing grid ids on the
+	 * GPU (see stage_mesh::pick), with the current projection.  The id is read
+	 * back without waiting, so this gives what an earlier call found, a frame or
+	 * so ago; call it every frame (after draw) with, say, the mouse position.
+	 * @param x Window x-coordinate, from the left
+	 * @param y Window y-coordinate, from the top (like the mouse's)
+	 * @param angle Current camera angle
+	 * @return The grid found, as drawn at angle (NULL if none, or nothing came back yet)
+	 */
+	grid* pick(int x, int y, vector3f angle);
+#endif
 	/// Sets the initial starting point of the stage
         void set_start(grid* g);
 	/// Sets the name of the stage
@@ -89,9 +183,30 @@ class stage
 	 * Screen Position points
 	 * @param p1 Screen Position; point 1 of the line
 	 * @param p2 Screen Position; point 2 of the line
+	 * @param basis Rotations of the current camera angle
+	 */
+	grid* get_grid_intersection(vector3f* p1, vector3f* p2, const camera_basis& basis);
+	/// Copies the points of every grid into the corner arrays; the loader does this once, after loading
+	void build_corners();
+	/** Projects all the corners to Screen Position, unless they already are for this angle
+	 * @param basis Rotations of the current camera angle
+	 */
+	void project_corners(const camera_basis& basis);
+	/** Gets the projected x-coordinates of all the corners (see project_corners)
+	 * @return Array of num_corners Screen x-coordinates, indexed by grid::get_corner_index
+	 */
+	const float* get_projected_x();
+	/** Gets the projected y-coordinates of all the corners (see project_corners)
+	 * @return Array of num_corners Screen y-coordinates, indexed by grid::get_corner_index
+	 */
+	const float* get_projected_y();
+	/** Gets the top-level grids resolved at that angle; only rebuilt if the angle
+	 * changed, or if invalidate_view was called since
 	 * @param angle Current camera angle
 	 */
-	grid* get_grid_intersection(vector3f* p1, vector3f* p2, vector3f angle);
+	const stage_view* get_view(vector3f angle);
+	/// Makes the view rebuild on its next use; call after toggling a goal
+	void invalidate_view();
 	/// Gets the initial starting point of this stage
         grid* get_start();
 	/// Gets the name of the stage
@@ -23,6 +23,8 @@
 #define FPS	30
 /// Delay per frame (if it's running top speed, which it probably won't be)
 #define WAIT 	33.333f
+/// Frames drawn per second on the PC, unless -r says otherwise; the game still updates FPS times a second
+#define RENDER_FPS	60
 
 #ifndef ECHO_NDS
 	#ifdef ECHO_WIN
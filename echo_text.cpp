@@ -0,0 +1,396 @@
+// echo_text.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <map>
+
+#include "echo_platform.h"
+
+#ifndef ECHO_NDS
+
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_glext.h"
+#include "echo_text.h"
+
+#ifdef ECHO_OSX	//OS X
+	#include <OpenGL/gl.h>
+	#include <GLUT/glut.h>
+#else
+	#include <GL/gl.h>
+	#include <GL/glut.h>
+#endif
+
+/// Size of the atlas (pixels); both fonts, every character, fit in it
+#define ATLAS_WIDTH			256
+#define ATLAS_HEIGHT		512
+/// Floats per vertex: x, y, z (window), u, v, r, g, b, a
+#define VERTEX_FLOATS		9
+
+/// Where a glyph is in the atlas, and how wide it is (also how far the next one goes)
+typedef struct
+{
+	short x, y, width;
+} glyph;
+
+/// Everything a queued string is drawn under
+typedef struct
+{
+	float modelview[16], projection[16], viewport[4], color[4];
+	float x, y, spacing;
+	int font;
+} text_key;
+
+/// A string of text_draw_static: its vertices, and what they were made under
+typedef struct
+{
+	text_key key;
+	std::vector<float> vertices;
+} cached_text;
+
+/// The GLUT fonts, by TEXT_FONT_ constant
+static void* font_faces[TEXT_NUM_FONTS] = {GLUT_BITMAP_HELVETICA_18, GLUT_BITMAP_HELVETICA_12};
+/// Height of each font's glyphs, and how far below the baseline they start (pixels)
+static const int font_heights[TEXT_NUM_FONTS] = {23, 16};
+static const int font_descents[TEXT_NUM_FONTS] = {5, 4};
+
+/// The atlas texture; 0 if there is none (then glyphs are drawn one at a time)
+static GLuint atlas = 0;
+/// Vertex buffer of the batch; 0 if the GL has none (then it is drawn from client memory)
+static GLuint buffer = 0;
+static glyph glyphs[TEXT_NUM_FONTS][256];
+/// The vertices queued this frame, and the ones in the buffer now
+static std::vector<float> batch, uploaded;
+/// The strings of text_draw_static, by address
+static std::map<const char*, cached_text> cache;
+
+/// Draws every glyph into the atlas, in rows
+static STATUS build_atlas()
+{
+	GLuint fbo = 0;
+	glGenTextures(1, &atlas);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, ATLAS_WIDTH, ATLAS_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	echo_glGenFramebuffers(1, &fbo);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	echo_glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, atlas, 0);
+	if(echo_glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		echo_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		echo_glDeleteFramebuffers(1, &fbo);
+		return(FAIL);
+	}
+	
+	glPushAttrib(GL_ALL_ATTRIB_BITS);
+	glViewport(0, 0, ATLAS_WIDTH, ATLAS_HEIGHT);
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_BLEND);
+	/// White glyphs on nothing; drawing modulates them by the string's color
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glColor4f(1, 1, 1, 1);
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glOrtho(0, ATLAS_WIDTH, 0, ATLAS_HEIGHT, -1, 1);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	
+	STATUS ret = WIN;
+	int x = 0, y = 0, font = 0;
+	while(font < TEXT_NUM_FONTS)
+	{
+		int c = 1;
+		while(c < 256)
+		{
+			const int width = glutBitmapWidth(font_faces[font], c);
+			if(x + width > ATLAS_WIDTH)
+			{
+				x = 0;
+				y += font_heights[font];
+			}
+			if(y + font_heights[font] > ATLAS_HEIGHT)
+			{
+				ECHO_PRINT("the glyphs don't fit in the atlas\n");
+				ret = FAIL;
+				break;
+			}
+			//in the middle of the pixel, so it doesn't round down to the next one
+			glRasterPos2f(x + 0.5f, y + font_descents[font] + 0.5f);
+			glutBitmapCharacter(font_faces[font], c);
+			glyphs[font][c].x = x;
+			glyphs[font][c].y = y;
+			glyphs[font][c].width = width;
+			//a pixel apart
+			x += width + 1;
+			c++;
+		}
+		x = 0;
+		y += font_heights[font];
+		font++;
+	}
+	
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	glPopAttrib();
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	echo_glDeleteFramebuffers(1, &fbo);
+	return(ret);
+}
+
+STATUS text_init()
+{
+	echo_glext_init();
+	if(atlas)
+		return(WIN);
+	if(!echo_glext_has_fbo())
+	{
+		ECHO_PRINT("no framebuffers; text will be drawn a glyph at a time\n");
+		return(FAIL);
+	}
+	if(build_atlas() == FAIL)
+	{
+		text_free();
+		return(FAIL);
+	}
+	if(echo_glext_has_vbo())
+		echo_glGenBuffers(1, &buffer);
+	return(WIN);
+}
+
+void text_free()
+{
+	if(atlas)
+	{
+		glDeleteTextures(1, &atlas);
+		atlas = 0;
+	}
+	if(buffer)
+	{
+		echo_glDeleteBuffers(1, &buffer);
+		buffer = 0;
+	}
+	batch.clear();
+	uploaded.clear();
+	cache.clear();
+}
+
+/// Fills in the matrices, viewport and color the string is drawn under
+static void get_key(text_key* key, float x, float y, int font, float spacing)
+{
+	//zero the whole thing, so they can be compared with memcmp
+	memset(key, 0, sizeof(text_key));
+	glGetFloatv(GL_MODELVIEW_MATRIX, key->modelview);
+	glGetFloatv(GL_PROJECTION_MATRIX, key->projection);
+	glGetFloatv(GL_VIEWPORT, key->viewport);
+	glGetFloatv(GL_CURRENT_COLOR, key->color);
+	key->x = x;
+	key->y = y;
+	key->spacing = spacing;
+	key->font = font;
+}
+
+/** Where glRasterPos would put a point, relative to the viewport
+ * @param win Where to put x, y (pixels) and the depth
+ * @return 0 if it is outside the view volume (glRasterPos would skip it)
+ */
+static int project(const text_key* key, float x, float y, float* win)
+{
+	float eye[4], clip[4];
+	int row = 0;
+	while(row < 4)
+	{
+		eye[row] = key->modelview[row] * x + key->modelview[4 + row] * y + key->modelview[12 + row];
+		row++;
+	}
+	row = 0;
+	while(row < 4)
+	{
+		clip[row] = key->projection[row] * eye[0] + key->projection[4 + row] * eye[1]
+			+ key->projection[8 + row] * eye[2] + key->projection[12 + row] * eye[3];
+		row++;
+	}
+	if(clip[3] <= 0)
+		return(0);
+	row = 0;
+	while(row < 3)
+	{
+		clip[row] /= clip[3];
+		if(clip[row] < -1 || clip[row] > 1)
+			return(0);
+		row++;
+	}
+	win[0] = (clip[0] + 1) * 0.5f * key->viewport[2];
+	win[1] = (clip[1] + 1) * 0.5f * key->viewport[3];
+	win[2] = (clip[2] + 1) * 0.5f;
+	return(1);
+}
+
+/// Adds one corner of a glyph's quad
+static void add_vertex(std::vector<float>* out, float x, float y, float z, float u, float v, const float* color)
+{
+	out->push_back(x);
+	out->push_back(y);
+	out->push_back(z);
+	out->push_back(u / ATLAS_WIDTH);
+	out->push_back(v / ATLAS_HEIGHT);
+	out->push_back(color[0]);
+	out->push_back(color[1]);
+	out->push_back(color[2]);
+	out->push_back(color[3]);
+}
+
+/// Adds a quad for each glyph of the string; the glyphs are whole pixels, like glBitmap's
+static void add_string(const text_key* key, const char* str, std::vector<float>* out)
+{
+	const glyph* table = glyphs[key->font];
+	const float height = font_heights[key->font];
+	float x = key->x;
+	while(*str != '\0')
+	{
+		const glyph* g = table + (unsigned char)*str;
+		float win[3];
+		if(g->width > 0 && project(key, x, key->y, win))
+		{
+			const float left = floor(win[0]), bottom = floor(win[1]) - font_descents[key->font];
+			add_vertex(out, left, bottom, win[2], g->x, g->y, key->color);
+			add_vertex(out, left + g->width, bottom, win[2], g->x + g->width, g->y, key->color);
+			add_vertex(out, left + g->width, bottom + height, win[2], g->x + g->width, g->y + height, key->color);
+			add_vertex(out, left, bottom + height, win[2], g->x, g->y + height, key->color);
+		}
+		x += g->width * key->spacing;
+		str++;
+	}
+}
+
+/// The way it was before the atlas: a raster position and a bitmap per character
+static void draw_glyphs(float x, float y, const char* str, int font, float spacing)
+{
+	while(*str != '\0')
+	{
+		glRasterPos2f(x, y);
+		glutBitmapCharacter(font_faces[font], (unsigned char)*str);
+		x += glutBitmapWidth(font_faces[font], (unsigned char)*str) * spacing;
+		str++;
+	}
+}
+
+void text_draw(float x, float y, const char* str, int font, float spacing)
+{
+	if(!str)
+		return;
+	if(!atlas)
+	{
+		draw_glyphs(x, y, str, font, spacing);
+		return;
+	}
+	text_key key;
+	get_key(&key, x, y, font, spacing);
+	add_string(&key, str, &batch);
+}
+
+void text_draw_static(float x, float y, const char* str, int font, float spacing)
+{
+	if(!str)
+		return;
+	if(!atlas)
+	{
+		draw_glyphs(x, y, str, font, spacing);
+		return;
+	}
+	text_key key;
+	get_key(&key, x, y, font, spacing);
+	cached_text& cached = cache[str];
+	if(cached.vertices.empty() || memcmp(&cached.key, &key, sizeof(text_key)))
+	{
+		cached.key = key;
+		cached.vertices.clear();
+		add_string(&key, str, &cached.vertices);
+	}
+	batch.insert(batch.end(), cached.vertices.begin(), cached.vertices.end());
+}
+
+void text_flush()
+{
+	if(batch.empty())
+		return;
+	glPushAttrib(GL_ENABLE_BIT | GL_TEXTURE_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	/// The vertices are already in pixels, relative to the viewport
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	//z is the window depth glRasterPos would have given
+	glOrtho(0, viewport[2], 0, viewport[3], 0, -1);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	
+	glEnable(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, atlas);
+	glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+	//like a bitmap, the pixels around the glyph are not drawn at all
+	glEnable(GL_ALPHA_TEST);
+	glAlphaFunc(GL_GREATER, 0);
+	
+	const float* base = &batch[0];
+	if(buffer)
+	{
+		echo_glBindBuffer(GL_ARRAY_BUFFER, buffer);
+		//the menu's text is the same every frame, so it stays in the buffer
+		if(batch != uploaded)
+		{
+			echo_glBufferData(GL_ARRAY_BUFFER, batch.size() * sizeof(float), base, GL_STREAM_DRAW);
+			uploaded = batch;
+		}
+		base = NULL;
+	}
+	const int stride = VERTEX_FLOATS * sizeof(float);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glVertexPointer(3, GL_FLOAT, stride, base);
+	glTexCoordPointer(2, GL_FLOAT, stride, base + 3);
+	glColorPointer(4, GL_FLOAT, stride, base + 5);
+	glDrawArrays(GL_QUADS, 0, batch.size() / VERTEX_FLOATS);
+	if(buffer)
+		echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+	batch.clear();
+	
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	glPopClientAttrib();
+	glPopAttrib();
+}
+
+#endif
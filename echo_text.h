@@ -0,0 +1,60 @@
+// echo_text.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+
+#ifndef __ECHO_TEXT__
+#define __ECHO_TEXT__
+
+#ifndef ECHO_NDS
+/// GLUT_BITMAP_HELVETICA_18: the HUD, the menu and the loader's directory
+#define TEXT_FONT_LARGE		0
+/// GLUT_BITMAP_HELVETICA_12: the loader's file names
+#define TEXT_FONT_SMALL		1
+/// Number of fonts in the atlas
+#define TEXT_NUM_FONTS		2
+
+/** Draws every glyph of the fonts once into a texture; needs a context and
+ * GLUT.  Until it has, strings are drawn a glyph at a time with glutBitmapCharacter.
+ * @return WIN if the text can be batched
+ */
+STATUS text_init();
+/// Deletes the atlas and the vertex buffer, and forgets the cached strings
+void text_free();
+/** Queues a string; like glRasterPos + glutBitmapCharacter for each
+ * character, it lands where (x, y) is under the current matrices, in the
+ * current color, and its glyphs are a fixed size in pixels
+ * @param x Where the first character goes (world units)
+ * @param y Where the baseline goes (world units)
+ * @param str The string; NULL does nothing
+ * @param font One of the TEXT_FONT_ constants
+ * @param spacing World units the next character moves per pixel of glyph width
+ */
+void text_draw(float x, float y, const char* str, int font, float spacing);
+/** Like text_draw, for a string that never changes (the menu's lines): its
+ * vertices are kept, and reused as long as the matrices, color and place are the same
+ */
+void text_draw_static(float x, float y, const char* str, int font, float spacing);
+/// Draws everything queued since the last flush in a single call; call once a frame, before swapping
+void text_flush();
+#endif
+
+#endif
@@ -0,0 +1,361 @@
+// echo_thread.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+#include "echo_thread.h"
+
+#if !defined(ECHO_NDS) && !defined(ECHO_WIN)
+	#include <unistd.h>
+#endif
+
+#ifndef ECHO_NDS
+
+#ifdef ECHO_WIN
+static DWORD WINAPI run(LPVOID arg)
+{
+	echo_thread* t = (echo_thread*)arg;
+	t->func(t->arg);
+	return(0);
+}
+
+STATUS echo_thread_start(echo_thread* t, echo_thread_func func, void* arg)
+{
+	t->func = func;
+	t->arg = arg;
+	t->handle = CreateThread(NULL, 0, run, t, 0, NULL);
+	return(t->handle != NULL ? WIN : FAIL);
+}
+
+void echo_thread_join(echo_thread* t)
+{
+	WaitForSingleObject(t->handle, INFINITE);
+	CloseHandle(t->handle);
+}
+
+void echo_lock_init(echo_lock* l)
+{
+	InitializeCriticalSection(&l->mutex);
+	InitializeConditionVariable(&l->cond);
+}
+
+void echo_lock_free(echo_lock* l)
+{
+	DeleteCriticalSection(&l->mutex);
+}
+
+void echo_lock_lock(echo_lock* l)
+{
+	EnterCriticalSection(&l->mutex);
+}
+
+void echo_lock_unlock(echo_lock* l)
+{
+	LeaveCriticalSection(&l->mutex);
+}
+
+void echo_lock_wait(echo_lock* l)
+{
+	SleepConditionVariableCS(&l->cond, &l->mutex, INFINITE);
+}
+
+void echo_lock_wake(echo_lock* l)
+{
+	WakeAllConditionVariable(&l->cond);
+}
+
+int echo_cpu_count()
+{
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return(info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1);
+}
+#else
+static void* run(void* arg)
+{
+	echo_thread* t = (echo_thread*)arg;
+	t->func(t->arg);
+	return(NULL);
+}
+
+STATUS echo_thread_start(echo_thread* t, echo_thread_func func, void* arg)
+{
+	t->func = func;
+	t->arg = arg;
+	return(pthread_create(&t->handle, NULL, run, t) == 0 ? WIN : FAIL);
+}
+
+void echo_thread_join(echo_thread* t)
+{
+	pthread_join(t->handle, NULL);
+}
+
+void echo_lock_init(echo_lock* l)
+{
+	pthread_mutex_init(&l->mutex, NULL);
+	pthread_cond_init(&l->cond, NULL);
+}
+
+void echo_lock_free(echo_lock* l)
+{
+	pthread_cond_destroy(&l->cond);
+	pthread_mutex_destroy(&l->mutex);
+}
+
+void echo_lock_lock(echo_lock* l)
+{
+	pthread_mutex_lock(&l->mutex);
+}
+
+void echo_lock_unlock(echo_lock* l)
+{
+	pthread_mutex_unlock(&l->mutex);
+}
+
+void echo_lock_wait(echo_lock* l)
+{
+	pthread_cond_wait(&l->cond, &l->mutex);
+}
+
+void echo_lock_wake(echo_lock* l)
+{
+	pthread_cond_broadcast(&l->cond);
+}
+
+int echo_cpu_count()
+{
+	const long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return(count > 0 ? count : 1);
+}
+#endif
+
+/// How much of what is left in its share a thread takes at once (1 / POOL_GRAIN)
+#define POOL_GRAIN	4
+
+/** Takes a chunk from the front of a share
+ * @param share The share
+ * @param begin Where to store the first index taken
+ * @return How many indices were taken (0 if the share is empty)
+ */
+static int pool_take(echo_pool_share* share, int* begin)
+{
+	echo_lock_lock(&share->lock);
+	const int left = share->end - share->next;
+	const int taken = left > POOL_GRAIN ? left / POOL_GRAIN : (left > 0 ? 1 : 0);
+	*begin = share->next;
+	share->next += taken;
+	echo_lock_unlock(&share->lock);
+	return(taken);
+}
+
+/** Moves the back half of another thread's share into an empty one
+ * @param victim The share to steal from
+ * @param mine The (empty) share of the thief
+ * @return How many indices were stolen
+ */
+static int pool_steal(echo_pool_share* victim, echo_pool_share* mine)
+{
+	echo_lock_lock(&victim->lock);
+	const int left = victim->end - victim->next;
+	const int stolen = left > 1 ? left / 2 : left;
+	victim->end -= stolen;
+	const int begin = victim->end;
+	echo_lock_unlock(&victim->lock);
+	if(stolen > 0)
+	{
+		echo_lock_lock(&mine->lock);
+		mine->next = begin;
+		mine->end = begin + stolen;
+		echo_lock_unlock(&mine->lock);
+	}
+	return(stolen);
+}
+
+/** Runs a thread's share of the current job, then steals until every share is empty
+ * @param pool The pool
+ * @param self Which share is the thread's
+ * @param func The job's function
+ * @param arg The job's argument
+ * @return How many indices this thread ran
+ */
+static int pool_help(echo_pool* pool, int self, echo_pool_func func, void* arg)
+{
+	const int num_shares = pool->num_threads + 1;
+	echo_pool_share* mine = &pool->shares[self];
+	int ran = 0, working = 1;
+	while(working)
+	{
+		int begin = 0;
+		const int taken = pool_take(mine, &begin);
+		if(taken > 0)
+		{
+			int each = 0;
+			while(each < taken)
+			{
+				func(arg, begin + each);
+				each++;
+			}
+			ran += taken;
+		}
+		else
+		{
+			/// Out of work; look for someone who has some left, starting with the next thread
+			int other = 1;
+			int stolen = 0;
+			while(stolen == 0 && other < num_shares)
+			{
+				stolen = pool_steal(&pool->shares[(self + other) % num_shares], mine);
+				other++;
+			}
+			working = stolen > 0;
+		}
+	}
+	return(ran);
+}
+
+/** What the workers run: wait for a job, help with it, repeat
+ * @param arg The worker's share
+ */
+static void pool_work(void* arg)
+{
+	echo_pool_share* mine = (echo_pool_share*)arg;
+	echo_pool* pool = mine->pool;
+	const int self = mine - pool->shares;
+	int seen = 0;
+	echo_lock_lock(&pool->lock);
+	while(!pool->quit)
+	{
+		/// A job this worker hasn't seen yet; if it's already done, echo_pool_run may have
+		/// returned (and freed what func and arg point to), so it's only noted as seen
+		if(pool->job != seen && pool->done >= pool->count)
+			seen = pool->job;
+		else if(pool->job != seen)
+		{
+			seen = pool->job;
+			echo_pool_func func = pool->func;
+			void* func_arg = pool->arg;
+			pool->busy++;
+			echo_lock_unlock(&pool->lock);
+			const int ran = pool_help(pool, self, func, func_arg);
+			echo_lock_lock(&pool->lock);
+			pool->busy--;
+			pool->done += ran;
+			/// The last one out wakes echo_pool_run
+			if(pool->done == pool->count && pool->busy == 0)
+				echo_lock_wake(&pool->lock);
+		}
+		else
+			echo_lock_wait(&pool->lock);
+	}
+	echo_lock_unlock(&pool->lock);
+}
+
+STATUS echo_pool_start(echo_pool* pool, int num_threads)
+{
+	if(num_threads < 0)
+		num_threads = 0;
+	echo_lock_init(&pool->lock);
+	pool->func = NULL;
+	pool->arg = NULL;
+	pool->count = pool->done = pool->busy = 0;
+	pool->job = 0;
+	pool->quit = 0;
+	pool->num_threads = 0;
+	pool->shares = new echo_pool_share[num_threads + 1];
+	int each = 0;
+	while(each <= num_threads)
+	{
+		echo_lock_init(&pool->shares[each].lock);
+		pool->shares[each].next = pool->shares[each].end = 0;
+		pool->shares[each].pool = pool;
+		each++;
+	}
+	pool->threads = num_threads > 0 ? new echo_thread[num_threads] : NULL;
+	/// The workers only look at shares below num_threads + 1, so the count grows as they start
+	while(pool->num_threads < num_threads)
+	{
+		if(echo_thread_start(&pool->threads[pool->num_threads], pool_work
+				, &pool->shares[pool->num_threads + 1]) == FAIL)
+			return(FAIL);
+		pool->num_threads++;
+	}
+	return(WIN);
+}
+
+void echo_pool_run(echo_pool* pool, echo_pool_func func, void* arg, int count)
+{
+	const int num_shares = pool->num_threads + 1;
+	echo_lock_lock(&pool->lock);
+	pool->func = func;
+	pool->arg = arg;
+	pool->count = count;
+	pool->done = 0;
+	/// Deal the indices out evenly
+	int each = 0;
+	while(each < num_shares)
+	{
+		echo_pool_share* share = &pool->shares[each];
+		echo_lock_lock(&share->lock);
+		share->next = (int)((long long)count * each / num_shares);
+		share->end = (int)((long long)count * (each + 1) / num_shares);
+		echo_lock_unlock(&share->lock);
+		each++;
+	}
+	pool->job++;
+	echo_lock_wake(&pool->lock);
+	echo_lock_unlock(&pool->lock);
+	
+	const int ran = pool_help(pool, 0, func, arg);
+	
+	echo_lock_lock(&pool->lock);
+	pool->done += ran;
+	/// Wait for the stragglers, so none is still on this job when the next starts
+	while(pool->done < pool->count || pool->busy > 0)
+		echo_lock_wait(&pool->lock);
+	echo_lock_unlock(&pool->lock);
+}
+
+void echo_pool_stop(echo_pool* pool)
+{
+	echo_lock_lock(&pool->lock);
+	pool->quit = 1;
+	echo_lock_wake(&pool->lock);
+	echo_lock_unlock(&pool->lock);
+	int each = 0;
+	while(each < pool->num_threads)
+	{
+		echo_thread_join(&pool->threads[each]);
+		each++;
+	}
+	each = 0;
+	while(each <= pool->num_threads)
+	{
+		echo_lock_free(&pool->shares[each].lock);
+		each++;
+	}
+	delete[] pool->threads;
+	delete[] pool->shares;
+	pool->threads = NULL;
+	pool->shares = NULL;
+	pool->num_threads = 0;
+	echo_lock_free(&pool->lock);
+}
+
+#endif
@@ -0,0 +1,143 @@
+// echo_thread.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_error.h"
+
+#ifndef ECHO_NDS
+	#ifdef ECHO_WIN
+		#include <windows.h>
+	#else
+		#include <pthread.h>
+	#endif
+#endif
+
+#ifndef __ECHO_THREAD__
+#define __ECHO_THREAD__
+
+#ifndef ECHO_NDS
+/// What a thread runs
+typedef void (*echo_thread_func)(void* arg);
+
+/// A thread (see echo_thread_start)
+typedef struct echo_thread
+{
+#ifdef ECHO_WIN
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+	echo_thread_func func;
+	void* arg;
+} echo_thread;
+
+/// A mutex with a condition to wait on
+typedef struct echo_lock
+{
+#ifdef ECHO_WIN
+	CRITICAL_SECTION mutex;
+	CONDITION_VARIABLE cond;
+#else
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+#endif
+} echo_lock;
+
+/** Starts a thread
+ * @param t The thread; has to stay put until echo_thread_join
+ * @param func What to run
+ * @param arg What to pass to func
+ * @return WIN if the thread started
+ */
+STATUS echo_thread_start(echo_thread* t, echo_thread_func func, void* arg);
+/// Waits for the thread to return
+void echo_thread_join(echo_thread* t);
+
+void echo_lock_init(echo_lock* l);
+void echo_lock_free(echo_lock* l);
+void echo_lock_lock(echo_lock* l);
+void echo_lock_unlock(echo_lock* l);
+/** Lets go of the lock until echo_lock_wake (or spuriously), then takes it back;
+ * so check the condition again after
+ */
+void echo_lock_wait(echo_lock* l);
+/// Wakes all the threads in echo_lock_wait
+void echo_lock_wake(echo_lock* l);
+/// @return The number of CPUs online (at least 1)
+int echo_cpu_count();
+
+/// What a pool job runs; index is which of the job's count this call is for
+typedef void (*echo_pool_func)(void* arg, int index);
+
+struct echo_pool;
+
+/// One thread's share of a pool job: the indices [next, end) nobody has run yet
+typedef struct echo_pool_share
+{
+	/// Guards next and end; the owner takes from the front, thieves from the back
+	echo_lock lock;
+	int next, end;
+	/// The pool this is a share of
+	struct echo_pool* pool;
+} echo_pool_share;
+
+/** Threads that split the indices of a job between them (see echo_pool_run).\n
+ * Each thread gets an even share of the indices up front; one that runs out steals
+ * half of what another has left, so uneven jobs still keep every thread busy.
+ */
+typedef struct echo_pool
+{
+	/// The workers
+	echo_thread* threads;
+	int num_threads;
+	/// One share per thread; the thread calling echo_pool_run has the first
+	echo_pool_share* shares;
+	/// Guards the rest
+	echo_lock lock;
+	/// The job: func(arg, index) for every index below count
+	echo_pool_func func;
+	void* arg;
+	int count;
+	/// How many indices have been run, and how many workers are still on the job
+	int done, busy;
+	/// Counts the jobs, so a worker can tell a new one from a spurious wake
+	int job;
+	/// Set to make the workers return
+	int quit;
+} echo_pool;
+
+/** Starts the workers of a pool
+ * @param pool The pool; has to stay put until echo_pool_stop
+ * @param num_threads Number of workers; the thread calling echo_pool_run helps too, so 0 runs jobs on it alone
+ * @return WIN if every worker started (otherwise the pool makes do with the ones that did)
+ */
+STATUS echo_pool_start(echo_pool* pool, int num_threads);
+/** Runs func(arg, index) for each index in [0, count) on the pool and the calling thread, and returns when all have
+ * @param pool The pool
+ * @param func What to run; calls for different indices can run at the same time
+ * @param arg What to pass to func
+ * @param count Number of indices
+ */
+void echo_pool_run(echo_pool* pool, echo_pool_func func, void* arg, int count);
+/// Stops and joins the workers
+void echo_pool_stop(echo_pool* pool);
+#endif
+
+#endif
@@ -0,0 +1,359 @@
+// echo_world.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdlib>
+
+#include "echo_platform.h"
+#include "echo_sys.h"
+#include "echo_error.h"
+#include "echo_character.h"
+#include "echo_math.h"
+#include "echo_gfx.h"
+#include "echo_world.h"
+
+#include "grid.h"
+
+/// The minimum opacity of the "stand-in mannequin" 
+#define NULL_CHAR_OPACITY_MIN   0.25f
+/// Most updates advance runs before it drops the time it is behind (after a load, say)
+#define MAX_UPDATES		5
+
+/// An empty world, with no stage
+echo_world::echo_world()
+{
+	started = false;
+	null_char_opacity = NULL_CHAR_OPACITY_MIN;
+	opacity_incr = true;
+	behind = 0;
+	alpha = 1;
+	current_stage = NULL;
+	main_char = NULL;
+#ifndef ECHO_NDS
+	pool = NULL;
+#endif
+}
+/// Deletes the stage and the characters
+echo_world::~echo_world()
+{
+	deallocate();
+}
+/// Deallocate everything: stage and characters
+void echo_world::deallocate()
+{
+	if(current_stage != NULL)
+		delete current_stage;
+	std::vector<echo_char*>::iterator it = characters.begin();
+	while(it != characters.end())
+	{
+		delete *it;
+		it++;
+	}
+	characters.clear();
+	current_stage = NULL;
+	main_char = NULL;
+}
+/// Initialize everything with the stage (which will be deleted if deallocate is called)
+void echo_world::init(stage* st)
+{
+	deallocate();
+	current_stage = st;
+	if(st != NULL)
+		main_char = add_character(st->get_start());
+	behind = 0;
+	alpha = 1;
+}
+/// Get the ball rolling!
+void echo_world::start()
+{
+	started = true;
+}
+/** Adds another character, which walks on its own (the controls only go to the main character)
+ * @param g Grid to start on
+ * @return The new character (deleted with the world)
+ */
+echo_char* echo_world::add_character(grid* g)
+{
+	echo_char* ch = new echo_char(this, g);
+	characters.push_back(ch);
+	/// So update doesn't allocate
+	falling.reserve(characters.size());
+	return(ch);
+}
+/// How many characters are there, the main character included?
+int echo_world::num_characters()
+{
+	return(characters.size());
+}
+/** Gets a character
+ * @param index Which character; 0 is the main character
+ * @return The character
+ */
+echo_char* echo_world::get_character(int index)
+{
+	return(characters[index]);
+}
+#ifndef ECHO_NDS
+/** Move the characters with the pool's threads from now on
+ * @param my_pool A started pool, or NULL to move them on the calling thread; not owned by the world
+ */
+void echo_world::set_pool(echo_pool* my_pool)
+{
+	pool = my_pool;
+}
+#endif
+/** Hashes the state of every character, in order (see echo_char#hash_state)
+ * @param hash Hash so far
+ * @return The new hash
+ */
+unsigned int echo_world::hash_state(unsigned int hash)
+{
+	std::vector<echo_char*>::iterator it = characters.begin();
+	while(it != characters.end())
+	{
+		hash = (*it)->hash_state(hash);
+		it++;
+	}
+	return(hash);
+}
+/// Moves characters[index] (if it's not falling) for echo_pool_run
+void echo_world::update_char(void* arg, int index)
+{
+	echo_char* ch = ((echo_world*)arg)->characters[index];
+	if(!ch->is_falling())
+		ch->update(WAIT);
+}
+/** Gets the rotations of angle; only rebuilt if angle changed since the last call
+ * @return The camera_basis of angle
+ */
+const camera_basis& echo_world::get_basis()
+{
+	if(!basis.is_for(angle))
+		basis.set(angle);
+	return(basis);
+}
+/// Get the lowest level in the current stage
+float echo_world::get_lowest_level()
+{
+	return(current_stage->get_lowest_level());
+}
+/// Moves the characters (or fades the "stand-in" mannequin) by one tick of WAIT
+void echo_world::update()
+{
+	if(current_stage != NULL)
+	{
+		if(started)
+		{
+			const int count = characters.size();
+			/// Build the view and the basis now, so the characters only read them
+			current_stage->get_view(angle);
+			get_basis();
+			/// Falling characters search the stage for somewhere to land, which isn't
+			/// safe to share; note them before anyone moves, so they move after everyone else
+			falling.clear();
+			int each = 0;
+			while(each < count)
+			{
+				if(characters[each]->is_falling())
+					falling.push_back(each);
+				each++;
+			}
+#ifndef ECHO_NDS
+			if(pool != NULL && count > 1)
+				echo_pool_run(pool, update_char, this, count);
+			else
+#endif
+			{
+				each = 0;
+				while(each < count)
+				{
+					update_char(this, each);
+					each++;
+				}
+			}
+			std::vector<int>::iterator it = falling.begin();
+			while(it != falling.end())
+			{
+				characters[*it]->update(WAIT);
+				it++;
+			}
+			/// Now that nobody is moving, hand out the goals in character order
+			each = 0;
+			while(each < count)
+			{
+				characters[each]->merge_goals();
+				each++;
+			}
+		}
+		/// Change the opacity of the stand-in mannequin
+		/// If we're increasing the opacity
+		else if(opacity_incr)
+		{
+			/// Increase the opacity slightly
+			null_char_opacity += 0.05f;
+			/// If the opacity is greater than (or equal to) 1
+			if(null_char_opacity >= 1)
+			{
+				/// Change it back to one
+				null_char_opacity = 1;
+				/// Start decreasing the opacity
+				opacity_incr = false;
+			}
+		}
+		/// Else, we're decreasing...
+		else
+		{
+			/// Decrease the opacity slightly
+			null_char_opacity -= 0.05f;
+			/// If the opacity is less than the minimum
+			if(null_char_opacity <= NULL_CHAR_OPACITY_MIN)
+				/// Start increasing the opacity
+				/// (don't need to change to NULL_CHAR_OPACITY_MIN because it's OK to cross the threshold)
+				opacity_incr = true;
+		}
+	}
+}
+/** Runs as many updates as fit in the time since the last call, keeping the rest for
+ * the next call, so the game plays the same at any frame rate
+ * @param elapsed Time since the last call, in milliseconds
+ * @return How many updates ran
+ */
+int echo_world::advance(float elapsed)
+{
+	behind += elapsed;
+	/// Don't try to catch up with a long stall all at once
+	if(behind > MAX_UPDATES * WAIT)
+		behind = MAX_UPDATES * WAIT;
+	int updates = 0;
+	while(behind >= WAIT)
+	{
+		update();
+		behind -= WAIT;
+		updates++;
+	}
+	alpha = behind / WAIT;
+	return(updates);
+}
+/// Draws the stage and the characters, or a "stand-in" mannequin
+void echo_world::draw()
+{
+	if(current_stage != NULL)
+	{
+		current_stage->draw(angle);
+		if(started)
+		{
+			std::vector<echo_char*>::iterator it = characters.begin();
+			while(it != characters.end())
+			{
+				(*it)->render(alpha);
+				it++;
+			}
+		}
+		/// Need a stand-in mannequin
+		else
+		{
+			/// Get the starting grid's info
+			grid* g = current_stage->get_start();
+			if(g)
+			{
+				grid_info_t* info = g->get_info(angle);
+				if(info)
+				{
+					gfx_push_matrix();
+					gfx_translatef(info->pos->x, info->pos->y, info->pos->z);
+#ifndef ECHO_NDS
+					if(gfx_outline_start())
+						draw_character(NULL);
+					gfx_outline_mid();
+#endif
+					gfx_color3f(null_char_opacity, null_char_opacity, null_char_opacity);
+					draw_character(NULL);
+#ifndef ECHO_NDS
+					gfx_outline_end();
+#endif
+					gfx_pop_matrix();
+				}
+			}
+		}
+	}
+}
+#ifndef ECHO_NDS
+/// Draws the goals on their own; for after the screen-space outline, since they have none
+void echo_world::draw_goals()
+{
+	if(current_stage != NULL)
+		current_stage->draw_goals(angle);
+}
+#endif
+/// Pause or unpause the game
+void echo_world::toggle_pause()
+{
+	std::vector<echo_char*>::iterator it = characters.begin();
+	while(it != characters.end())
+	{
+		(*it)->toggle_pause();
+		it++;
+	}
+}
+/// Is the game paused? (the main character is)
+int echo_world::is_paused()
+{
+	return(main_char->is_paused());
+}
+/// How many goals are there on this stage?
+int echo_world::num_goals()
+{
+	return(current_stage->get_num_goals());
+}
+/// How many goals have the characters reached?
+int echo_world::num_goals_reached()
+{
+	int ret = 0;
+	std::vector<echo_char*>::iterator it = characters.begin();
+	while(it != characters.end())
+	{
+		ret += (*it)->num_goals_reached();
+		it++;
+	}
+	return(ret);
+}
+/// How many goals are left?
+int echo_world::goals_left()
+{
+	return(current_stage->get_num_goals() - num_goals_reached());
+}
+/// Get the speed of the main character (see echo_char#speed)
+float echo_world::get_speed()
+{
+	return(main_char->get_speed());
+}
+/// Change speed to running if we can
+void echo_world::start_run()
+{
+	main_char->start_run();
+}
+/// Change speed to walking if we can
+void echo_world::start_step()
+{
+	main_char->start_step();
+}
+/// Toggle running
+void echo_world::toggle_run()
+{
+	main_char->toggle_run();
+}
@@ -0,0 +1,145 @@
+// echo_world.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <vector>
+
+#include "echo_math.h"
+#include "echo_character.h"
+#include "echo_stage.h"
+#include "echo_thread.h"
+
+#ifndef __ECHO_WORLD__
+#define __ECHO_WORLD__
+/** @brief A stage being played: the stage, its characters and the camera.\n
+ * The simulation only touches the world it is given, so any number of them can
+ * be played at once, on different threads (see echo_replay_batch); the game
+ * itself plays echo_ns::world.\n
+ * A world can also have any number of characters, which update splits between
+ * the threads of a pool (see set_pool); goals they reach are merged in
+ * character order after they've all moved, so it plays the same with any number of threads.
+ */
+class echo_world
+{
+	protected:
+		/// The rotations of angle, cached by get_basis
+		camera_basis basis;
+		/// Has the game started yet?
+		int started;
+		/** Opacity of the "stand-in" mannequin, or the mannequin that marks
+		 * where the character initially lands.
+		 */
+		float null_char_opacity;
+		/// Are we increasing the stand-in's opacity or decreasing?
+		int opacity_incr;
+		/// Time advance has been given but not simulated yet, in milliseconds; less than WAIT
+		float behind;
+		/// How far past the last update draw puts the character, in [0, 1]
+		float alpha;
+		/// Every character, the main character first
+		std::vector<echo_char*> characters;
+#ifndef ECHO_NDS
+		/// The pool that moves the characters, or NULL to move them on this thread
+		echo_pool* pool;
+#endif
+		/// Indices of the characters falling this update (see echo_char#is_falling); kept to reuse the memory
+		std::vector<int> falling;
+		/// Moves characters[index] (if it's not falling) for echo_pool_run
+		static void update_char(void* arg, int index);
+	public:
+		/// The world's rotation angle.  _VERY_ important variable
+		vector3f angle;
+		/// The stage (deleted with the world)
+		stage* current_stage;
+		/// The main character; the protagonist, the one the player controls
+		echo_char* main_char;
+		
+		/// An empty world, with no stage
+		echo_world();
+		/// Deletes the stage and the characters
+		~echo_world();
+		/// Deallocate everything: stage and characters
+		void deallocate();
+		/// Initialize everything with the stage (which will be deleted if deallocate is called)
+		void init(stage* st);
+		/// Get the ball rolling!
+		void start();
+		/** Adds another character, which walks on its own (the controls only go to the main character)
+		 * @param g Grid to start on
+		 * @return The new character (deleted with the world)
+		 */
+		echo_char* add_character(grid* g);
+		/// How many characters are there, the main character included?
+		int num_characters();
+		/** Gets a character
+		 * @param index Which character; 0 is the main character
+		 * @return The character
+		 */
+		echo_char* get_character(int index);
+#ifndef ECHO_NDS
+		/** Move the characters with the pool's threads from now on
+		 * @param my_pool A started pool, or NULL to move them on the calling thread; not owned by the world
+		 */
+		void set_pool(echo_pool* my_pool);
+#endif
+		/** Hashes the state of every character, in order (see echo_char#hash_state)
+		 * @param hash Hash so far
+		 * @return The new hash
+		 */
+		unsigned int hash_state(unsigned int hash);
+		/** Gets the rotations of angle; only rebuilt if angle changed since the last call
+		 * @return The camera_basis of angle
+		 */
+		const camera_basis& get_basis();
+		/// Get the lowest level in the current stage
+		float get_lowest_level();
+		/// Moves the characters (or fades the "stand-in" mannequin) by one tick of WAIT
+		void update();
+		/** Runs as many updates as fit in the time since the last call, keeping the rest for
+		 * the next call, so the game plays the same at any frame rate
+		 * @param elapsed Time since the last call, in milliseconds
+		 * @return How many updates ran
+		 */
+		int advance(float elapsed);
+		/// Draws the stage and the characters (between the last two updates), or a "stand-in" mannequin
+		void draw();
+#ifndef ECHO_NDS
+		/// Draws the goals on their own; for after the screen-space outline, since they have none
+		void draw_goals();
+#endif
+		/// Pause or unpause the game
+		void toggle_pause();
+		/// Is the game paused? (the main character is)
+		int is_paused();
+		/// How many goals are there on this stage?
+		int num_goals();
+		/// How many goals have the characters reached?
+		int num_goals_reached();
+		/// How many goals are left?
+		int goals_left();
+		/// Get the speed of the main character (see echo_char#speed)
+		float get_speed();
+		/// Change speed to running if we can
+		void start_run();
+		/// Change speed to walking if we can
+		void start_step();
+		/// Toggle running
+		void toggle_run();
+};
+#endif
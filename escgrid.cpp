@@ -28,6 +28,7 @@ along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 /// Initializes an empty EscGrid, with no info and neighbors
 escgrid::escgrid() : grid()
 {
+	kind = GRID_KIND_ESCGRID;
 	init_to_null();
 	delete_at_deconstruct = 1;
 	init(NULL, NULL, NULL);
@@ -35,6 +36,7 @@ escgrid::escgrid() : grid()
 /// Initializes an EscGrid with the info and neighbors given
 escgrid::escgrid(grid_info_t* my_info, grid* my_prev, grid* my_next) : grid()
 {
+	kind = GRID_KIND_ESCGRID;
 	init_to_null();
 	delete_at_deconstruct = 1;
 	init(my_info, my_prev, my_next);
@@ -44,7 +46,8 @@ escgrid::escgrid(grid_info_t* my_info, grid* my_prev, grid* my_next) : grid()
  */
 void escgrid::delete_table(int delete_every)
 {
-	if(delete_at_deconstruct)
+	/// The arena frees its tables, ranges and escs all at once
+	if(delete_at_deconstruct && get_arena() == NULL)
 	{
 		if(escs)
 		{
@@ -81,8 +84,11 @@ void escgrid::init(grid_info_t* my_info, grid* my_prev, grid* my_next)
 {
 	grid::init(my_info, my_prev, my_next);
 	delete_table(1);
+	if(get_arena() == NULL)
+		delete[] esc_table;
 	ranges = NULL;
 	escs = NULL;
+	esc_table = NULL;
 	delete_at_deconstruct = 1;
 	num_esc = 0;
 }
@@ -90,6 +96,8 @@ void escgrid::init(grid_info_t* my_info, grid* my_prev, grid* my_next)
 escgrid::~escgrid()
 {
 	delete_table(1);
+	if(get_arena() == NULL)
+		delete[] esc_table;
 }
 /// Initializes the angles and escs to null
 void escgrid::init_to_null()
@@ -97,21 +105,22 @@ void escgrid::init_to_null()
 	grid::init_to_null();
 	ranges = NULL;
 	escs = NULL;
+	esc_table = NULL;
 }
 /** Adds the vector as an angle range and maps the grid given to it
- * @param vec Angle vector to add as an angle range
- * @param esc Grid to map to that angle range
+ * @param vec Angle vector to add as an angle range; allocate it in get_arena()
+ * @param esc Grid to map to that angle range; allocate it in get_arena()
  */
 void escgrid::add(vector3f* vec, grid* esc)
 {
-	add(VECPTR_TO_RANGE(vec), esc);
+	add(new(get_arena()) angle_range(vec, vec), esc);
 }
-/// Maps the angle range to the esc
+/// Maps the angle range to the esc; both have to be allocated in get_arena()
 void escgrid::add(angle_range* range, grid* esc)
 {
-	angle_range** new_ranges = new angle_range*[num_esc + 1];
+	angle_range** new_ranges = new(get_arena()) angle_range*[num_esc + 1];
 	
-	grid** new_escs = new grid*[num_esc + 1];
+	grid** new_escs = new(get_arena()) grid*[num_esc + 1];
 	
 	if(escs)
 	{
@@ -133,10 +142,62 @@ void escgrid::add(angle_range* range, grid* esc)
 	ranges[num_esc] = range;
 	escs[num_esc] = esc;
 	num_esc++;
+	fill_esc_table(num_esc - 1);
+}
+/** Fills in the table entries that esc number index matches, unless an earlier esc already does
+ * @param index Index of the esc in escs/ranges
+ */
+void escgrid::fill_esc_table(int index)
+{
+	if(esc_table == NULL)
+	{
+		esc_table = new(get_arena()) unsigned char[ESC_TABLE_ROWS * ESC_TABLE_COLS];
+		CHKPTR(esc_table);
+		int each = 0;
+		while(each < ESC_TABLE_ROWS * ESC_TABLE_COLS)
+		{
+			esc_table[each] = ESC_TABLE_NONE;
+			each++;
+		}
+	}
+	/// get_esc skips NULL escs
+	if(escs[index] == NULL)
+		return;
+	const unsigned char entry = index + 1 < ESC_TABLE_SCAN ? index + 1 : ESC_TABLE_SCAN;
+	int row = 0;
+	while(row < ESC_TABLE_ROWS)
+	{
+		int col = 0;
+		while(col < ESC_TABLE_COLS)
+		{
+			/// The first esc that matches wins, just like in the range scan
+			unsigned char* cell = &esc_table[row * ESC_TABLE_COLS + col];
+			if(*cell == ESC_TABLE_NONE
+				&& ranges[index]->is_vec_in(vector3f(col * ESC_TABLE_STEP - ESC_TABLE_MAX_X
+										, row * ESC_TABLE_STEP - ESC_TABLE_MAX_Y, 0)))
+				*cell = entry;
+			col++;
+		}
+		row++;
+	}
 }
 /// Get the profile for this escgrid at that camera angle
 grid* escgrid::get_esc(vector3f angle)
 {
+	/// If the camera is on the lattice, it's just a lookup
+	if(esc_table != NULL)
+	{
+		const int x = (int)angle.x, y = (int)angle.y;
+		if(x == angle.x && y == angle.y && x % ESC_TABLE_STEP == 0 && y % ESC_TABLE_STEP == 0
+			&& ABS(x) <= ESC_TABLE_MAX_X && ABS(y) <= ESC_TABLE_MAX_Y)
+		{
+			const unsigned char entry = esc_table[(y + ESC_TABLE_MAX_Y) / ESC_TABLE_STEP * ESC_TABLE_COLS
+								+ (x + ESC_TABLE_MAX_X) / ESC_TABLE_STEP];
+			if(entry != ESC_TABLE_SCAN)
+				return(entry == ESC_TABLE_NONE ? NULL : escs[entry - 1]);
+		}
+	}
+	/// Off the lattice (or too many escs); check the ranges one by one
 	int each = 0;
 	while(each < num_esc)
 	{
@@ -234,10 +295,40 @@ int escgrid::should_land(vector3f angle)
  * any of the edges formed by the points; used by holes and launchers.
  * @param p1 The first point of the line
  * @param p2 The second point of the line
+ * @param basis Rotations of the current camera angle
+ */
+int escgrid::projected_line_intersect(vector3f* p1, vector3f* p2, const camera_basis& basis)
+{
+	grid* esc = get_esc(basis.angle);
+	return(esc ? esc->projected_line_intersect(p1, p2, basis) : grid::projected_line_intersect(p1, p2, basis));
+}
+/** Gets the grid that acts for this escgrid at that angle: the esc's, or this one if no esc matches
  * @param angle Current camera angle
  */
-int escgrid::projected_line_intersect(vector3f* p1, vector3f* p2, vector3f angle)
+grid* escgrid::resolve(vector3f angle)
 {
 	grid* esc = get_esc(angle);
-	return(esc ? esc->projected_line_intersect(p1, p2, angle) : grid::projected_line_intersect(p1, p2, angle));
+	return(esc ? esc->resolve(angle) : this);
+}
+/** Gets the esc for that angle, one step of resolve
+ * @param angle Current camera angle
+ * @return The esc, or NULL if no esc matches
+ */
+grid* escgrid::resolve_step(vector3f angle)
+{
+	return(get_esc(angle));
+}
+/** Appends this escgrid and all of its escs to the list
+ * @param list Where to append the grids
+ */
+void escgrid::list_grids(std::vector<grid*>* list)
+{
+	grid::list_grids(list);
+	int each = 0;
+	while(each < num_esc)
+	{
+		if(escs[each])
+			escs[each]->list_grids(list);
+		each++;
+	}
 }
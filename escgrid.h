@@ -22,6 +22,21 @@
 
 #ifndef __ECHO_CLASS_ESCGRID__
 #define __ECHO_CLASS_ESCGRID__
+
+/// The camera snaps to multiples of this many degrees (see pointer() in main.cpp)
+#define ESC_TABLE_STEP		5
+/// The camera's x-angle is clamped to +/- this
+#define ESC_TABLE_MAX_X		60
+/// The camera's y-angle wraps around within +/- this
+#define ESC_TABLE_MAX_Y		180
+/// Number of x-angles on the lattice
+#define ESC_TABLE_COLS		(2 * ESC_TABLE_MAX_X / ESC_TABLE_STEP + 1)
+/// Number of y-angles on the lattice
+#define ESC_TABLE_ROWS		(2 * ESC_TABLE_MAX_Y / ESC_TABLE_STEP + 1)
+/// Table entry: no esc matches this angle
+#define ESC_TABLE_NONE		0
+/// Table entry: the matching esc's index doesn't fit, use the range scan
+#define ESC_TABLE_SCAN		255
 /** @brief EscherGrids act like different grids under different camera angles.
  * This grid is behind most of the optical illusions, by having different "escs",
  * or profiles under certain AngleRanges.\n
@@ -37,6 +52,11 @@ class escgrid : public grid
 		int num_esc;
 		angle_range** ranges;
 		grid** escs;
+		/** Which esc matches each angle on the lattice the camera snaps to, filled as
+		 * escs are added; ESC_TABLE_ROWS * ESC_TABLE_COLS entries of the esc's index + 1
+		 * (or ESC_TABLE_NONE, ESC_TABLE_SCAN).  NULL if there are no escs.
+		 */
+		unsigned char* esc_table;
 	public:
 		/// Initializes an empty EscGrid, with no info and neighbors
 		escgrid();
@@ -45,11 +65,11 @@ class escgrid : public grid
 		/// Re-initializes the EscGrid with the info and neighbors
 		void init(grid_info_t* my_info, grid* my_prev, grid* my_next);
 		/** Adds the vector as an angle range and maps the grid given to it
-		 * @param vec Angle vector to add as an angle range
-		 * @param esc Grid to map to that angle range
+		 * @param vec Angle vector to add as an angle range; allocate it in get_arena()
+		 * @param esc Grid to map to that angle range; allocate it in get_arena()
 		 */
 		void add(vector3f* vec, grid* esc);
-		/// Maps the angle range to the esc
+		/// Maps the angle range to the esc; both have to be allocated in get_arena()
 		void add(angle_range* range, grid* esc);
 		/// Attempts to deletes the table (see delete_table)
 		virtual ~escgrid();
@@ -80,9 +100,9 @@ class escgrid : public grid
 		 * any of the edges formed by the points; used by holes and launchers.
 		 * @param p1 The first point of the line
 		 * @param p2 The second point of the line
-		 * @param angle Current camera angle
+		 * @param basis Rotations of the current camera angle
 		 */
-		virtual int projected_line_intersect(vector3f* p1, vector3f* p2, vector3f angle);
+		virtual int projected_line_intersect(vector3f* p1, vector3f* p2, const camera_basis& basis);
 		/** Toggles the grid; all escs will be toggled too
 		 * @param angle Current camera angle
 		 */
@@ -93,11 +113,28 @@ class escgrid : public grid
 		virtual void init_to_null();
 		/// Get the profile for this escgrid at that camera angle
 		grid* get_esc(vector3f angle);
+		/** Gets the grid that acts for this escgrid at that angle: the esc's, or this one if no esc matches
+		 * @param angle Current camera angle
+		 */
+		virtual grid* resolve(vector3f angle);
+		/** Gets the esc for that angle, one step of resolve
+		 * @param angle Current camera angle
+		 * @return The esc, or NULL if no esc matches
+		 */
+		virtual grid* resolve_step(vector3f angle);
+		/** Appends this escgrid and all of its escs to the list
+		 * @param list Where to append the grids
+		 */
+		virtual void list_grids(std::vector<grid*>* list);
 #ifdef ECHO_NDS
 		/// Get the assigned polyID of this escgrid; changes between escs
 		virtual unsigned int get_polyID(vector3f angle);
 #endif
 	protected:
+		/** Fills in the table entries that esc number index matches, unless an earlier esc already does
+		 * @param index Index of the esc in escs/ranges
+		 */
+		void fill_esc_table(int index);
 		/** Deletes the list of ranges and escs, and, if instructed, the ranges and escs themselves
 		 * @param delete_every Where to delete the ranges and escs.
 		 */
@@ -17,8 +17,6 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <set>
-
 #include "grid.h"
 #include "filter.h"
 #include "echo_math.h"
@@ -28,6 +26,7 @@
 filter::filter()
 {
 	target = NULL;
+	next = NULL;
 }
 /// Destructor; does nothing
 filter::~filter()
@@ -39,6 +38,7 @@ filter::~filter()
 filter::filter(grid* my_target)
 {
 	target = my_target;
+	next = NULL;
 }
 /** Should the trigger's target be triggered?  That is, turning into a goal.
  * The default behavior is to see if the filter's target is a goal.
@@ -57,6 +57,18 @@ void filter::set_target(grid* my_target)
 {
 	target = my_target;
 }
+/// Gets the next filter of the multi_filter that has this one, or NULL if this is the last
+filter* filter::get_next()
+{
+	return(next);
+}
+/** Sets the next filter of the multi_filter that has this one; used by multi_filter::add_filter
+ * @param my_next The next filter
+ */
+void filter::set_next(filter* my_next)
+{
+	next = my_next;
+}
 /** Creates a not_filter with the designated filter
  * @param my_filter The new not_filter's target filter; WILL BE DELETED!!!
  */
@@ -84,14 +96,14 @@ int not_filter::is_true(vector3f angle)
  */
 int or_filter::is_true(vector3f angle)
 {
-	if(filters->empty())
+	if(filters == NULL)
 		return(1);
-	FILTER_SET::iterator it = filters->begin(), end = filters->end();
-	while(it != end)
+	filter* each = filters;
+	while(each != NULL)
 	{
-		if((*it)->is_true(angle))
+		if(each->is_true(angle))
 			return(1);
-		it++;
+		each = each->get_next();
 	}
 	return(0);
 }
@@ -101,40 +113,44 @@ int or_filter::is_true(vector3f angle)
  */
 int and_filter::is_true(vector3f angle)
 {
-	if(filters->empty())
-		return(1);
-	FILTER_SET::iterator it = filters->begin(), end = filters->end();
-	while(it != end)
+	filter* each = filters;
+	while(each != NULL)
 	{
-		if(!((*it)->is_true(angle)))
+		if(!(each->is_true(angle)))
 			return(0);
-		it++;
+		each = each->get_next();
 	}
 	return(1);
 }
 /// Default constructor; initializes the list of filters
 multi_filter::multi_filter()
 {
-	filters = new FILTER_SET();
-	
+	filters = NULL;
 }
 /// Destructor; DELETES ALL FILTERS!
 multi_filter::~multi_filter()
 {
-	FILTER_SET::iterator it = filters->begin(), end = filters->end();
-	while(it != end)
+	while(filters != NULL)
 	{
-		filter* del = *it;
-		if(del != NULL)
-			delete del;
-		it++;
+		filter* del = filters;
+		filters = filters->get_next();
+		delete del;
 	}
-	delete filters;
 }
-/** Adds the filter given into the set.
+/** Adds the filter given to the end of the list.
  * @param f Filter to add; WILL DELETE THE FILTER GIVEN!
  */
 void multi_filter::add_filter(filter* f)
 {
-	filters->insert(f);
+	if(f == NULL)
+		return;
+	if(filters == NULL)
+	{
+		filters = f;
+		return;
+	}
+	filter* last = filters;
+	while(last->get_next() != NULL)
+		last = last->get_next();
+	last->set_next(f);
 }
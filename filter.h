@@ -17,9 +17,6 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <set>
-
-
 #include "echo_math.h"
 
 #ifndef __ECHO_CLASS_FILTER__
@@ -39,6 +36,8 @@ class filter
 		 * it will return true.  Has NOTHING TO DO with trigger targets?
 		 */
 		grid* target;
+		/// The next filter of the multi_filter that has this one (see multi_filter::add_filter)
+		filter* next;
 	public:
 		/// Initializes a filter with no target; MUST SET BEFORE CALLING is_true!
 		filter();
@@ -59,6 +58,12 @@ class filter
 		 * @param my_target The filter's new target
 		 */
 		void set_target(grid* my_target);
+		/// Gets the next filter of the multi_filter that has this one, or NULL if this is the last
+		filter* get_next();
+		/** Sets the next filter of the multi_filter that has this one; used by multi_filter::add_filter
+		 * @param my_next The next filter
+		 */
+		void set_next(filter* my_next);
 };
 /// Negates the target filter's is_true
 class not_filter : public filter
@@ -84,14 +89,14 @@ class not_filter : public filter
 class multi_filter: public filter
 {
 	protected:
-		/// Filters that are used by the child class
-		FILTER_SET* filters;
+		/// The first of the filters that are used by the child class (see filter::get_next)
+		filter* filters;
 	public:
 		/// Default constructor; initializes the list of filters
 		multi_filter();
 		/// Destructor; DELETES ALL FILTERS!
 		virtual ~multi_filter();
-		/** Adds the filter given into the set.
+		/** Adds the filter given to the end of the list.
 		 * @param f Filter to add; WILL DELETE THE FILTER GIVEN!
 		 */
 		void add_filter(filter* f);
@@ -128,5 +133,3 @@ class and_filter : public multi_filter
 };
 
 #endif
-
-typedef std::set<filter*> FILTER_SET;
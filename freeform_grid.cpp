@@ -27,11 +27,13 @@
 /// Initializes an empty freeform grid sloping right and up
 freeform_grid::freeform_grid() : grid()
 {
+	kind = GRID_KIND_FREEFORM_GRID;
 	init(NULL, NULL, NULL, new vector3f(0.5f, 0.5f, 0), new vector3f(0, 0, 0.5f));
 }
 /// Initialize the freeform grid with the info, neighbors, and side vectors
 freeform_grid::freeform_grid(grid_info_t* my_info, grid* my_prev, grid* my_next, vector3f* my_dir, vector3f* my_width) : grid()
 {
+	kind = GRID_KIND_FREEFORM_GRID;
 	init(my_info, my_prev, my_next, my_dir, my_width);
 }
 /// Re-Initialize the freeform grid with the info, neighbors, and side vectors
@@ -49,30 +51,24 @@ void freeform_grid::init_to_null()
 	width = NULL;
 }
 /// Generate points that makes the grid shaped like a parallelogram
-vector3f** freeform_grid::generate_points(grid_info_t* my_info)
+void freeform_grid::generate_points(grid_info_t* my_info, vector3f* out)
 {
-	vector3f** ret = new vector3f*[4];
-	
-	
 	vector3f* pos = my_info->pos;
-	ret[0] = new vector3f(pos->x + dir->x + width->x
+	out[0].set(pos->x + dir->x + width->x
 				, pos->y + dir->y + width->y
 				, pos->z + dir->z + width->z);
 	
-	ret[1] = new vector3f(pos->x - dir->x + width->x
+	out[1].set(pos->x - dir->x + width->x
 				, pos->y - dir->y + width->y
 				, pos->z - dir->z + width->z);
 	
-	ret[2] = new vector3f(pos->x - dir->x - width->x
+	out[2].set(pos->x - dir->x - width->x
 				, pos->y - dir->y - width->y
 				, pos->z - dir->z - width->z);
 	
-	ret[3] = new vector3f(pos->x + dir->x - width->x
+	out[3].set(pos->x + dir->x - width->x
 				, pos->y + dir->y - width->y
 				, pos->z + dir->z - width->z);
-	
-	
-	return(ret);
 }
 
 
@@ -40,6 +40,6 @@ class freeform_grid : public grid
 		/// Makes the side vectors null
 		virtual void init_to_null();
 		/// Generate points that makes the grid shaped like a parallelogram
-		virtual vector3f** generate_points(grid_info_t* my_info);
+		virtual void generate_points(grid_info_t* my_info, vector3f* out);
 };
 #endif
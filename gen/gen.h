@@ -5,9 +5,16 @@
 //#define PI					3.141592f
 #define LATS				6
 #define NDS_LATS			2
-#define ANGLE_INCR			PI / LATS
+#define ANGLE_INCR			PI / lod_lats[lod]
 #define NDS_ANGLE_INCR		PI / NDS_LATS
 
+/// Levels of detail of the parts that have them (print_lod_mesh); the first is the full one
+#define NUM_LODS			3
+/// Quads per half turn at each level; each divides a quarter turn, so the parts keep their ends
+const int lod_lats[NUM_LODS] = {LATS, 4, 2};
+/// The level being generated; ANGLE_INCR follows it
+int lod = 0;
+
 #define LIMB_LENGTH			0.4f
 #define FOOT_HEIGHT			0.15f
 
@@ -21,3 +28,104 @@ void print_pt(float x, float y, float z)
 	printf("\t\tglVertex3v16(%i, %i, %i);\n", floattov16(x), floattov16(y), floattov16(z));
 	//printf("\t\tglVertex3f(%.3ff, %.3ff, %.3ff);\n", x, y, z);
 }
+
+#define MESH_MAX_VERTS		4096
+#define MESH_MAX_INDICES	(MESH_MAX_VERTS * 3)
+
+/// The PC mesh that is being built; printed as static arrays by print_mesh
+float mesh_verts[MESH_MAX_VERTS * 3];
+int mesh_num_verts = 0;
+unsigned short mesh_indices[MESH_MAX_INDICES];
+int mesh_num_indices = 0;
+int mesh_strip_start = 0;
+
+/// Empties the mesh, to build the next level of detail
+void mesh_reset()
+{
+	mesh_num_verts = 0;
+	mesh_num_indices = 0;
+	mesh_strip_start = 0;
+}
+
+/// Starts a new quad strip (replaces glBegin(GL_QUAD_STRIP))
+void mesh_begin_strip()
+{
+	mesh_strip_start = mesh_num_verts;
+}
+
+/// Adds a point to the current quad strip; every completed quad becomes two triangles
+void mesh_pt(float x, float y, float z)
+{
+	mesh_verts[mesh_num_verts * 3] = x;
+	mesh_verts[mesh_num_verts * 3 + 1] = y;
+	mesh_verts[mesh_num_verts * 3 + 2] = z;
+	mesh_num_verts++;
+	int in_strip = mesh_num_verts - mesh_strip_start;
+	if(in_strip >= 4 && in_strip % 2 == 0)
+	{
+		//quad is (a, b, d, c) in strip order
+		unsigned short a = mesh_num_verts - 4, b = a + 1, c = a + 2, d = a + 3;
+		mesh_indices[mesh_num_indices++] = a;
+		mesh_indices[mesh_num_indices++] = b;
+		mesh_indices[mesh_num_indices++] = d;
+		mesh_indices[mesh_num_indices++] = a;
+		mesh_indices[mesh_num_indices++] = d;
+		mesh_indices[mesh_num_indices++] = c;
+	}
+}
+
+/// Prints the mesh as the static arrays <name>_vertices and <name>_indices
+void print_mesh_arrays(const char* name)
+{
+	int each = 0;
+	printf("static const float %s_vertices[] = {\n", name);
+	while(each < mesh_num_verts)
+	{
+		printf("\t%.3ff, %.3ff, %.3ff,\n", mesh_verts[each * 3]
+			, mesh_verts[each * 3 + 1], mesh_verts[each * 3 + 2]);
+		each++;
+	}
+	printf("};\n\n");
+	printf("static const unsigned short %s_indices[] = {\n", name);
+	each = 0;
+	while(each < mesh_num_indices)
+	{
+		printf("\t%i, %i, %i,\n", mesh_indices[each]
+			, mesh_indices[each + 1], mesh_indices[each + 2]);
+		each += 3;
+	}
+	printf("};\n\n");
+}
+
+/// Prints the mesh as <name>_vertices, <name>_indices and the echo_mesh <name>_mesh
+void print_mesh(const char* name)
+{
+	printf("#ifndef ECHO_NDS\n");
+	print_mesh_arrays(name);
+	printf("echo_mesh %s_mesh = ECHO_MESH(%s_vertices, %s_indices);\n", name, name, name);
+	printf("#endif\n\n");
+}
+
+/** Prints the mesh as level of detail lod of the part: <name>_mesh for the
+ * full one, static <name>_lod<n>_mesh for the others; each points at the
+ * next coarser one, so they are printed coarsest first
+ * @param name Name of the part
+ * @param radius Largest radius of its curved surface, to work out how far the quads are from it
+ */
+void print_lod_mesh(const char* name, float radius)
+{
+	char full[64], coarser[64];
+	if(lod == 0)
+		snprintf(full, sizeof(full), "%s", name);
+	else
+		snprintf(full, sizeof(full), "%s_lod%i", name, lod);
+	if(lod < NUM_LODS - 1)
+		snprintf(coarser, sizeof(coarser), "&%s_lod%i_mesh", name, lod + 1);
+	else
+		snprintf(coarser, sizeof(coarser), "NULL");
+	printf("#ifndef ECHO_NDS\n");
+	print_mesh_arrays(full);
+	printf("%secho_mesh %s_mesh = ECHO_LOD_MESH(%s_vertices, %s_indices, %.3ff, %i, %s);\n"
+		, lod == 0 ? "" : "static ", full, full, full, radius, lod_lats[lod], coarser);
+	printf("#endif\n\n");
+}
@@ -22,6 +22,7 @@ echo -e '// echo_model_'$1'.cpp
 
 #include "echo_platform.h"
 #include "echo_gfx.h"
+#include "echo_mesh.h"
 
 #ifdef ECHO_NDS
 	#include <nds.h>
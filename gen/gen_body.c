@@ -15,24 +15,25 @@ void print_sphere_pt_nds(float theta, float phi);
 int main()
 {
 	PRINT_STATS;
-	printf("void draw_body()\n{\n");
-	printf("#ifndef ECHO_NDS\n");
 	//*
 	float theta = 0;
 	while(theta <= PI * 2)
 	{
 		float phi = TOP, u = 0;
-		printf("\tglBegin(GL_QUAD_STRIP);\n");
+		mesh_begin_strip();
 		while(phi <= BOTTOM)
 		{
 			print_sphere_pt(theta, phi);
 			print_sphere_pt(theta + ANGLE_INCR, phi);
 			phi += ANGLE_INCR;
 		}
-		printf("\tglEnd();\n");
 		theta += ANGLE_INCR;
 	}
 	// */
+	print_mesh("body");
+	printf("void draw_body()\n{\n");
+	printf("#ifndef ECHO_NDS\n");
+	printf("\tmesh_draw(&body_mesh);\n");
 	printf("#else\n");
 	printf("\tglBegin(GL_QUAD_STRIP);\n");	//10 verts
 		print_pt(-X_RADIUS, Y_RADIUS * sin(TOP), Z_RADIUS);
@@ -68,8 +69,7 @@ int main()
 
 void print_sphere_pt(float theta, float phi)
 {
-	printf("\t\tglVertex3f(%.3ff, %.3ff, %.3ff);\n"
-			, X_RADIUS * (cos(theta) * sin(phi))
+	mesh_pt(X_RADIUS * (cos(theta) * sin(phi))
 			, Y_RADIUS * (cos(phi))
 			, Z_RADIUS * (sin(theta) * sin(phi)));
 }
@@ -16,22 +16,31 @@ void print_sphere_pt_nds(float theta, float phi);
 int main()
 {
 	PRINT_STATS;
-	printf("void draw_foot()\n{\n");
-	printf("#ifndef ECHO_NDS\n");
-	float theta = 0;
-	while(theta <= PI)
+	//every level of detail, coarsest first
+	lod = NUM_LODS - 1;
+	while(lod >= 0)
 	{
-		float phi = TOP, u = 0;
-		printf("\tglBegin(GL_QUAD_STRIP);\n");
-		while(phi <= BOTTOM)
+		mesh_reset();
+		float theta = 0;
+		while(theta <= PI)
 		{
-			print_sphere_pt(theta, phi);
-			print_sphere_pt(theta + ANGLE_INCR, phi);
-			phi += ANGLE_INCR;
+			float phi = TOP, u = 0;
+			mesh_begin_strip();
+			while(phi <= BOTTOM)
+			{
+				print_sphere_pt(theta, phi);
+				print_sphere_pt(theta + ANGLE_INCR, phi);
+				phi += ANGLE_INCR;
+			}
+			theta += ANGLE_INCR;
 		}
-		printf("\tglEnd();\n");
-		theta += ANGLE_INCR;
+		print_lod_mesh("foot", Z_RADIUS);
+		lod--;
 	}
+	lod = 0;
+	printf("void draw_foot()\n{\n");
+	printf("#ifndef ECHO_NDS\n");
+	printf("\tmesh_draw(&foot_mesh);\n");
 	printf("#else\n");
 	printf("\tglBegin(GL_QUAD_STRIP);\n");	//12 verts
 		print_pt(-X_RADIUS, 0, 0);
@@ -55,8 +64,7 @@ int main()
 
 void print_sphere_pt(float theta, float phi)
 {
-	printf("\t\tglVertex3f(%.3ff, %.3ff, %.3ff);\n"
-			, -X_RADIUS * (cos(theta) * sin(phi))
+	mesh_pt(-X_RADIUS * (cos(theta) * sin(phi))
 			, Y_RADIUS * (cos(phi))
 			, Z_RADIUS * (sin(theta) * sin(phi)));
 }
@@ -9,6 +9,9 @@
 #define RAD_DIV_HEIGHT	RADIUS / HEIGHT
 #define CONE_INCR	0.01f
 
+/// The sides of the cone are straight, so the coarser levels need far fewer rings (all end at 0.24)
+const float lod_cone_incr[NUM_LODS] = {CONE_INCR, 0.06f, 0.12f};
+
 
 void print_sphere_pt(float theta, float phi);
 void print_cone_pt(float theta, float u);
@@ -18,8 +21,6 @@ void print_cone_pt_nds(float theta, float u);
 int main()
 {
 	PRINT_STATS;
-	printf("void draw_head()\n{\n");
-	printf("#ifndef ECHO_NDS\n");
 	/*
 		printf("\tglutSolidSphere(%.3ff, %i, %i);\n", RADIUS, LATS, LATS);
 		printf("\tglPushMatrix();\n");
@@ -28,27 +29,38 @@ int main()
 		printf("\tglPopMatrix();\n");
 	// */
 	//*
-	float theta = 0;
-	while(theta <= PI * 2)
+	//every level of detail, coarsest first
+	lod = NUM_LODS - 1;
+	while(lod >= 0)
 	{
-		float phi = 0, u = 0;
-		printf("\tglBegin(GL_QUAD_STRIP);\n");
-		while(phi <= PI / 2)
+		mesh_reset();
+		float theta = 0;
+		while(theta <= PI * 2)
 		{
-			print_sphere_pt(theta, phi);
-			print_sphere_pt(theta + ANGLE_INCR, phi);
-			phi += ANGLE_INCR;
+			float phi = 0, u = 0;
+			mesh_begin_strip();
+			while(phi <= PI / 2)
+			{
+				print_sphere_pt(theta, phi);
+				print_sphere_pt(theta + ANGLE_INCR, phi);
+				phi += ANGLE_INCR;
+			}
+			while(u < FRUST_HEIGHT)
+			{
+				print_cone_pt(theta, u);
+				print_cone_pt(theta + ANGLE_INCR, u);
+				u += lod_cone_incr[lod];
+			}
+			theta += ANGLE_INCR;
 		}
-		while(u < FRUST_HEIGHT)
-		{
-			print_cone_pt(theta, u);
-			print_cone_pt(theta + ANGLE_INCR, u);
-			u += CONE_INCR;
-		}
-		printf("\tglEnd();\n");
-		theta += ANGLE_INCR;
+		print_lod_mesh("head", RADIUS);
+		lod--;
 	}
+	lod = 0;
 	// */
+	printf("void draw_head()\n{\n");
+	printf("#ifndef ECHO_NDS\n");
+	printf("\tmesh_draw(&head_mesh);\n");
 	printf("#else\n");
 	printf("\tglBegin(GL_QUAD_STRIP);\n");		//14 vertices
 		print_pt(-RADIUS, RADIUS, -RADIUS);
@@ -96,16 +108,14 @@ int main()
 
 void print_sphere_pt(float theta, float phi)
 {
-	printf("\t\tglVertex3f(%.3ff, %.3ff, %.3ff);\n"
-			, RADIUS * (cos(theta) * sin(phi))
+	mesh_pt(RADIUS * (cos(theta) * sin(phi))
 			, RADIUS * (cos(phi))
 			, RADIUS * (sin(theta) * sin(phi)));
 }
 
 void print_cone_pt(float theta, float u)
 {
-	printf("\t\tglVertex3f(%.3ff, %.3ff, %.3ff);\n"
-			, RAD_DIV_HEIGHT * cos(theta) * (HEIGHT - u)
+	mesh_pt(RAD_DIV_HEIGHT * cos(theta) * (HEIGHT - u)
 			, -u
 			, RAD_DIV_HEIGHT * sin(theta) * (HEIGHT - u));
 }
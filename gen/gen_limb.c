@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <gen.h>
+
+#define RADIUS		0.075f
+#define HEIGHT		5.0f
+#define RAD_DIV_HEIGHT	RADIUS / HEIGHT
+#define CONE_INCR	0.01f
+
+/// The sides of the cone are straight, so the coarser levels need far fewer rings
+const float lod_cone_incr[NUM_LODS] = {CONE_INCR, 0.1f, LIMB_LENGTH};
+
+void print_cone_pt(float theta, float u);
+
+int main()
+{
+	PRINT_STATS;
+	//every level of detail, coarsest first
+	lod = NUM_LODS - 1;
+	while(lod >= 0)
+	{
+		mesh_reset();
+		float theta = 0;
+		while(theta <= PI * 2)
+		{
+			float u = 0;
+			mesh_begin_strip();
+			while(u <= LIMB_LENGTH)
+			{
+				print_cone_pt(theta, u);
+				print_cone_pt(theta + ANGLE_INCR, u);
+				u += lod_cone_incr[lod];
+			}
+			theta += ANGLE_INCR;
+		}
+		print_lod_mesh("limb", RADIUS);
+		lod--;
+	}
+	lod = 0;
+	printf("void draw_limb()\n{\n");
+	printf("#ifndef ECHO_NDS\n");
+	printf("\tmesh_draw(&limb_mesh);\n");
+	printf("#else\n");
+	printf("\tglBegin(GL_QUAD_STRIP);\n");		//10 vertices
+		print_pt(-RADIUS, 0, RADIUS);
+		print_pt(-RADIUS, -LIMB_LENGTH, RADIUS);
+		print_pt(RADIUS, 0, RADIUS);
+		print_pt(RADIUS, -LIMB_LENGTH, RADIUS);
+		print_pt(RADIUS, 0, -RADIUS);
+		print_pt(RADIUS, -LIMB_LENGTH, -RADIUS);
+		print_pt(-RADIUS, 0, -RADIUS);
+		print_pt(-RADIUS, -LIMB_LENGTH, -RADIUS);
+		print_pt(-RADIUS, 0, RADIUS);
+		print_pt(-RADIUS, -LIMB_LENGTH, RADIUS);
+	printf("\tglEnd();\n");
+	printf("#endif\n");
+	printf("}\n");
+}
+
+void print_cone_pt(float theta, float u)
+{
+	mesh_pt(RAD_DIV_HEIGHT * cos(theta) * (HEIGHT - u)
+			, -u
+			, RAD_DIV_HEIGHT * sin(theta) * (HEIGHT - u));
+}
@@ -4,6 +4,7 @@
 #include <gen.h>
 
 void print_sphere_pt(double r, float theta, float phi);
+void mesh_sphere_pt(double r, float theta, float phi);
 
 int main(int argc, char *argv[])
 {
@@ -11,9 +12,32 @@ int main(int argc, char *argv[])
 	if(argc >= 2)
 	{
 		double r = strtod(argv[1], NULL);
+		//every level of detail, coarsest first
+		lod = NUM_LODS - 1;
+		while(lod >= 0)
+		{
+			mesh_reset();
+			//replaces glutSolidSphere(r, LATS, LATS) so it can live in a buffer too
+			float theta = 0;
+			while(theta <= PI * 2)
+			{
+				float phi = 0;
+				mesh_begin_strip();
+				while(phi <= PI)
+				{
+					mesh_sphere_pt(r, theta, phi);
+					mesh_sphere_pt(r, theta + ANGLE_INCR, phi);
+					phi += ANGLE_INCR;
+				}
+				theta += ANGLE_INCR;
+			}
+			print_lod_mesh("sphere", r);
+			lod--;
+		}
+		lod = 0;
 		printf("void draw_sphere()\n{\n");
 		printf("#ifndef ECHO_NDS\n");
-			printf("\tglutSolidSphere(%.3ff, %i, %i);\n", r, LATS, LATS);
+			printf("\tmesh_draw(&sphere_mesh);\n");
 		printf("#else\n");
 		printf("\tglBegin(GL_QUAD_STRIP);\n");		//10 vertices
 			print_pt(-r, r, -r);
@@ -52,6 +76,13 @@ int main(int argc, char *argv[])
 	}
 }
 
+void mesh_sphere_pt(double r, float theta, float phi)
+{
+	mesh_pt(r * (cos(theta) * sin(phi))
+			, r * (cos(phi))
+			, r * (sin(theta) * sin(phi)));
+}
+
 void print_sphere_pt(double r, float theta, float phi)
 {
 	printf("\t\tglVertex3v16(%i, %i, %i);\n"
@@ -0,0 +1,60 @@
+/* gen_stage.c
+ * Prints a large stage to stdout, for measuring load time and memory:
+ *	gcc gen_stage.c -o gen_stage && ./gen_stage 100 > large.xml
+ *	l-echo -l large.xml
+ * The stage is a side x side square of grids, chained in a snake so the
+ * character can walk all of it.  Every 7th grid is an escgrid (with one esc),
+ * and every 13th cell also has a freeform_grid floating above it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char** argv)
+{
+	int side = argc >= 2 ? atoi(argv[1]) : 64;
+	if(side < 2)
+		side = 2;
+	const int total = side * side;
+	printf("<?xml version=\"1.0\" standalone=\"no\" ?>\n");
+	printf("<stage name=\"generated %ix%i\" start=\"g0\" goals=\"1\">\n", side, side);
+	int each = 0;
+	while(each < total)
+	{
+		const int row = each / side;
+		const int col = row % 2 == 0 ? each % side : side - 1 - each % side;
+		char prev[32], next[32];
+		if(each > 0)
+			sprintf(prev, "g%i", each - 1);
+		else
+			sprintf(prev, "NONE");
+		if(each < total - 1)
+			sprintf(next, "g%i", each + 1);
+		else
+			sprintf(next, "NONE");
+		const char* goal = each == total - 1 ? " goal=\"1\"" : "";
+		if(each % 7 == 3)
+		{
+			printf("\t<escgrid id=\"g%i\" x=\"%i\" y=\"0\" z=\"%i\" prev=\"%s\" next=\"%s\"%s>\n"
+				, each, col, row, prev, next, goal);
+			printf("\t\t<angle x=\"0\" y=\"45\" z=\"0\">\n");
+			printf("\t\t\t<grid id=\"g%i_esc\" x=\"%i\" y=\"1\" z=\"%i\" prev=\"%s\" next=\"%s\" />\n"
+				, each, col, row, prev, next);
+			printf("\t\t</angle>\n");
+			printf("\t</escgrid>\n");
+		}
+		else
+			printf("\t<grid id=\"g%i\" x=\"%i\" y=\"0\" z=\"%i\" prev=\"%s\" next=\"%s\"%s />\n"
+				, each, col, row, prev, next, goal);
+		if(each % 13 == 5)
+		{
+			printf("\t<freeform_grid id=\"f%i\" x=\"%i\" y=\"2\" z=\"%i\" prev=\"NONE\" next=\"NONE\">\n"
+				, each, col, row);
+			printf("\t\t<angle x=\"0\" y=\"0\" z=\"0.5\" />\n");
+			printf("\t\t<angle x=\"0.5\" y=\"0.5\" z=\"0\" />\n");
+			printf("\t</freeform_grid>\n");
+		}
+		each++;
+	}
+	printf("</stage>\n");
+	return(0);
+}
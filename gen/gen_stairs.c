@@ -12,21 +12,22 @@ int main()
 	printf("#else\n");
 	printf("\t#define SET_ID(id)\n");
 	printf("#endif\n\n");
-	printf("void draw_stairs()\n{\n");
-	printf("#ifndef ECHO_NDS\n");
-	//printf("\tglColor3f(1, 1, 1);\n");
-	printf("\tglBegin(GL_QUAD_STRIP);\n");
+	mesh_begin_strip();
 	while(each <= 0.5f)
 	{
-		printf("\t\tglVertex3f(0.5f, %.3ff, %.3ff);\n", each, each);
-		printf("\t\tglVertex3f(-0.5f, %.3ff, %.3ff);\n", each, each);
-		printf("\t\tglVertex3f(0.5f, %.3ff, %.3ff);\n", each, each + 0.166f);
-		printf("\t\tglVertex3f(-0.5f, %.3ff, %.3ff);\n", each, each + 0.166f);
+		mesh_pt(0.5f, each, each);
+		mesh_pt(-0.5f, each, each);
+		mesh_pt(0.5f, each, each + 0.166f);
+		mesh_pt(-0.5f, each, each + 0.166f);
 		each += 0.166f;
 	}
-	printf("\t\tglVertex3f(0.5f, 0.5f, 0.5f);\n");
-	printf("\t\tglVertex3f(-0.5f, 0.5f, 0.5f);\n");
-	printf("\tglEnd();\n");
+	mesh_pt(0.5f, 0.5f, 0.5f);
+	mesh_pt(-0.5f, 0.5f, 0.5f);
+	print_mesh("stairs");
+	printf("void draw_stairs()\n{\n");
+	printf("#ifndef ECHO_NDS\n");
+	//printf("\tglColor3f(1, 1, 1);\n");
+	printf("\tmesh_draw(&stairs_mesh);\n");
 	printf("#else\n");
 	each = -2 * 0.166f;
 	int id = 16;
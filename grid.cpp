@@ -35,9 +35,48 @@ void dump_grid_info(grid_info_t ginfo)
 	ginfo.pos->dump();
 	ECHO_PRINT("]");
 }
+/** Allocates a grid on the heap (see grid_arena::heap_alloc)
+ * @param size Size of the grid
+ */
+void* grid::operator new(size_t size)
+{
+	return(grid_arena::heap_alloc(size));
+}
+/** Allocates a grid in a stage's arena; use as new(arena) grid(...)
+ * @param size Size of the grid
+ * @param arena The arena to allocate from
+ */
+void* grid::operator new(size_t size, grid_arena* arena)
+{
+	return(arena->alloc(size));
+}
+/** Frees a grid's memory, unless the grid is in an arena (the arena frees it)
+ * @param ptr The grid's memory
+ */
+void grid::operator delete(void* ptr)
+{
+	grid_arena::release(ptr);
+}
+/** Only called if a grid's constructor throws
+ * @param ptr The grid's memory
+ * @param arena The arena it came from
+ */
+void grid::operator delete(void* ptr, grid_arena* arena)
+{
+	grid_arena::release(ptr);
+}
+/** Gets the arena this grid is in; its info (and the info's position), triggers
+ * and neighbors have to be allocated in it too, and are never freed by the grid
+ * @return The arena, or NULL if the grid is on the heap (and frees everything it has)
+ */
+grid_arena* grid::get_arena()
+{
+	return(grid_arena::owner(this));
+}
 /// Initialize a grid with no info and no previous or next
 grid::grid()
 {
+	kind = GRID_KIND_GRID;
 	already_init = 0;
 	init_to_null();
 	init(NULL, NULL, NULL);
@@ -47,6 +86,7 @@ grid::grid()
  */
 grid::grid(grid_info_t* my_info)
 {
+	kind = GRID_KIND_GRID;
 	already_init = 0;
 	init_to_null();
 	init(my_info, NULL, NULL);
@@ -58,6 +98,7 @@ grid::grid(grid_info_t* my_info)
  */
 grid::grid(grid_info_t* my_info, grid* my_prev, grid* my_next)
 {
+	kind = GRID_KIND_GRID;
 	already_init = 0;
 	init_to_null();
 	init(my_info, my_prev, my_next);
@@ -70,6 +111,7 @@ grid::grid(grid_info_t* my_info, grid* my_prev, grid* my_next)
  */
 grid::grid(grid_info_t* my_info, grid* my_prev, grid* my_next, int num_neighbor)
 {
+	kind = GRID_KIND_GRID;
 	already_init = 0;
 	init_to_null();
 	init(my_info, my_prev, my_next, num_neighbor);
@@ -95,7 +137,9 @@ void grid::init_to_null()
 	ginfo = NULL;
 	neighbors = NULL;
 	triggers = NULL;
-	points = NULL;
+	has_points = 0;
+	corner_index = -1;
+	stage_index = -1;
 #ifdef ECHO_NDS
 	polyID = 0;
 #endif
@@ -114,66 +158,53 @@ void grid::init(grid_info_t* my_info, grid* my_prev, grid* my_next, int my_num_n
 	draw_me = 1;
 	
 	delete_triggers();
-	triggers = new TRIGGER_SET();
-	
 	
 	ginfo = my_info;
 	
 	n_neighbors = my_num_neighbors;
 	delete_neighbors();
-	neighbors = new grid*[my_num_neighbors < 2 ? 2 : my_num_neighbors];
+	neighbors = new(get_arena()) grid*[my_num_neighbors < 2 ? 2 : my_num_neighbors];
 	
 	neighbors[0] = my_prev;
 	neighbors[1] = my_next;
 	
-	delete_points();
-	points = ginfo != NULL ? generate_points(ginfo) : NULL;
+	has_points = ginfo != NULL;
+	if(has_points)
+		generate_points(ginfo, points);
 }
-/// Clear the grid's points
+/// Forget the grid's points
 void grid::delete_points()
 {
-	if(points != NULL)
-	{
-		delete points[0];
-		delete points[1];
-		delete points[2];
-		delete points[3];
-		delete[] points;
-		points = NULL;
-	}
+	has_points = 0;
 }
 /// Clear the triggers
 void grid::delete_triggers()
 {
-	if(triggers != NULL)
+	/// The arena frees its triggers all at once
+	if(get_arena() == NULL)
 	{
-		TRIGGER_SET::iterator it = triggers->begin();
-		while(it != triggers->end())
+		while(triggers != NULL)
 		{
-			trigger* del = *it;
-			if(del != NULL)
-				delete del;
-			it++;
+			trigger* del = triggers;
+			triggers = triggers->get_next();
+			delete del;
 		}
-		delete triggers;
-		triggers = NULL;
 	}
+	triggers = NULL;
 }
 /// Clear the list of neighbors, not the neighbors themselves
 void grid::delete_neighbors()
 {
-	if(neighbors != NULL)
-	{
-		/// Just delete the list, not the elements
+	/// Just delete the list, not the elements (unless the arena frees it)
+	if(get_arena() == NULL)
 		delete[] neighbors;
-		neighbors = NULL;
-	}
+	neighbors = NULL;
 }
 /// Delete everything
 grid::~grid()
 {
-	/// If this grid's info is not null
-	if(ginfo != NULL)
+	/// If this grid's info is not null (and not in an arena)
+	if(ginfo != NULL && get_arena() == NULL)
 	{
 		/// If the info's position is not null
 		if(ginfo->pos != NULL)
@@ -211,29 +242,24 @@ void grid::set_real_prev(grid* g)
  */
 void grid::draw(vector3f angle)
 {
-	draw_rect(points[0], points[1], points[2], points[3]);
+	draw_rect(points);
 	draw_goal(angle);
 }
 /** Generates the set of points that outline the grid\n
  * Used for drawing, and deciding if a character lands on this grid\n
- * Default behavior is to return a square with width GRID_SIZE that is centered at the grid's position
+ * Default behavior is a square with width GRID_SIZE that is centered at the grid's position
  * @param my_info The grid's info, so that this method doesn't have to get it
- * @return The points
+ * @param out Where to store the 4 points
  */
-vector3f** grid::generate_points(grid_info_t* my_info)
+void grid::generate_points(grid_info_t* my_info, vector3f* out)
 {
-	vector3f** ret = new vector3f*[4];
-	
-	
-	ret[0] = new vector3f(my_info->pos->x - HALF_GRID, my_info->pos->y, my_info->pos->z - HALF_GRID);
+	out[0].set(my_info->pos->x - HALF_GRID, my_info->pos->y, my_info->pos->z - HALF_GRID);
 	
-	ret[1] = new vector3f(my_info->pos->x - HALF_GRID, my_info->pos->y, my_info->pos->z + HALF_GRID);
+	out[1].set(my_info->pos->x - HALF_GRID, my_info->pos->y, my_info->pos->z + HALF_GRID);
 	
-	ret[2] = new vector3f(my_info->pos->x + HALF_GRID, my_info->pos->y, my_info->pos->z + HALF_GRID);
+	out[2].set(my_info->pos->x + HALF_GRID, my_info->pos->y, my_info->pos->z + HALF_GRID);
 	
-	ret[3] = new vector3f(my_info->pos->x + HALF_GRID, my_info->pos->y, my_info->pos->z - HALF_GRID);
-	
-	return(ret);
+	out[3].set(my_info->pos->x + HALF_GRID, my_info->pos->y, my_info->pos->z - HALF_GRID);
 }
 /** Gets the info of the grid; override for awesomeness
  * @param angle Current camera angle
@@ -278,12 +304,20 @@ void grid::dump()
 	else        ECHO_PRINT("NULL grid_info_t?");
 	ECHO_PRINT("]");
 }
-/** Adds the trigger
- * @param trig Trigger to be added
+/** Adds the trigger to the end of the list
+ * @param trig Trigger to be added; allocate it in get_arena()
  */
 void grid::add_trigger(trigger* trig)
 {
-	triggers->insert(trig);
+	if(triggers == NULL)
+	{
+		triggers = trig;
+		return;
+	}
+	trigger* last = triggers;
+	while(last->get_next() != NULL)
+		last = last->get_next();
+	last->set_next(trig);
 }
 /// Sets the grid to be a goal; used mainly by the loader
 void grid::set_as_goal()
@@ -298,12 +332,11 @@ void grid::toggle_goal(vector3f angle)
 {
 	if(am_goal)	//triggers
 	{
-		TRIGGER_SET::iterator it = triggers->begin()
-					, end = triggers->end();
-		while(it != end)
+		trigger* each = triggers;
+		while(each != NULL)
 		{
-			(*it)->toggle(angle);
-			it++;
+			each->toggle(angle);
+			each = each->get_next();
 		}
 	}
 	am_goal = !am_goal;
@@ -351,21 +384,79 @@ int grid::is_pt_on(vector3f angle, vector3f* pt)
  * any of the edges formed by the points; used by holes and launchers.
  * @param p1 The first point of the line
  * @param p2 The second point of the line
- * @param angle Current camera angle
+ * @param basis Rotations of the current camera angle
  */
-int grid::projected_line_intersect(vector3f* p1, vector3f* p2, vector3f angle)
+int grid::projected_line_intersect(vector3f* p1, vector3f* p2, const camera_basis& basis)
 {
-	vector3f* proj_pt0 = points[0]->neg_rotate_xy(angle);
-	vector3f* proj_pt1 = points[1]->neg_rotate_xy(angle);
-	vector3f* proj_pt2 = points[2]->neg_rotate_xy(angle);
-	vector3f* proj_pt3 = points[3]->neg_rotate_xy(angle);
+	vector3f proj_pt0 = basis.neg_rotate_xy(points[0]);
+	vector3f proj_pt1 = basis.neg_rotate_xy(points[1]);
+	vector3f proj_pt2 = basis.neg_rotate_xy(points[2]);
+	vector3f proj_pt3 = basis.neg_rotate_xy(points[3]);
 	
-	int ret = lineSeg_intersect(p1, p2, proj_pt0, proj_pt1) 
-		|| lineSeg_intersect(p1, p2, proj_pt1, proj_pt2)
-		|| lineSeg_intersect(p1, p2, proj_pt2, proj_pt3)
-		|| lineSeg_intersect(p1, p2, proj_pt3, proj_pt0);
-	delete proj_pt0, proj_pt1, proj_pt2, proj_pt3;
-	return(ret);
+	return(lineSeg_intersect(p1, p2, &proj_pt0, &proj_pt1) 
+		|| lineSeg_intersect(p1, p2, &proj_pt1, &proj_pt2)
+		|| lineSeg_intersect(p1, p2, &proj_pt2, &proj_pt3)
+		|| lineSeg_intersect(p1, p2, &proj_pt3, &proj_pt0));
+}
+/** Gets the grid that acts for this grid at that angle; for plain grids,
+ * that's the grid itself (escgrids return their esc).
+ * @param angle Current camera angle
+ * @return The grid whose points and info are used at that angle
+ */
+grid* grid::resolve(vector3f angle)
+{
+	return(this);
+}
+/** Gets the grid this grid hands off to at that angle, one step of resolve
+ * @param angle Current camera angle
+ * @return The next grid on the way to resolve's, or NULL if this is it
+ */
+grid* grid::resolve_step(vector3f angle)
+{
+	return(NULL);
+}
+/** Appends this grid, and every grid it can resolve to, to the list
+ * @param list Where to append the grids
+ */
+void grid::list_grids(std::vector<grid*>* list)
+{
+	list->push_back(this);
+}
+/// Gets the 4 cached points of this grid (NULL if it has no info)
+vector3f* grid::get_points()
+{
+	return(has_points ? points : NULL);
+}
+/// Gets where this grid's points start in its stage's corner arrays (-1 if they aren't there)
+int grid::get_corner_index()
+{
+	return(corner_index);
+}
+/** Sets where this grid's points start in its stage's corner arrays
+ * @param index The index of the first point
+ */
+void grid::set_corner_index(int index)
+{
+	corner_index = index;
+}
+/// Gets where this grid is in its stage's top-level grids (-1 if it isn't one)
+int grid::get_stage_index()
+{
+	return(stage_index);
+}
+/** Sets where this grid is in its stage's top-level grids
+ * @param index The grid's index
+ */
+void grid::set_stage_index(int index)
+{
+	stage_index = index;
+}
+/** Draws what this grid adds over the grid it resolves to (see resolve), like a
+ * hole or a launcher; nothing by default
+ * @param pos This grid's position at the current camera angle
+ */
+void grid::draw_marker(vector3f* pos)
+{
 }
 /** Sets the grid's land flag; can the character land on this grid?
  * @param land New land flag
@@ -18,7 +18,9 @@
 */
 
 #include <set>
+#include <vector>
 #include "filter.h"
+#include "grid_arena.h"
 #include "trigger.h"
 #include "echo_math.h"
 #include "echo_platform.h"
@@ -53,6 +55,11 @@ void dump_grid_info(grid_info_t ginfo);
 class grid;
 
 typedef std::set<grid*> GRID_PTR_SET;
+/** What class a grid really is; lets the hot paths switch on it instead of going
+ * through the vtable or typeid (see grid_kind.h)
+ */
+enum GRID_KIND{ GRID_KIND_GRID = 0, GRID_KIND_T_GRID = 1, GRID_KIND_ESCGRID = 2, GRID_KIND_HOLE = 3
+		, GRID_KIND_LAUNCHER = 4, GRID_KIND_STAIR = 5, GRID_KIND_FREEFORM_GRID = 6 };
 /** @brief The "nodes" in Grid Mode; the character just traverses through the grids like a
  * linked list, and grids are the nodes.
  * 
@@ -74,19 +81,85 @@ class grid
 		int draw_me;
 		/// Can the character land on this grid?
 		int landable;
+		/// What class this grid really is (a GRID_KIND); set by the constructors
+		unsigned char kind;
 		/// Is this grid already initialized?
 		int already_init;
-		/// This grid's triggers; if this grid is toggled, then it will attempt to toggle the triggers in this list
-		TRIGGER_SET* triggers;
-		/** Cached points of this grid; THERE MUST BE 4, OR THE SUBCLASS MUST ALSO
-		 * MODIFY generate_points _AND_ draw _AND_ projected_line_intersect!
+		/** The first of this grid's triggers (see trigger::get_next); if this grid is toggled,
+		 * then it will attempt to toggle the triggers in this list
+		 */
+		trigger* triggers;
+		/** Cached points of this grid, stored in the grid itself; THERE MUST BE 4, OR THE
+		 * SUBCLASS MUST ALSO MODIFY generate_points _AND_ draw _AND_ projected_line_intersect!
 		 */
-		vector3f** points;
+		vector3f points[4];
+		/// Are the points set? (grids without info don't have any)
+		int has_points;
+		/// Where this grid's points start in its stage's corner arrays, or -1 if they aren't there
+		int corner_index;
+		/// Where this grid is in its stage's top-level grids (see stage_view), or -1 if it isn't one
+		int stage_index;
 #ifdef ECHO_NDS
 		/// The polyID; see echo_gfx for explanation
 		unsigned int polyID;
 #endif
 	public:
+		/// Gets what class this grid really is
+		enum GRID_KIND get_kind() const
+		{
+			return((enum GRID_KIND)kind);
+		}
+		/** Same as get_info, but switches on the kind instead of a virtual call;
+		 * defined in grid_kind.h
+		 * @param angle Current camera angle
+		 */
+		grid_info_t* tag_get_info(vector3f angle);
+		/** Same as get_next, but switches on the kind instead of a virtual call;
+		 * defined in grid_kind.h
+		 * @param angle Current camera angle
+		 * @param current Current grid (actually, a grid next to this grid)
+		 */
+		grid* tag_get_next(vector3f angle, grid* current);
+		/** Same as should_land, but switches on the kind instead of a virtual call;
+		 * defined in grid_kind.h
+		 * @param angle Current camera angle
+		 */
+		int tag_should_land(vector3f angle);
+		/** Same as is_pt_on, but switches on the kind instead of a virtual call;
+		 * defined in grid_kind.h
+		 * @param angle Current camera angle
+		 * @param pt Point to check
+		 */
+		int tag_is_pt_on(vector3f angle, vector3f* pt);
+		/** Same as equals, but switches on the kind instead of a virtual call;
+		 * defined in grid_kind.h
+		 * @param g The other grid to compare to.
+		 * @param angle The current camera angle
+		 */
+		int tag_equals(grid* g, vector3f angle);
+		/** Allocates a grid on the heap (see grid_arena::heap_alloc)
+		 * @param size Size of the grid
+		 */
+		static void* operator new(size_t size);
+		/** Allocates a grid in a stage's arena; use as new(arena) grid(...)
+		 * @param size Size of the grid
+		 * @param arena The arena to allocate from
+		 */
+		static void* operator new(size_t size, grid_arena* arena);
+		/** Frees a grid's memory, unless the grid is in an arena (the arena frees it)
+		 * @param ptr The grid's memory
+		 */
+		static void operator delete(void* ptr);
+		/** Only called if a grid's constructor throws
+		 * @param ptr The grid's memory
+		 * @param arena The arena it came from
+		 */
+		static void operator delete(void* ptr, grid_arena* arena);
+		/** Gets the arena this grid is in; its info (and the info's position), triggers
+		 * and neighbors have to be allocated in it too, and are never freed by the grid
+		 * @return The arena, or NULL if the grid is on the heap (and frees everything it has)
+		 */
+		grid_arena* get_arena();
 		/// Initialize a grid with no info and no previous or next
 		grid();
 		/** Initialize a grid with the info, previous and next given
@@ -123,7 +196,7 @@ class grid
 		void init(grid_info_t* my_info, grid* my_prev, grid* my_next, int num_neighbor);
 		/// Delete everything
 		virtual ~grid();
-		/// Clear the grid's points
+		/// Forget the grid's points
 		void delete_points();
 		/// Clear the triggers
 		void delete_triggers();
@@ -158,8 +231,8 @@ class grid
 		 * @param g The new previous grid
 		 */
 		virtual void set_real_prev(grid* g);
-		/** Adds the trigger
-		 * @param trig Trigger to be added
+		/** Adds the trigger to the end of the list
+		 * @param trig Trigger to be added; allocate it in get_arena()
 		 */
 		virtual void add_trigger(trigger* trig);
 		/** Toggles the grid; if this grid is a goal before calling this, then
@@ -173,11 +246,11 @@ class grid
 		virtual void set_as_goal();
 		/** Generates the set of points that outline the grid\n
 		 * Used for drawing, and deciding if a character lands on this grid\n
-		 * Default behavior is to return a square with width GRID_SIZE that is centered at the grid's position
+		 * Default behavior is a square with width GRID_SIZE that is centered at the grid's position
 		 * @param my_info The grid's info, so that this method doesn't have to get it
-		 * @return The points
+		 * @param out Where to store the 4 points
 		 */
-		virtual vector3f** generate_points(grid_info_t* my_info);
+		virtual void generate_points(grid_info_t* my_info, vector3f* out);
 		/// Should this grid be drawn?
 		virtual int should_draw();
 		/// Sets if this grid should be drawn
@@ -187,6 +260,11 @@ class grid
 		 * @param angle The current camera angle
 		 */
 		virtual void draw(vector3f angle);
+		/** Draws what this grid adds over the grid it resolves to (see resolve), like a
+		 * hole or a launcher; nothing by default
+		 * @param pos This grid's position at the current camera angle
+		 */
+		virtual void draw_marker(vector3f* pos);
 		/** Sets the grid's land flag; can the character land on this grid?
 		 * @param land New land flag
 		 */
@@ -204,13 +282,42 @@ class grid
 		 * any of the edges formed by the points; used by holes and launchers.
 		 * @param p1 The first point of the line
 		 * @param p2 The second point of the line
-		 * @param angle Current camera angle
+		 * @param basis Rotations of the current camera angle
 		 */
-		virtual int projected_line_intersect(vector3f* p1, vector3f* p2, vector3f angle);
+		virtual int projected_line_intersect(vector3f* p1, vector3f* p2, const camera_basis& basis);
 		/** If this grid is a goal, then it draws a goal above the position of this grid.
 		 * @param angle Current camera angle
 		 */
 		void draw_goal(vector3f angle);
+		/** Gets the grid that acts for this grid at that angle; for plain grids,
+		 * that's the grid itself (escgrids return their esc).
+		 * @param angle Current camera angle
+		 * @return The grid whose points and info are used at that angle
+		 */
+		virtual grid* resolve(vector3f angle);
+		/** Gets the grid this grid hands off to at that angle, one step of resolve
+		 * @param angle Current camera angle
+		 * @return The next grid on the way to resolve's, or NULL if this is it
+		 */
+		virtual grid* resolve_step(vector3f angle);
+		/** Appends this grid, and every grid it can resolve to, to the list
+		 * @param list Where to append the grids
+		 */
+		virtual void list_grids(std::vector<grid*>* list);
+		/// Gets the 4 cached points of this grid (NULL if it has no info)
+		vector3f* get_points();
+		/// Gets where this grid's points start in its stage's corner arrays (-1 if they aren't there)
+		int get_corner_index();
+		/** Sets where this grid's points start in its stage's corner arrays
+		 * @param index The index of the first point
+		 */
+		void set_corner_index(int index);
+		/// Gets where this grid is in its stage's top-level grids (-1 if it isn't one)
+		int get_stage_index();
+		/** Sets where this grid is in its stage's top-level grids
+		 * @param index The grid's index
+		 */
+		void set_stage_index(int index);
 #ifdef ECHO_NDS
 		/** Gets the grid's polyID (see echo_gfx for more info on polyID)
 		 * @param angle Current camera angle
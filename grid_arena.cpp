@@ -0,0 +1,145 @@
+// grid_arena.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <new>
+#include <vector>
+
+#include "echo_platform.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "grid_arena.h"
+
+/// Makes an empty arena
+grid_arena::grid_arena()
+{
+}
+/// Frees every chunk, without destructing the objects in them
+grid_arena::~grid_arena()
+{
+	std::vector<arena_pool>::iterator it = pools.begin();
+	while(it != pools.end())
+	{
+		std::vector<char*>::iterator chunk = it->chunks.begin();
+		while(chunk != it->chunks.end())
+		{
+			delete[] *chunk;
+			chunk++;
+		}
+		it++;
+	}
+}
+/** Allocates an object in the arena
+ * @param size Size of the object
+ * @return Memory for the object; never freed by release()
+ */
+void* grid_arena::alloc(size_t size)
+{
+	/// Round up to the header size, so every object stays aligned
+	const size_t full = (size + 2 * GRID_ARENA_HEADER - 1) / GRID_ARENA_HEADER * GRID_ARENA_HEADER;
+	std::vector<arena_pool>::iterator it = pools.begin();
+	while(it != pools.end() && it->size != full)
+		it++;
+	if(it == pools.end())
+	{
+		arena_pool pool;
+		pool.size = full;
+		pool.used = GRID_ARENA_CHUNK;
+		pools.push_back(pool);
+		it = pools.end() - 1;
+	}
+	if(it->used == GRID_ARENA_CHUNK)
+	{
+		char* chunk = new char[full * GRID_ARENA_CHUNK];
+		CHKPTR(chunk);
+		it->chunks.push_back(chunk);
+		it->used = 0;
+	}
+	char* mem = it->chunks.back() + full * it->used;
+	it->used++;
+	*(grid_arena**)mem = this;
+	return(mem + GRID_ARENA_HEADER);
+}
+/** Allocates an object on the heap, with the same header as the arena's objects
+ * @param size Size of the object
+ * @return Memory for the object; freed by release()
+ */
+void* grid_arena::heap_alloc(size_t size)
+{
+	char* mem = (char*)::operator new(size + GRID_ARENA_HEADER);
+	*(grid_arena**)mem = NULL;
+	return(mem + GRID_ARENA_HEADER);
+}
+/** Frees memory from heap_alloc; memory from an arena is left for the arena to free
+ * @param ptr Memory from alloc or heap_alloc (or NULL)
+ */
+void grid_arena::release(void* ptr)
+{
+	if(ptr == NULL)
+		return;
+	if(owner(ptr) == NULL)
+		::operator delete((char*)ptr - GRID_ARENA_HEADER);
+}
+/** Gets the arena an object came from
+ * @param ptr Memory from alloc or heap_alloc
+ * @return The arena, or NULL if the object is on the heap
+ */
+grid_arena* grid_arena::owner(const void* ptr)
+{
+	return(*(grid_arena* const*)((const char*)ptr - GRID_ARENA_HEADER));
+}
+/** Allocates an object in an arena; use as new(arena) T(...)
+ * @param size Size of the object
+ * @param arena The arena to allocate from; if NULL, the object is allocated
+ * 	with the plain operator new (and must be deleted as usual)
+ */
+void* operator new(size_t size, grid_arena* arena)
+{
+	if(arena == NULL)
+		return(::operator new(size));
+	return(arena->alloc(size));
+}
+/** Allocates an array in an arena; use as new(arena) T[n]
+ * @param size Size of the array
+ * @param arena The arena to allocate from; if NULL, the array is allocated
+ * 	with the plain operator new[] (and must be deleted as usual)
+ */
+void* operator new[](size_t size, grid_arena* arena)
+{
+	if(arena == NULL)
+		return(::operator new[](size));
+	return(arena->alloc(size));
+}
+/** Only called if a constructor throws
+ * @param ptr The object's memory
+ * @param arena The arena it came from
+ */
+void operator delete(void* ptr, grid_arena* arena)
+{
+	if(arena == NULL)
+		::operator delete(ptr);
+}
+/** Only called if a constructor throws
+ * @param ptr The array's memory
+ * @param arena The arena it came from
+ */
+void operator delete[](void* ptr, grid_arena* arena)
+{
+	if(arena == NULL)
+		::operator delete[](ptr);
+}
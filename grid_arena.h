@@ -0,0 +1,108 @@
+// grid_arena.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstddef>
+#include <vector>
+
+#ifndef __ECHO_CLASS_GRID_ARENA__
+#define __ECHO_CLASS_GRID_ARENA__
+
+/// How many objects of a size class are allocated at once
+#define GRID_ARENA_CHUNK	32
+/** Bytes in front of every object handed out (keeps the objects 16-byte aligned);
+ * they start with the arena the object came from, or NULL if it is on the heap
+ */
+#define GRID_ARENA_HEADER	16
+
+/** @brief Per-stage storage for grids and everything they own.
+ * 
+ * Objects are grouped by size class, so all grids of one type end up back
+ * to back in the same chunks.  Objects are never freed or destructed one by
+ * one; the chunks are freed all at once when the arena is deleted.  So a grid
+ * in an arena allocates its info, neighbors, triggers, etc. in the same arena
+ * (see owner()), and never frees them itself.
+ * 
+ * Grids can also be allocated on the heap (see grid::operator new), so every
+ * object is prefixed with a header that tells owner() and release() where it
+ * came from.
+ */
+class grid_arena
+{
+	protected:
+		/// Objects of one size class, back to back in chunks of GRID_ARENA_CHUNK
+		struct arena_pool
+		{
+			/// Size of each object, including the header
+			size_t size;
+			/// Objects handed out from the last chunk
+			int used;
+			/// The chunks
+			std::vector<char*> chunks;
+		};
+		/// The pools, one per size class
+		std::vector<arena_pool> pools;
+	public:
+		/// Makes an empty arena
+		grid_arena();
+		/// Frees every chunk, without destructing the objects in them
+		~grid_arena();
+		/** Allocates an object in the arena
+		 * @param size Size of the object
+		 * @return Memory for the object; never freed by release()
+		 */
+		void* alloc(size_t size);
+		/** Allocates an object on the heap, with the same header as the arena's objects
+		 * @param size Size of the object
+		 * @return Memory for the object; freed by release()
+		 */
+		static void* heap_alloc(size_t size);
+		/** Frees memory from heap_alloc; memory from an arena is left for the arena to free
+		 * @param ptr Memory from alloc or heap_alloc (or NULL)
+		 */
+		static void release(void* ptr);
+		/** Gets the arena an object came from
+		 * @param ptr Memory from alloc or heap_alloc
+		 * @return The arena, or NULL if the object is on the heap
+		 */
+		static grid_arena* owner(const void* ptr);
+};
+
+/** Allocates an object in an arena; use as new(arena) T(...)
+ * @param size Size of the object
+ * @param arena The arena to allocate from; if NULL, the object is allocated
+ * 	with the plain operator new (and must be deleted as usual)
+ */
+void* operator new(size_t size, grid_arena* arena);
+/** Allocates an array in an arena; use as new(arena) T[n]
+ * @param size Size of the array
+ * @param arena The arena to allocate from; if NULL, the array is allocated
+ * 	with the plain operator new[] (and must be deleted as usual)
+ */
+void* operator new[](size_t size, grid_arena* arena);
+/** Only called if a constructor throws
+ * @param ptr The object's memory
+ * @param arena The arena it came from
+ */
+void operator delete(void* ptr, grid_arena* arena);
+/** Only called if a constructor throws
+ * @param ptr The array's memory
+ * @param arena The arena it came from
+ */
+void operator delete[](void* ptr, grid_arena* arena);
+#endif
@@ -0,0 +1,127 @@
+// grid_kind.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "echo_math.h"
+#include "grid.h"
+#include "escgrid.h"
+
+#ifndef __ECHO_GRID_KIND__
+#define __ECHO_GRID_KIND__
+/** @file grid_kind.h
+ * The hot grid calls, dispatched on grid::get_kind() instead of through the vtable.
+ * Each one has to do exactly what the virtual function does for that kind of grid;
+ * the classes are still what the loader builds, and what everything else calls.
+ */
+
+/** Is the kind an escgrid (or a subclass of it)?
+ * @param kind The kind
+ */
+inline int grid_kind_is_esc(enum GRID_KIND kind)
+{
+	return(kind == GRID_KIND_ESCGRID || kind == GRID_KIND_HOLE || kind == GRID_KIND_LAUNCHER);
+}
+/** Same as get_info, but switches on the kind instead of a virtual call
+ * @param angle Current camera angle
+ */
+inline grid_info_t* grid::tag_get_info(vector3f angle)
+{
+	if(grid_kind_is_esc(get_kind()))
+	{
+		grid* esc = static_cast<escgrid*>(this)->get_esc(angle);
+		if(esc != NULL)
+			return(esc->tag_get_info(angle));
+	}
+	return(ginfo);
+}
+/** Same as equals, but switches on the kind instead of a virtual call
+ * @param g The other grid to compare to.
+ * @param angle The current camera angle
+ */
+inline int grid::tag_equals(grid* g, vector3f angle)
+{
+	if(grid_kind_is_esc(get_kind()))
+	{
+		grid* esc = static_cast<escgrid*>(this)->get_esc(angle);
+		if(esc != NULL)
+			return(esc->tag_equals(g, angle));
+	}
+	if(this == g)
+		return(true);
+	grid_info_t* i1 = tag_get_info(angle);
+	grid_info_t* i2 = g->tag_get_info(angle);
+	return(i1 && i2 && i1->pos == i2->pos);
+}
+/** Same as get_next, but switches on the kind instead of a virtual call
+ * @param angle Current camera angle
+ * @param current Current grid (actually, a grid next to this grid)
+ */
+inline grid* grid::tag_get_next(vector3f angle, grid* current)
+{
+	switch(get_kind())
+	{
+		case GRID_KIND_T_GRID:
+			/// It goes in a cycle: neighbors[0] -> neighbors[1] -> neighbors[2]
+			if(current && neighbors[0] && current->tag_equals(neighbors[0], angle))
+				return(neighbors[1]);
+			if(current && neighbors[2] && current->tag_equals(neighbors[2], angle))
+				return(neighbors[0]);
+			return(neighbors[2]);
+		case GRID_KIND_ESCGRID:
+		case GRID_KIND_HOLE:
+		case GRID_KIND_LAUNCHER:
+		{
+			grid* esc = static_cast<escgrid*>(this)->get_esc(angle);
+			if(esc != NULL)
+				return(esc->tag_get_next(angle, current));
+			/// Without an esc, holes and launchers send the character through/off them
+			if(get_kind() != GRID_KIND_ESCGRID)
+				return(NULL);
+			break;
+		}
+		default:
+			break;
+	}
+	if(current && neighbors[1] && current->tag_equals(neighbors[1], angle))
+		return(neighbors[0]);
+	return(neighbors[1]);
+}
+/** Same as should_land, but switches on the kind instead of a virtual call
+ * @param angle Current camera angle
+ */
+inline int grid::tag_should_land(vector3f angle)
+{
+	if(grid_kind_is_esc(get_kind()))
+	{
+		grid* esc = static_cast<escgrid*>(this)->get_esc(angle);
+		if(esc != NULL)
+			return(esc->tag_should_land(angle));
+	}
+	return(landable);
+}
+/** Same as is_pt_on, but switches on the kind instead of a virtual call
+ * @param angle Current camera angle
+ * @param pt Point to check
+ */
+inline int grid::tag_is_pt_on(vector3f angle, vector3f* pt)
+{
+	vector3f* pos = tag_get_info(angle)->pos;
+	return(ABS(pos->y - pt->y) < EPSILON && ABS(pos->x - pt->x) < HALF_GRID
+				&& ABS(pos->z - pt->z) < HALF_GRID);
+}
+#endif
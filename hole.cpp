@@ -30,11 +30,12 @@
 /// Initializes an empty hole with no info or neighbors
 hole::hole() : escgrid()
 {
-
+	kind = GRID_KIND_HOLE;
 }
 /// Initializes a hole with info and no neighbors (it doesn't need them)
 hole::hole(grid_info_t* my_info) : escgrid()
 {
+	kind = GRID_KIND_HOLE;
 	init(my_info);
 }
 /// Re-Initializes a hole with info and no neighbors (it doesn't need them)
@@ -50,7 +51,14 @@ hole::~hole()
 void hole::draw(vector3f angle)
 {
 	escgrid::draw(angle);
-	draw_hole(get_info(angle)->pos);
+	draw_marker(get_info(angle)->pos);
+}
+/** Draws the hole itself
+ * @param pos The hole's position at the current camera angle
+ */
+void hole::draw_marker(vector3f* pos)
+{
+	draw_hole(pos);
 }
 /** Gets the next grid; it's either the next grid of the current esc,
  * or null, which tells the character to fall into the hole itself (this grid certainly
@@ -44,5 +44,9 @@ class hole : public escgrid
 		virtual grid* get_next(vector3f angle, grid* current);
 		/// Draws the hole
 		virtual void draw(vector3f angle);
+		/** Draws the hole itself
+		 * @param pos The hole's position at the current camera angle
+		 */
+		virtual void draw_marker(vector3f* pos);
 };
 #endif
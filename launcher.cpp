@@ -31,11 +31,12 @@
 /// Initializes an empty launcher with no info or neighbors
 launcher::launcher() : escgrid()
 {
-
+	kind = GRID_KIND_LAUNCHER;
 }
 /// Initializes a launcher with info and no neighbors (it doesn't need them)
 launcher::launcher(grid_info_t* my_info) : escgrid()
 {
+	kind = GRID_KIND_LAUNCHER;
 	init(my_info);
 }
 /// Re-Initializes a launcher with info and no neighbors (it doesn't need them)
@@ -51,7 +52,14 @@ launcher::~launcher()
 void launcher::draw(vector3f angle)
 {
 	escgrid::draw(angle);
-	draw_launcher(get_info(angle)->pos);
+	draw_marker(get_info(angle)->pos);
+}
+/** Draws the launcher itself
+ * @param pos The launcher's position at the current camera angle
+ */
+void launcher::draw_marker(vector3f* pos)
+{
+	draw_launcher(pos);
 }
 /** Gets the next grid; it's either the next grid of the current esc,
  * or null, which tells the character to launch itself (this grid certainly
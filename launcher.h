@@ -44,5 +44,9 @@ class launcher : public escgrid
 		virtual grid* get_next(vector3f angle, grid* current);
 		/// Draws the launcher
 		virtual void draw(vector3f angle);
+		/** Draws the launcher itself
+		 * @param pos The launcher's position at the current camera angle
+		 */
+		virtual void draw_marker(vector3f* pos);
 };
 #endif
@@ -36,6 +36,15 @@
 #include "echo_ingame_loader.h"
 #include "echo_prefs.h"
 #include "echo_char_joints.h"
+#include "echo_clip.h"
+#include "echo_alloc.h"
+#include "echo_bench.h"
+#include "echo_thread.h"
+#include "echo_mesh.h"
+#include "echo_outline.h"
+#include "echo_text.h"
+#include "echo_capture.h"
+#include "echo_replay.h"
 //various grids
 #include "hole.h"
 #include "grid.h"
@@ -177,12 +186,22 @@
 	#endif
 	//the previous time "display" was called
 	static int prev_time = 0;
+	//frames drawn per second (-r); 0 draws as fast as it can
+	static int render_fps = RENDER_FPS;
 	//is the loader toggled?; which frame is the loader in?
 	static int loading = 0, load_frame = 0;
 	//the temp address of the counter (holds number of goals)
 	static char* counter = NULL;
-	//was the counter allocated?
-	static int counter_alloc = 0;
+	//backing store of the counter when it shows a number, so the HUD doesn't allocate every frame
+	static char counter_buf[32];
+	//number of heap allocations made by the last frame (dumped by pressing 'm')
+	static unsigned long frame_allocs = 0;
+	//what 'c' captures to (a CAPTURE_ constant); should the capture start with the first frame (-c)?
+	static int capture_format = CAPTURE_PNG, capture_on_start = 0;
+	//is the grid under the mouse printed ('g')?; where the mouse is
+	static int picking = 0, mouse_x = 0, mouse_y = 0;
+	//the grid under the mouse, as printed last
+	static grid* picked = NULL;
 	//was this paused before the loader was toggled?
 	static int was_paused = 0;
 #endif
@@ -253,13 +272,19 @@ static echo_files* files = NULL;
 	static void key(unsigned char key, int x, int y);
 	//special keys esp. arrow keys
 	static void spec_key(int key, int x, int y);
-	//draw a string on screen
+	//draw a string on screen (the const one is for strings that never change, and is cached)
 	static int draw_string(float x, float y, const char *string);
 	static int draw_string(float x, float y, char *string);
 	//draw a file name (using size 12 font instead of size 12)
 	static int draw_fname_string(float x, float y, char *string);
 	//draw the status (twice as spaced out)
 	static int draw_message_string(float x, float y, char *string);
+	//start or stop capturing the frames (see echo_capture.h)
+	static void toggle_capture();
+	//the mouse moved without a button held
+	static void hover(int x, int y);
+	//print the grid under the mouse if it isn't the one printed last
+	static void print_picked(grid* g);
 #endif
 //mouse dragged
 static void pointer(int x, int y);
@@ -291,6 +316,8 @@ int main(int argc, char **argv)
 	atexit(main_deallocate);
 #ifdef ECHO_NDS
 	srand(time(0));
+	//bake the animation clips
+	init_clips();
 	//initialize the file system
 	fatInitDefault();
 	char* root = NULL;
@@ -341,6 +368,7 @@ int main(int argc, char **argv)
 #elif ECHO_PC
 	//fill lookup tables
 	init_math();
+	init_clips();
 	
 	char* dir = NULL;
 	if(echo_execdir(&dir) == FAIL)
@@ -357,9 +385,25 @@ int main(int argc, char **argv)
 		if(!strcmp(argv[1], "-h"))
 		{
 			//print usage and exit gracefully
-			ECHO_PRINT("Usage: %s [-h | -t] [stage file name]\n", argv[0]);
+			ECHO_PRINT("Usage: %s [-h | -t | -k [edges] | -l stage [loads] | -o stage [frames [path [zoom]]] | -i stage [pixels [zoom]] | -m [mannequins [frames]] | -p stage [script [frames]] | -b threads stage... | -w stage [walkers [updates [threads]]] | -s stage [walkers [updates]] | -c format | -r fps] [stage file name]\n", argv[0]);
 			ECHO_PRINT("\t-h\tprints this help message\n");
 			ECHO_PRINT("\t-t\tjust tests the stage file\n");
+			ECHO_PRINT("\t-k\tbenchmarks the segment-vs-edges intersection kernel\n");
+			ECHO_PRINT("\t-l\tmeasures the load time and allocations of the stage (see gen/gen_stage.c)\n");
+			ECHO_PRINT("\t-o\tdraws the stage offscreen (no display needed) and prints the CPU and GL time of a frame;\n");
+			ECHO_PRINT("\t\tpath is immediate, list or buffer (default: each in turn); zoom > 1 leaves some of the stage off the screen\n");
+			ECHO_PRINT("\t-i\tpicks pixels of the stage offscreen, and checks the grids picked against an id image drawn apart\n");
+			ECHO_PRINT("\t\t(zoom as for -o, for stages whose grids are too small to pick at the whole stage)\n");
+			ECHO_PRINT("\t-m\tdraws a crowd of mannequins offscreen, one part at a time and instanced\n");
+			ECHO_PRINT("\t-p\tplays the stage without a display as fast as it can, following the script (- for the default),\n");
+			ECHO_PRINT("\t\tand prints the goals reached, a hash of the character's state and the time per frame\n");
+			ECHO_PRINT("\t-b\tplays the stages like -p (with the default script), one after the other and then\n");
+			ECHO_PRINT("\t\tall at once on threads (0 for one per CPU), and checks that both give the same hashes\n");
+			ECHO_PRINT("\t-w\tplays the stage without a display with a crowd of walkers, on 1, 2, 4... threads\n");
+			ECHO_PRINT("\t\t(default: one per CPU), and checks that they all play the same\n");
+			ECHO_PRINT("\t-s\tplays the stage like -w, and checks the baked stride against the trigonometry it was baked from\n");
+			ECHO_PRINT("\t-c\tcaptures every frame from the start (format is png or y4m); C toggles it\n");
+			ECHO_PRINT("\t-r\tdraws this many frames per second (default %i, 0 for no limit); the game plays the same\n", RENDER_FPS);
 			ECHO_PRINT("if no stage is specified, sample1.xml is loaded.\n");
 			std::exit(0);
 		}
@@ -383,6 +427,111 @@ int main(int argc, char **argv)
 				std::exit(1);
 			}
 		}
+		//if it is -k
+		else if(!strcmp(argv[1], "-k"))
+		{
+			//number of edges to test each segment against
+			const int num_edges = argc >= 3 ? atoi(argv[2]) : 100000;
+			std::exit(echo_bench_edges(num_edges > 0 ? num_edges : 100000, 1000));
+		}
+		//if it is -l
+		else if(!strcmp(argv[1], "-l") && argc >= 3)
+		{
+			//number of times to load the stage
+			const int loads = argc >= 4 ? atoi(argv[3]) : 10;
+			std::exit(echo_bench_load(argv[2], loads > 0 ? loads : 10));
+		}
+		//if it is -o
+		else if(!strcmp(argv[1], "-o") && argc >= 3)
+		{
+			//number of frames to draw
+			const int frames = argc >= 4 ? atoi(argv[3]) : 300;
+			//how to draw the meshes; all of them by default
+			int path = -1;
+			if(argc >= 5)
+			{
+				path = 0;
+				while(path < MESH_NUM_PATHS && strcmp(argv[4], mesh_path_name(path)))
+					path++;
+				if(path == MESH_NUM_PATHS)
+				{
+					ECHO_PRINT("unknown path %s\n", argv[4]);
+					std::exit(1);
+				}
+			}
+			//how much closer than the game the projection is
+			const float zoom = argc >= 6 ? atof(argv[5]) : 1;
+			std::exit(echo_bench_render(argv[2], frames > 0 ? frames : 300, path, zoom > 0 ? zoom : 1));
+		}
+		//if it is -i
+		else if(!strcmp(argv[1], "-i") && argc >= 3)
+		{
+			//number of pixels to pick at each angle, and how much closer than the game the projection is
+			const int pixels = argc >= 4 ? atoi(argv[3]) : 3000;
+			const float zoom = argc >= 5 ? atof(argv[4]) : 1;
+			std::exit(echo_bench_pick(argv[2], pixels > 0 ? pixels : 3000, zoom > 0 ? zoom : 1));
+		}
+		//if it is -m
+		else if(!strcmp(argv[1], "-m"))
+		{
+			//number of mannequins, and of frames to draw each way
+			const int num = argc >= 3 ? atoi(argv[2]) : 500;
+			const int frames = argc >= 4 ? atoi(argv[3]) : 300;
+			std::exit(echo_bench_crowd(num > 0 ? num : 500, frames > 0 ? frames : 300));
+		}
+		//if it is -p
+		else if(!strcmp(argv[1], "-p") && argc >= 3)
+		{
+			//the script ("-" or none for the default), and the number of frames to play
+			char* script = argc >= 4 && strcmp(argv[3], "-") ? argv[3] : NULL;
+			const int frames = argc >= 5 ? atoi(argv[4]) : 3000;
+			std::exit(echo_replay(argv[2], script, frames > 0 ? frames : 3000));
+		}
+		//if it is -b
+		else if(!strcmp(argv[1], "-b") && argc >= 4)
+		{
+			std::exit(echo_replay_batch(argv + 3, argc - 3, atoi(argv[2]), 3000));
+		}
+		//if it is -w
+		else if(!strcmp(argv[1], "-w") && argc >= 3)
+		{
+			//number of walkers, of updates, and the most threads to try
+			const int walkers = argc >= 4 ? atoi(argv[3]) : 2000;
+			const int updates = argc >= 5 ? atoi(argv[4]) : 600;
+			const int threads = argc >= 6 ? atoi(argv[5]) : echo_cpu_count();
+			std::exit(echo_bench_walkers(argv[2], walkers > 0 ? walkers : 2000, updates > 0 ? updates : 600
+				, threads > 0 ? threads : echo_cpu_count()));
+		}
+		//if it is -s
+		else if(!strcmp(argv[1], "-s") && argc >= 3)
+		{
+			//number of walkers, and of updates
+			const int walkers = argc >= 4 ? atoi(argv[3]) : 200;
+			const int updates = argc >= 5 ? atoi(argv[4]) : 600;
+			std::exit(echo_bench_stride(argv[2], walkers > 0 ? walkers : 200, updates > 0 ? updates : 600));
+		}
+		//if it is -c
+		else if(!strcmp(argv[1], "-c") && argc >= 3)
+		{
+			while(capture_format < CAPTURE_NUM_FORMATS && strcmp(argv[2], capture_format_name(capture_format)))
+				capture_format++;
+			if(capture_format == CAPTURE_NUM_FORMATS)
+			{
+				ECHO_PRINT("unknown capture format %s\n", argv[2]);
+				std::exit(1);
+			}
+			//the window doesn't have its size yet, so display starts it
+			capture_on_start = 1;
+			load(argc >= 4 ? argv[3] : NULL);
+		}
+		//if it is -r
+		else if(!strcmp(argv[1], "-r") && argc >= 3)
+		{
+			render_fps = atoi(argv[2]);
+			if(render_fps < 0)
+				render_fps = 0;
+			load(argc >= 4 ? argv[3] : NULL);
+		}
 		//else, just load the stage
 		else
 			load(argv[1]);
@@ -407,13 +556,13 @@ int main(int argc, char **argv)
 
 void main_deallocate()
 {
+#ifndef ECHO_NDS
+	//write out what is left of the capture (if it is interrupted)
+	capture_stop();
+#endif
 	ECHO_PRINT("main_deallocate: deallocating echo_ns\n");
 	echo_ns::deallocate();
 	ECHO_PRINT("main_deallocate: finished deallocating echo_ns\n");
-#ifndef ECHO_NDS
-	if(counter_alloc == 1 && counter != NULL)
-		delete[] counter;
-#endif
 	ECHO_PRINT("main_deallocate: deallocating files\n");
 	delete_echo_files(files);
 	ECHO_PRINT("main_deallocate: exiting...\n");
@@ -658,6 +807,7 @@ static void init(int argc, char **argv, int w, int h)
 	glutSpecialFunc(&spec_key);
 	glutMouseFunc(&mouse);
 	glutMotionFunc(&pointer);
+	glutPassiveMotionFunc(&hover);
 	//basic stuff
 	glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
 	glClearDepth(1.0);
@@ -672,6 +822,14 @@ static void init(int argc, char **argv, int w, int h)
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	
+	//upload the character's (and stairs') meshes once
+	mesh_init();
+	//find the outlines in screen space, if the GL can
+	if(gfx_screen_outline_init() == WIN)
+		gfx_set_outline_mode(OUTLINE_SCREEN);
+	//draw the fonts into an atlas once, so the text can be batched
+	text_init();
+	
 	resize(w, h);
 #elif ECHO_GCN || ECHO_WII
 	//TODO: Wii/GCN port?
@@ -685,6 +843,10 @@ static void resize(int w, int h)
 	
 	//change our viewport (window)
 	glViewport(0, 0, w, h);
+#ifndef ECHO_NDS
+	//the offscreen targets of the outline follow the window
+	gfx_screen_outline_resize(w, h, depth);
+#endif
 	
 	my_width = w;
 	my_height = h;
@@ -709,6 +871,12 @@ static void resize(int w, int h)
 	glOrtho(-real_width, real_width, -real_height, real_height, -depth, depth);
 	//shift back
 	glMatrixMode(GL_MODELVIEW);
+	//the stage culls what falls outside of it
+	gfx_set_view(real_width, real_height);
+#ifndef ECHO_NDS
+	//the levels of detail of the character follow how big a unit is now
+	mesh_set_pixel_scale(h / (2 * real_height));
+#endif
 }
 
 // ----DRAW MAIN----
@@ -806,19 +974,13 @@ static void resize(int w, int h)
 			console2_draw_string(0, 21, "please load a stage");
 	}
 #elif ECHO_PC
-	//copied from http://lighthouse3d.com/opengl/glut/index.php?bmpfontortho
+	//the text is queued, and drawn in one go by text_flush at the end of the frame
 	static int draw_message_string(float x, float y, char *string)
 	{
 		if(string)
 		{
-			while(*string != '\0')
-			{
-				glRasterPos2f(x, y);
-				glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *string);
-				//twice as spaced out as the other strings
-				x += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *string) / font_div * 2;
-				string++;
-			}
+			//twice as spaced out as the other strings
+			text_draw(x, y, string, TEXT_FONT_LARGE, 2 / font_div);
 			return(WIN);
 		}
 		return(FAIL);
@@ -828,14 +990,7 @@ static void resize(int w, int h)
 	{
 		if(string)
 		{
-			int i = 0;
-			while(string[i] != '\0')
-			{
-				glRasterPos2f(x, y);
-				glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, string[i]);
-				x += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, string[i]) / font_div;
-				i++;
-			}
+			text_draw_static(x, y, string, TEXT_FONT_LARGE, 1 / font_div);
 			return(WIN);
 		}
 		return(FAIL);
@@ -845,14 +1000,7 @@ static void resize(int w, int h)
 	{
 		if(string)
 		{
-			while(*string != '\0')
-			{
-				glRasterPos2f(x, y);
-				glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *string);
-				//twice as spaced out as the other strings
-				x += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *string) / font_div;
-				string++;
-			}
+			text_draw(x, y, string, TEXT_FONT_LARGE, 1 / font_div);
 			return(WIN);
 		}
 		return(FAIL);
@@ -862,14 +1010,7 @@ static void resize(int w, int h)
 	{
 		if(string)
 		{
-			while(*string != '\0')
-			{
-				glRasterPos2f(x, y);
-				glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *string);
-				//twice as spaced out as the other strings
-				x += glutBitmapWidth(GLUT_BITMAP_HELVETICA_12, *string) / font_div;
-				string++;
-			}
+			text_draw(x, y, string, TEXT_FONT_SMALL, 1 / font_div);
 			return(WIN);
 		}
 		return(FAIL);
@@ -926,32 +1067,17 @@ static void resize(int w, int h)
 		
 		if(goals_left > 0)
 		{
-			//not very precise, but oh well
-			counter = new char[(int)log(goals_left) + 10];
-			counter_alloc = 1;
-			
-			sprintf(counter, COUNTER_HEAD, goals_left);
+			snprintf(counter_buf, sizeof(counter_buf), COUNTER_HEAD, goals_left);
+			counter = counter_buf;
 		}
 		else if(echo_ns::num_goals())
-		{
 			counter = SUCCESS;
-			counter_alloc = 0;
-		}
 		else
-		{
 			counter = NO_GOALS;
-			counter_alloc = 0;
-		}
 		
 		glColor3f(0, 0, 0);
 		//bottom left, above status
 		draw_string(-0.6f * real_width, -0.8f * real_height, counter);
-		if(goals_left > 0)
-		{
-			if(counter_alloc == 1)
-				delete[] counter;
-			counter = NULL;
-		}
 	}
 	static void draw_loader()
 	{
@@ -1014,6 +1140,12 @@ static void resize(int w, int h)
 static void display()
 {
 #ifndef ECHO_NDS
+	//allocation count at the start of the frame
+	const unsigned long allocs_before = echo_alloc_count();
+	//time since the last frame started
+	const int now = glutGet(GLUT_ELAPSED_TIME);
+	const int elapsed = now - prev_time;
+	prev_time = now;
 	//clear color and depth buffer, nds does this automatically at glFlush(0);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	//load identity
@@ -1041,7 +1173,26 @@ static void display()
 	
 	//draw the world
 	if(!menu_mode)
+	{
+#ifndef ECHO_NDS
+		//catch the game up with the time since the last frame, in steps of WAIT
+		echo_ns::advance(elapsed);
+		//offscreen, if the outline is found in screen space
+		gfx_screen_outline_begin();
+#else
+		//drawn at FPS already
+		echo_ns::advance(WAIT);
+#endif
 		echo_ns::draw();
+#ifndef ECHO_NDS
+		//the goals go on top, without an outline
+		if(gfx_screen_outline_end())
+			echo_ns::draw_goals();
+		//the grid under the mouse; found on the GPU, a frame or so late
+		if(picking && echo_ns::current_stage != NULL)
+			print_picked(echo_ns::current_stage->pick(mouse_x, mouse_y, echo_ns::angle));
+#endif
+	}
 #ifndef ECHO_NDS
 	//draw the menu
 	else
@@ -1060,20 +1211,30 @@ static void display()
 	
 	//draw the loader
 	draw_loader();
+	//and all of the text above, at once
+	text_flush();
+	
+	//-c asked for the capture from the first frame
+	if(capture_on_start)
+	{
+		capture_on_start = 0;
+		toggle_capture();
+	}
+	//read the frame back for the capture; doesn't wait on the GPU or the disk
+	capture_frame(my_width, my_height);
 	
 	//display
 	glutSwapBuffers();
 	
-	int elapsed = glutGet(GLUT_ELAPSED_TIME) - prev_time;
-	if(elapsed < WAIT)
+	frame_allocs = echo_alloc_count() - allocs_before;
+	
+	//sleep off the rest of the frame; the game doesn't depend on it, it just saves the CPU
+	if(render_fps > 0)
 	{
-		ECHO_SLEEP(WAIT - elapsed);
-		//ECHO_PRINT("not fskip\n");
+		const int spent = glutGet(GLUT_ELAPSED_TIME) - prev_time;
+		if(spent < 1000.0f / render_fps)
+			ECHO_SLEEP(1000.0f / render_fps - spent);
 	}
-	//frameskip =(
-	//else
-	//	ECHO_PRINT("fskip: %f\n", elapsed - WAIT);
-	prev_time = glutGet(GLUT_ELAPSED_TIME);
 #endif
 }
 
@@ -1207,6 +1368,8 @@ static void display()
 	{
 		if(key == ESCAPE)
 		{
+			//the capture needs the context to finish
+			capture_stop();
 			glutDestroyWindow(window);
 			std::exit(0);
 		}
@@ -1276,6 +1439,26 @@ static void display()
 			echo_ns::toggle_run();
 		else if(key == 's' || key == 'S')
 			ECHO_PRINT("speed: %f\n", echo_ns::get_speed());
+		else if(key == 'm' || key == 'M')
+			ECHO_PRINT("allocations last frame: %lu\n", frame_allocs);
+		else if(key == 'c' || key == 'C')
+			toggle_capture();
+		else if(key == 'g' || key == 'G')
+		{
+			//print the grid under the mouse as it moves
+			picking = !picking;
+			picked = NULL;
+			mouse_x = x;
+			mouse_y = y;
+			ECHO_PRINT("grid under the mouse: %s\n", picking ? "on" : "off");
+		}
+		else if(key == 'o' || key == 'O')
+		{
+			//switch between the two-pass and the screen-space outline
+			const int mode = gfx_set_outline_mode(gfx_get_outline_mode() == OUTLINE_SCREEN
+				? OUTLINE_TWO_PASS : OUTLINE_SCREEN);
+			ECHO_PRINT("outline: %s\n", mode == OUTLINE_SCREEN ? "screen-space" : "two-pass");
+		}
 		else if(key == 'a' || key == 'A')
 		{
 			//dump the angle
@@ -1288,6 +1471,37 @@ static void display()
 		}
 	}
 	
+	static void toggle_capture()
+	{
+		if(capture_active())
+			capture_stop();
+		else
+			capture_start(capture_format, my_width, my_height, render_fps > 0 ? render_fps : FPS);
+	}
+	
+	static void hover(int x, int y)
+	{
+		mouse_x = x;
+		mouse_y = y;
+	}
+	
+	static void print_picked(grid* g)
+	{
+		if(g == picked)
+			return;
+		picked = g;
+		if(g == NULL)
+		{
+			ECHO_PRINT("no grid\n");
+			return;
+		}
+		ECHO_PRINT("grid %i (kind %i) at ", g->get_stage_index(), g->get_kind());
+		grid_info_t* info = g->tag_get_info(echo_ns::angle);
+		if(info)
+			info->pos->dump();
+		ECHO_PRINT("\n");
+	}
+	
 	static void spec_key(int key, int x, int y)
 	{
 		if(!loading)
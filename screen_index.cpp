@@ -0,0 +1,222 @@
+// screen_index.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <cfloat>
+
+#include "echo_platform.h"
+#include "echo_math.h"
+#include "screen_index.h"
+
+/// Smallest cell; grid edges are GRID_SIZE long, so a cell holds a few of them
+#define MIN_CELL_SIZE	2.0f
+/// Most cells per edge, so a sparse stage doesn't get a huge mostly empty index
+#define MAX_CELLS_PER_EDGE	4
+/// Bounding boxes are padded by this much, so rounding can't drop an edge from a cell
+#define CELL_PAD	1e-3f
+
+#define MIN(a, b)	((a) < (b) ? (a) : (b))
+#define MAX(a, b)	((a) > (b) ? (a) : (b))
+
+/// Makes an empty index
+screen_index::screen_index()
+{
+	min_x = min_y = 0;
+	cell_size = MIN_CELL_SIZE;
+	cols = rows = 0;
+	query_id = 0;
+	cell_start.push_back(0);
+}
+/** Gets the range of cells a bounding box touches, clamped to the index
+ * @return If the box touches any cell
+ */
+int screen_index::cell_range(float x1, float y1, float x2, float y2
+				, int* c0, int* r0, int* c1, int* r1)
+{
+	const float lo_x = (MIN(x1, x2) - CELL_PAD - min_x) / cell_size;
+	const float hi_x = (MAX(x1, x2) + CELL_PAD - min_x) / cell_size;
+	const float lo_y = (MIN(y1, y2) - CELL_PAD - min_y) / cell_size;
+	const float hi_y = (MAX(y1, y2) + CELL_PAD - min_y) / cell_size;
+	/// Also rejects NaNs
+	if(!(hi_x >= 0 && hi_y >= 0 && lo_x < cols && lo_y < rows))
+		return(false);
+	*c0 = lo_x < 0 ? 0 : (int)lo_x;
+	*r0 = lo_y < 0 ? 0 : (int)lo_y;
+	*c1 = hi_x >= cols ? cols - 1 : (int)hi_x;
+	*r1 = hi_y >= rows ? rows - 1 : (int)hi_y;
+	return(true);
+}
+/** Rebuilds the index over the given edges
+ * @param x1 X-coordinates of the first points of the edges
+ * @param y1 Y-coordinates of the first points of the edges
+ * @param x2 X-coordinates of the second points of the edges
+ * @param y2 Y-coordinates of the second points of the edges
+ * @param n Number of edges
+ */
+void screen_index::build(const float* x1, const float* y1, const float* x2, const float* y2, int n)
+{
+	/// Find the bounds of all the edges
+	float max_x = -FLT_MAX, max_y = -FLT_MAX;
+	min_x = FLT_MAX;
+	min_y = FLT_MAX;
+	int each = 0;
+	while(each < n)
+	{
+		min_x = MIN(min_x, MIN(x1[each], x2[each]));
+		min_y = MIN(min_y, MIN(y1[each], y2[each]));
+		max_x = MAX(max_x, MAX(x1[each], x2[each]));
+		max_y = MAX(max_y, MAX(y1[each], y2[each]));
+		each++;
+	}
+	if(n == 0)
+	{
+		min_x = min_y = max_x = max_y = 0;
+	}
+	min_x -= CELL_PAD;
+	min_y -= CELL_PAD;
+	const float width = max_x + CELL_PAD - min_x;
+	const float height = max_y + CELL_PAD - min_y;
+	
+	/// Grow the cells until there aren't too many of them
+	cell_size = MIN_CELL_SIZE;
+	while((int)ceilf(width / cell_size) * (int)ceilf(height / cell_size) > MAX(n, 1) * MAX_CELLS_PER_EDGE)
+		cell_size *= 2;
+	cols = MAX((int)ceilf(width / cell_size), 1);
+	rows = MAX((int)ceilf(height / cell_size), 1);
+	const int num_cells = cols * rows;
+	
+	/** Reserve for the worst case of short edges (each touches at most 2x2 cells),
+	 * so that rebuilding at a new angle doesn't need to allocate
+	 */
+	cell_start.reserve(MAX(n, 1) * MAX_CELLS_PER_EDGE + 1);
+	cell_edges.reserve(n * 4);
+	results.reserve(MAX(n, MAX(n, 1) * MAX_CELLS_PER_EDGE));
+	
+	/// First pass: count the edges in each cell (shifted by one, for the prefix sum)
+	cell_start.assign(num_cells + 1, 0);
+	int c0, r0, c1, r1;
+	each = 0;
+	while(each < n)
+	{
+		if(cell_range(x1[each], y1[each], x2[each], y2[each], &c0, &r0, &c1, &r1))
+		{
+			int r = r0;
+			while(r <= r1)
+			{
+				int c = c0;
+				while(c <= c1)
+				{
+					cell_start[r * cols + c + 1]++;
+					c++;
+				}
+				r++;
+			}
+		}
+		each++;
+	}
+	int cell = 0;
+	while(cell < num_cells)
+	{
+		cell_start[cell + 1] += cell_start[cell];
+		cell++;
+	}
+	
+	/// Second pass: fill in the edges, using results as the write cursors
+	cell_edges.resize(cell_start[num_cells]);
+	results.assign(cell_start.begin(), cell_start.end() - 1);
+	each = 0;
+	while(each < n)
+	{
+		if(cell_range(x1[each], y1[each], x2[each], y2[each], &c0, &r0, &c1, &r1))
+		{
+			int r = r0;
+			while(r <= r1)
+			{
+				int c = c0;
+				while(c <= c1)
+				{
+					cell_edges[results[r * cols + c]++] = each;
+					c++;
+				}
+				r++;
+			}
+		}
+		each++;
+	}
+	results.clear();
+	stamps.assign(n, 0);
+	query_id = 0;
+}
+/** Finds the edges that the line segment could intersect
+ * @param p1 Screen Position; point 1 of the line
+ * @param p2 Screen Position; point 2 of the line
+ * @return The number of edges found (see get_results)
+ */
+int screen_index::query(const vector3f* p1, const vector3f* p2)
+{
+	results.clear();
+	int c0, r0, c1, r1;
+	if(!cell_range(p1->x, p1->y, p2->x, p2->y, &c0, &r0, &c1, &r1))
+		return(0);
+	/// New query id; on wrap-around, forget the old stamps
+	query_id++;
+	if(query_id == 0)
+	{
+		stamps.assign(stamps.size(), 0);
+		query_id = 1;
+	}
+	int r = r0;
+	while(r <= r1)
+	{
+		int c = c0;
+		while(c <= c1)
+		{
+			const int cell = r * cols + c;
+			int each = cell_start[cell];
+			const int end = cell_start[cell + 1];
+			while(each < end)
+			{
+				const int edge = cell_edges[each];
+				if(stamps[edge] != query_id)
+				{
+					stamps[edge] = query_id;
+					results.push_back(edge);
+				}
+				each++;
+			}
+			c++;
+		}
+		r++;
+	}
+	return((int)results.size());
+}
+/** Gets the edges found by the last query, each listed once
+ * @return Indices of the edges, in no particular order
+ */
+const int* screen_index::get_results()
+{
+	return(results.empty() ? NULL : &results[0]);
+}
+/** Gets the number of cells in the index
+ * @return cols * rows
+ */
+int screen_index::get_num_cells()
+{
+	return(cols * rows);
+}
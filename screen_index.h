@@ -0,0 +1,87 @@
+// screen_index.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+
+#include "echo_math.h"
+
+#ifndef __ECHO_CLASS_SCREEN_INDEX__
+#define __ECHO_CLASS_SCREEN_INDEX__
+/** @brief Uniform grid of cells over Screen Position edges, so that a line
+ * only has to be tested against the edges near it.
+ * 
+ * Each edge is listed in every cell its (slightly padded) bounding box
+ * touches.  The cell lists are stored back to back (cell_start[c] to
+ * cell_start[c + 1] in cell_edges), so a rebuild reuses the same memory.
+ * If two segments intersect, the intersection is inside both of their
+ * bounding boxes, so the cells a segment's bounding box touches hold
+ * every edge it can possibly hit.
+ */
+class screen_index
+{
+	protected:
+		/// Lower left corner of the cells
+		float min_x, min_y;
+		/// Width and height of a cell
+		float cell_size;
+		/// Number of cells across and up
+		int cols, rows;
+		/// Where each cell's edges start in cell_edges; cols * rows + 1 entries
+		std::vector<int> cell_start;
+		/// The edges of every cell, back to back
+		std::vector<int> cell_edges;
+		/// The last query each edge was returned by, so an edge is returned once per query
+		std::vector<unsigned int> stamps;
+		/// Identifies the current query in stamps
+		unsigned int query_id;
+		/// The edges returned by the last query
+		std::vector<int> results;
+		
+		/** Gets the range of cells a bounding box touches, clamped to the index
+		 * @return If the box touches any cell
+		 */
+		int cell_range(float x1, float y1, float x2, float y2
+				, int* c0, int* r0, int* c1, int* r1);
+	public:
+		/// Makes an empty index
+		screen_index();
+		/** Rebuilds the index over the given edges
+		 * @param x1 X-coordinates of the first points of the edges
+		 * @param y1 Y-coordinates of the first points of the edges
+		 * @param x2 X-coordinates of the second points of the edges
+		 * @param y2 Y-coordinates of the second points of the edges
+		 * @param n Number of edges
+		 */
+		void build(const float* x1, const float* y1, const float* x2, const float* y2, int n);
+		/** Finds the edges that the line segment could intersect
+		 * @param p1 Screen Position; point 1 of the line
+		 * @param p2 Screen Position; point 2 of the line
+		 * @return The number of edges found (see get_results)
+		 */
+		int query(const vector3f* p1, const vector3f* p2);
+		/** Gets the edges found by the last query, each listed once
+		 * @return Indices of the edges, in no particular order
+		 */
+		const int* get_results();
+		/** Gets the number of cells in the index
+		 * @return cols * rows
+		 */
+		int get_num_cells();
+};
+#endif
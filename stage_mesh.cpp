@@ -0,0 +1,802 @@
+// stage_mesh.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include "echo_platform.h"
+
+#ifndef ECHO_NDS
+
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "echo_glext.h"
+#include "echo_mesh.h"
+#include "echo_gfx.h"
+#include "echo_crowd.h"
+#include "grid.h"
+#include "grid_kind.h"
+#include "stair.h"
+#include "stage_view.h"
+#include "stage_mesh.h"
+
+#ifdef ECHO_OSX	//OS X
+	#include <OpenGL/gl.h>
+#else
+	#include <GL/gl.h>
+#endif
+
+/// Vertices of a quad split into two triangles
+#define QUAD_VERTS		6
+/// Vertices of a launcher's outline (4 lines)
+#define LAUNCHER_VERTS	8
+/// How far holes and launchers are above their grid, so there is no z-fighting
+#define MARKER_LIFT		0.05f
+
+/// Triangle vertices the grid itself needs (not counting what it marks)
+static int count_tris(grid* g)
+{
+	if(g->get_kind() == GRID_KIND_STAIR)
+		return(stairs_mesh.num_indices);
+	return(g->get_points() ? QUAD_VERTS : 0);
+}
+/// Triangle vertices the grid's marker needs (see grid::draw_marker)
+static int count_marker_tris(grid* g)
+{
+	return(g->get_kind() == GRID_KIND_HOLE ? QUAD_VERTS : 0);
+}
+/// Line vertices the grid's marker needs (see grid::draw_marker)
+static int count_marker_lines(grid* g)
+{
+	return(g->get_kind() == GRID_KIND_LAUNCHER ? LAUNCHER_VERTS : 0);
+}
+/** Writes one vertex
+ * @return The vertex after it
+ */
+static stage_vertex* put(stage_vertex* v, float x, float y, float z, unsigned char shade, int edge)
+{
+	v->x = x;
+	v->y = y;
+	v->z = z;
+	v->r = v->g = v->b = shade;
+	v->a = 255;
+	v->edge = edge;
+	v->pad[0] = v->pad[1] = v->pad[2] = 0;
+	return(v + 1);
+}
+/** Writes a quad as the triangles (0, 1, 2) and (0, 2, 3); the diagonal has no edge
+ * @return The vertex after it
+ */
+static stage_vertex* put_quad(stage_vertex* v, const vector3f* p0, const vector3f* p1
+	, const vector3f* p2, const vector3f* p3, unsigned char shade)
+{
+	v = put(v, p0->x, p0->y, p0->z, shade, 1);
+	v = put(v, p1->x, p1->y, p1->z, shade, 1);
+	v = put(v, p2->x, p2->y, p2->z, shade, 0);
+	v = put(v, p0->x, p0->y, p0->z, shade, 0);
+	v = put(v, p2->x, p2->y, p2->z, shade, 1);
+	return(put(v, p3->x, p3->y, p3->z, shade, 1));
+}
+/** Writes the grid itself: its quad, or the stairs turned and moved into place (like stair::draw)
+ * @return The vertex after it
+ */
+static stage_vertex* put_grid(stage_vertex* v, grid* g, vector3f angle)
+{
+	if(g->get_kind() == GRID_KIND_STAIR)
+	{
+		const vector3f* pos = g->tag_get_info(angle)->pos;
+		const float rad = ((stair*)g)->get_rotation() * PI / 180;
+		const float c = cos(rad), s = sin(rad);
+		int each = 0;
+		while(each < stairs_mesh.num_indices)
+		{
+			const float* vert = stairs_mesh.vertices + 3 * stairs_mesh.indices[each];
+			/// Every 6 indices are a quad split like put_quad does it
+			const int corner = each % 6;
+			v = put(v, pos->x + vert[0] * c + vert[2] * s, pos->y + vert[1]
+				, pos->z - vert[0] * s + vert[2] * c, 255, corner != 2 && corner != 3);
+			each++;
+		}
+		return(v);
+	}
+	vector3f* pts = g->get_points();
+	if(pts)
+		v = put_quad(v, &pts[0], &pts[1], &pts[2], &pts[3], 255);
+	return(v);
+}
+/** Writes the hole of the grid (like draw_hole), if it is one
+ * @return The vertex after it
+ */
+static stage_vertex* put_marker_tris(stage_vertex* v, grid* g, vector3f* pos)
+{
+	if(g->get_kind() == GRID_KIND_HOLE && pos)
+	{
+		const float y = pos->y + MARKER_LIFT;
+		vector3f p0(pos->x, y, pos->z + HALF_GRID), p1(pos->x + HALF_GRID, y, pos->z)
+			, p2(pos->x, y, pos->z - HALF_GRID), p3(pos->x - HALF_GRID, y, pos->z);
+		v = put_quad(v, &p0, &p1, &p2, &p3, 0);
+	}
+	return(v);
+}
+/** Writes the outline of the launcher (like draw_launcher), if the grid is one
+ * @return The vertex after it
+ */
+static stage_vertex* put_marker_lines(stage_vertex* v, grid* g, vector3f* pos)
+{
+	if(g->get_kind() == GRID_KIND_LAUNCHER && pos)
+	{
+		const float y = pos->y + MARKER_LIFT;
+		vector3f pts[4] = { vector3f(pos->x, y, pos->z + HALF_GRID), vector3f(pos->x + HALF_GRID, y, pos->z)
+			, vector3f(pos->x, y, pos->z - HALF_GRID), vector3f(pos->x - HALF_GRID, y, pos->z) };
+		int each = 0;
+		while(each < 4)
+		{
+			const vector3f* from = &pts[each];
+			const vector3f* to = &pts[(each + 1) % 4];
+			v = put(v, from->x, from->y, from->z, 0, 1);
+			v = put(v, to->x, to->y, to->z, 0, 1);
+			each++;
+		}
+	}
+	return(v);
+}
+/** Fills the unused end of a slice with copies of one vertex, without edges;
+ * they make degenerate triangles (or lines) that draw nothing
+ */
+static void put_unused(stage_vertex* v, stage_vertex* end, const stage_vertex* like)
+{
+	while(v < end)
+	{
+		if(like)
+			*v = *like;
+		else
+			put(v, 0, 0, 0, 0, 0);
+		v->edge = 0;
+		v++;
+	}
+}
+
+/// Makes an empty mesh
+stage_mesh::stage_mesh()
+{
+	size = num_dynamic = num_goals = num_tris = num_lines = 0;
+	tri_start = tri_cap = line_start = line_cap = NULL;
+	dynamic = goals = NULL;
+	chains = NULL;
+	chain_start = chain_cap = chain_len = NULL;
+	tris = lines = NULL;
+	buffers[0] = buffers[1] = 0;
+	lists[0] = lists[1] = 0;
+	ids = NULL;
+	id_buffer = 0;
+	pick_fbo = pick_color = pick_depth = pick_pbo = 0;
+	pick_fence = NULL;
+	pick_pending = 0;
+	picked = -1;
+	synced_version = 0;
+	synced = 0;
+}
+/// Deletes the arrays and buffer objects
+stage_mesh::~stage_mesh()
+{
+	delete_arrays();
+	delete_pick();
+}
+/// Deletes the arrays and the buffer objects
+void stage_mesh::delete_arrays()
+{
+	if(buffers[0])
+		echo_glDeleteBuffers(2, buffers);
+	buffers[0] = buffers[1] = 0;
+	if(id_buffer)
+		echo_glDeleteBuffers(1, &id_buffer);
+	id_buffer = 0;
+	delete[] ids;
+	ids = NULL;
+	picked = -1;
+	delete_lists();
+	delete[] tri_start;
+	delete[] tri_cap;
+	delete[] line_start;
+	delete[] line_cap;
+	delete[] chains;
+	delete[] chain_start;
+	delete[] chain_cap;
+	delete[] chain_len;
+	delete[] dynamic;
+	delete[] goals;
+	delete[] tris;
+	delete[] lines;
+	tri_start = tri_cap = line_start = line_cap = NULL;
+	dynamic = goals = NULL;
+	chains = NULL;
+	chain_start = chain_cap = chain_len = NULL;
+	tris = lines = NULL;
+	size = num_dynamic = num_goals = num_tris = num_lines = 0;
+	synced = 0;
+}
+/** Sizes the slices for the view's grids; nothing is baked until sync
+ * @param view The stage's view (only its grids are used)
+ */
+void stage_mesh::init(const stage_view* view)
+{
+	delete_arrays();
+	size = view->get_size();
+	tri_start = new int[size];
+	CHKPTR(tri_start);
+	tri_cap = new int[size];
+	CHKPTR(tri_cap);
+	line_start = new int[size];
+	CHKPTR(line_start);
+	line_cap = new int[size];
+	CHKPTR(line_cap);
+	chain_start = new int[size];
+	CHKPTR(chain_start);
+	chain_cap = new int[size];
+	CHKPTR(chain_cap);
+	chain_len = new int[size];
+	CHKPTR(chain_len);
+	dynamic = new int[size];
+	CHKPTR(dynamic);
+	goals = new int[size];
+	CHKPTR(goals);
+	std::vector<grid*> candidates;
+	int num_chains = 0;
+	int each = 0;
+	while(each < size)
+	{
+		grid* g = view->get_grid(each);
+		tri_start[each] = num_tris;
+		line_start[each] = num_lines;
+		tri_cap[each] = line_cap[each] = 0;
+		chain_start[each] = num_chains;
+		chain_cap[each] = chain_len[each] = 0;
+		if(g->should_draw())
+		{
+			/// Room for the biggest thing the grid can resolve to, plus the markers
+			/// of every grid it can go through on the way
+			candidates.clear();
+			g->list_grids(&candidates);
+			int most_tris = 0;
+			unsigned int c = 0;
+			while(c < candidates.size())
+			{
+				grid* cand = candidates[c];
+				if(count_tris(cand) > most_tris)
+					most_tris = count_tris(cand);
+				tri_cap[each] += count_marker_tris(cand);
+				line_cap[each] += count_marker_lines(cand);
+				c++;
+			}
+			tri_cap[each] += most_tris;
+			/// The way to the active grid only goes through grids it can resolve to
+			chain_cap[each] = candidates.size();
+			if(candidates.size() > 1)
+				dynamic[num_dynamic++] = each;
+		}
+		num_tris += tri_cap[each];
+		num_lines += line_cap[each];
+		num_chains += chain_cap[each];
+		each++;
+	}
+	chains = new grid*[num_chains > 0 ? num_chains : 1];
+	CHKPTR(chains);
+	tris = new stage_vertex[num_tris > 0 ? num_tris : 1];
+	CHKPTR(tris);
+	lines = new stage_vertex[num_lines > 0 ? num_lines : 1];
+	CHKPTR(lines);
+}
+/** Bakes the slice of the grid at that index of the view
+ * @return Did the slice change?
+ */
+int stage_mesh::bake(const stage_view* view, int index, vector3f angle)
+{
+	grid* active = view->get_active(index);
+	if(tri_cap[index] == 0 && line_cap[index] == 0)
+		return(0);
+	/// Two angles can reach the same active grid through different grids, whose markers are baked too
+	grid** chain = chains + chain_start[index];
+	int same = chain_len[index] > 0;
+	int len = 0;
+	grid* step = view->get_grid(index);
+	while(step != NULL && len < chain_cap[index])
+	{
+		same = same && len < chain_len[index] && chain[len] == step;
+		chain[len++] = step;
+		if(step == active)
+			break;
+		step = step->resolve_step(angle);
+	}
+	if(same && len == chain_len[index])
+		return(0);
+	chain_len[index] = len;
+	grid* g = view->get_grid(index);
+	
+	stage_vertex* start = tris + tri_start[index];
+	stage_vertex* v = put_grid(start, active, angle);
+	/// What draw_view_grid would draw: the active grid, its marker, and the marker of each grid on the way to it
+	grid_info_t* info = active->tag_get_info(angle);
+	v = put_marker_tris(v, active, info ? info->pos : NULL);
+	stage_vertex* line = lines + line_start[index];
+	stage_vertex* l = put_marker_lines(line, active, info ? info->pos : NULL);
+	while(g != NULL && g != active)
+	{
+		v = put_marker_tris(v, g, view->get_pos(index));
+		l = put_marker_lines(l, g, view->get_pos(index));
+		g = g->resolve_step(angle);
+	}
+	put_unused(v, start + tri_cap[index], v > start ? start : NULL);
+	put_unused(l, line + line_cap[index], l > line ? line : (v > start ? start : NULL));
+	return(1);
+}
+/// Copies the slice at that index into the buffer objects
+void stage_mesh::patch(int index)
+{
+	if(!buffers[0])
+		return;
+	if(tri_cap[index] > 0)
+	{
+		echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+		echo_glBufferSubData(GL_ARRAY_BUFFER, tri_start[index] * sizeof(stage_vertex)
+			, tri_cap[index] * sizeof(stage_vertex), tris + tri_start[index]);
+	}
+	if(line_cap[index] > 0)
+	{
+		echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+		echo_glBufferSubData(GL_ARRAY_BUFFER, line_start[index] * sizeof(stage_vertex)
+			, line_cap[index] * sizeof(stage_vertex), lines + line_start[index]);
+	}
+	echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+/// Deletes the display lists; they are compiled again when next drawn
+void stage_mesh::delete_lists()
+{
+	int each = 0;
+	while(each < 2)
+	{
+		if(lists[each])
+			glDeleteLists(lists[each], 1);
+		lists[each] = 0;
+		each++;
+	}
+}
+/** Brings the slices up to date with the view (cheap if it hasn't been rebuilt)
+ * @param view The stage's view, built for angle
+ * @param angle Current camera angle
+ */
+void stage_mesh::sync(const stage_view* view, vector3f angle)
+{
+	if(synced && synced_version == view->get_version())
+		return;
+	int each = 0;
+	if(!synced)
+	{
+		/// First time: bake everything, then upload it all at once
+		while(each < size)
+		{
+			bake(view, each, angle);
+			each++;
+		}
+		if(echo_glext_has_vbo())
+		{
+			echo_glGenBuffers(2, buffers);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+			echo_glBufferData(GL_ARRAY_BUFFER, num_tris * sizeof(stage_vertex), tris, GL_DYNAMIC_DRAW);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+			echo_glBufferData(GL_ARRAY_BUFFER, num_lines * sizeof(stage_vertex), lines, GL_DYNAMIC_DRAW);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+		synced = 1;
+	}
+	else
+	{
+		/// Only the grids that can resolve to something else
+		while(each < num_dynamic)
+		{
+			if(bake(view, dynamic[each], angle))
+			{
+				patch(dynamic[each]);
+				delete_lists();
+			}
+			each++;
+		}
+	}
+	num_goals = 0;
+	each = 0;
+	while(each < size)
+	{
+		if(view->is_goal(each) && view->should_draw(each))
+			goals[num_goals++] = each;
+		each++;
+	}
+	synced_version = view->get_version();
+}
+/** Draws the visible slices of one buffer, with a call per run of them
+ * @param mode GL_TRIANGLES or GL_LINES
+ * @param start Where each slice starts (tri_start or line_start)
+ * @param cap How many vertices each slice has (tri_cap or line_cap)
+ * @param visible Which slices to draw; NULL for all of them
+ */
+void stage_mesh::draw_runs(unsigned int mode, const int* start, const int* cap, const unsigned char* visible)
+{
+	int run_start = -1, run_end = 0;
+	int each = 0;
+	while(each < size)
+	{
+		/// Empty slices neither start nor break a run
+		if(cap[each] > 0)
+		{
+			if(!visible || visible[each])
+			{
+				if(run_start < 0)
+					run_start = start[each];
+				run_end = start[each] + cap[each];
+			}
+			else if(run_start >= 0)
+			{
+				glDrawArrays(mode, run_start, run_end - run_start);
+				run_start = -1;
+			}
+		}
+		each++;
+	}
+	if(run_start >= 0)
+		glDrawArrays(mode, run_start, run_end - run_start);
+}
+/** Draws the stage; the display lists (MESH_PATH_LIST) hold all of it, so they aren't culled
+ * @param outline Is this the outline pass?  (the colors are ignored)
+ * @param visible Which slices are on the screen (see stage::cull); NULL for all of them
+ */
+void stage_mesh::draw(int outline, const unsigned char* visible)
+{
+	if(mesh_get_path() == MESH_PATH_IMMEDIATE)
+	{
+		draw_immediate(outline, visible);
+		return;
+	}
+	if(mesh_get_path() == MESH_PATH_LIST)
+	{
+		if(!lists[outline])
+		{
+			lists[outline] = glGenLists(1);
+			glNewList(lists[outline], GL_COMPILE);
+			draw_immediate(outline, NULL);
+			glEndList();
+		}
+		glCallList(lists[outline]);
+		return;
+	}
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_EDGE_FLAG_ARRAY);
+	if(!outline)
+		glEnableClientState(GL_COLOR_ARRAY);
+	
+	if(buffers[0])
+		echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	const char* base = buffers[0] ? (const char*)NULL : (const char*)tris;
+	glVertexPointer(3, GL_FLOAT, sizeof(stage_vertex), base + offsetof(stage_vertex, x));
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(stage_vertex), base + offsetof(stage_vertex, r));
+	glEdgeFlagPointer(sizeof(stage_vertex), base + offsetof(stage_vertex, edge));
+	draw_runs(GL_TRIANGLES, tri_start, tri_cap, visible);
+	glDisableClientState(GL_EDGE_FLAG_ARRAY);
+	
+	if(num_lines > 0)
+	{
+		if(buffers[1])
+			echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+		base = buffers[1] ? (const char*)NULL : (const char*)lines;
+		glVertexPointer(3, GL_FLOAT, sizeof(stage_vertex), base + offsetof(stage_vertex, x));
+		glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(stage_vertex), base + offsetof(stage_vertex, r));
+		draw_runs(GL_LINES, line_start, line_cap, visible);
+	}
+	
+	if(buffers[0])
+		echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+	if(!outline)
+		glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+}
+/** Sends every vertex with glVertex (MESH_PATH_IMMEDIATE, and to compile the lists)
+ * @param visible Which slices to send; NULL for all of them
+ */
+void stage_mesh::draw_immediate(int outline, const unsigned char* visible)
+{
+	glBegin(GL_TRIANGLES);
+	int slice = 0;
+	while(slice < size)
+	{
+		if(!visible || visible[slice])
+		{
+			int each = tri_start[slice];
+			while(each < tri_start[slice] + tri_cap[slice])
+			{
+				if(!outline)
+					glColor4ubv(&tris[each].r);
+				glEdgeFlag(tris[each].edge);
+				glVertex3fv(&tris[each].x);
+				each++;
+			}
+		}
+		slice++;
+	}
+	glEnd();
+	glEdgeFlag(GL_TRUE);
+	if(num_lines > 0)
+	{
+		glBegin(GL_LINES);
+		slice = 0;
+		while(slice < size)
+		{
+			if(!visible || visible[slice])
+			{
+				int each = line_start[slice];
+				while(each < line_start[slice] + line_cap[slice])
+				{
+					if(!outline)
+						glColor4ubv(&lines[each].r);
+					glVertex3fv(&lines[each].x);
+					each++;
+				}
+			}
+			slice++;
+		}
+		glEnd();
+	}
+}
+/** Draws the goals; only needed in the fill pass
+ * @param view The stage's view, built for angle
+ * @param angle Current camera angle
+ * @param visible Which slices are on the screen; NULL for all of them
+ */
+void stage_mesh::draw_goals(const stage_view* view, vector3f angle, const unsigned char* visible)
+{
+	/// The goals are all the same standing mannequin, so they are drawn as one crowd
+	crowd_clear();
+	int each = 0;
+	while(each < num_goals)
+	{
+		grid* g = view->get_active(goals[each]);
+		/// Goals off the screen are left out with their grids
+		grid_info_t* info = (!visible || visible[goals[each]]) && g->is_goal(angle) ? g->get_info(angle) : NULL;
+		if(info)
+			crowd_add(info->pos->x, info->pos->y, info->pos->z, 0, NULL);
+		each++;
+	}
+	gfx_color3f(GOAL_GRAY, GOAL_GRAY, GOAL_GRAY);
+	crowd_draw();
+}
+/// Makes one of the 1x1 textures of the pick target
+static GLuint make_pick_texture(GLint format, GLenum data_format, GLenum type)
+{
+	GLuint tex = 0;
+	glGenTextures(1, &tex);
+	glBindTexture(GL_TEXTURE_2D, tex);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage2D(GL_TEXTURE_2D, 0, format, 1, 1, 0, data_format, type, NULL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return(tex);
+}
+/** Makes the ids and the target of pick, if they aren't made yet
+ * @return Can it pick?  (not without framebuffer objects)
+ */
+int stage_mesh::pick_init()
+{
+	if(!ids)
+	{
+		/// Slice + 1 in the red, green and blue bytes; 0 is the background
+		ids = new unsigned char[4 * (num_tris > 0 ? num_tris : 1)];
+		CHKPTR(ids);
+		int slice = 0;
+		while(slice < size)
+		{
+			const unsigned int id = slice + 1;
+			int each = tri_start[slice];
+			while(each < tri_start[slice] + tri_cap[slice])
+			{
+				ids[4 * each] = id & 0xFF;
+				ids[4 * each + 1] = (id >> 8) & 0xFF;
+				ids[4 * each + 2] = (id >> 16) & 0xFF;
+				ids[4 * each + 3] = 255;
+				each++;
+			}
+			slice++;
+		}
+		if(buffers[0])
+		{
+			echo_glGenBuffers(1, &id_buffer);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, id_buffer);
+			echo_glBufferData(GL_ARRAY_BUFFER, 4 * num_tris, ids, GL_STATIC_DRAW);
+			echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+	}
+	if(pick_fbo)
+		return(1);
+	if(!echo_glext_has_fbo())
+		return(0);
+	pick_color = make_pick_texture(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);
+	pick_depth = make_pick_texture(GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT);
+	GLint bound = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &bound);
+	echo_glGenFramebuffers(1, &pick_fbo);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, pick_fbo);
+	echo_glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, pick_color, 0);
+	echo_glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, pick_depth, 0);
+	const GLenum status = echo_glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, bound);
+	if(status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		ECHO_PRINT("pick framebuffer is incomplete (0x%x); can't pick\n", status);
+		delete_pick();
+		return(0);
+	}
+	if(echo_glext_has_pbo())
+	{
+		echo_glGenBuffers(1, &pick_pbo);
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pick_pbo);
+		echo_glBufferData(GL_PIXEL_PACK_BUFFER, 4, NULL, GL_STREAM_READ);
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+	return(1);
+}
+/// Deletes the target of pick
+void stage_mesh::delete_pick()
+{
+	if(pick_fence)
+		echo_glDeleteSync(pick_fence);
+	if(pick_pbo)
+		echo_glDeleteBuffers(1, &pick_pbo);
+	if(pick_fbo)
+		echo_glDeleteFramebuffers(1, &pick_fbo);
+	if(pick_color)
+		glDeleteTextures(1, &pick_color);
+	if(pick_depth)
+		glDeleteTextures(1, &pick_depth);
+	pick_fbo = pick_color = pick_depth = pick_pbo = 0;
+	pick_fence = NULL;
+	pick_pending = 0;
+}
+/// Reads the id of the last pick into picked
+void stage_mesh::pick_read()
+{
+	unsigned char px[4] = {0, 0, 0, 0};
+	echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pick_pbo);
+	const unsigned char* mapped = (const unsigned char*)echo_glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+	if(mapped)
+	{
+		memcpy(px, mapped, 4);
+		echo_glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	if(pick_fence)
+		echo_glDeleteSync(pick_fence);
+	pick_fence = NULL;
+	pick_pending = 0;
+	picked = (int)(px[0] | (px[1] << 8) | (px[2] << 16)) - 1;
+}
+/** Draws the slice ids of the pixel into a 1x1 target (so the fill doesn't
+ * grow with the stage), with the current projection and the camera angle,
+ * and starts reading the id back; the reads are a frame or so behind.
+ * @param x Window x-coordinate, from the left
+ * @param y Window y-coordinate, from the top (like the mouse's)
+ * @param angle Current camera angle
+ * @return The slice the last read that came back found; -1 if none (or nothing came back yet)
+ */
+int stage_mesh::pick(int x, int y, vector3f angle)
+{
+	if(!synced || !pick_init())
+		return(-1);
+	if(pick_pending)
+	{
+		/// Without a fence, the read from the last frame is most likely done
+		if(!pick_fence)
+			pick_read();
+		else
+		{
+			const GLenum status = echo_glClientWaitSync(pick_fence, 0, 0);
+			if(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+				pick_read();
+		}
+		/// One read in flight at a time
+		if(pick_pending)
+			return(picked);
+	}
+	
+	GLint viewport[4], bound = 0;
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &bound);
+	GLfloat projection[16];
+	glGetFloatv(GL_PROJECTION_MATRIX, projection);
+	glPushAttrib(GL_ALL_ATTRIB_BITS);
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, pick_fbo);
+	glViewport(0, 0, 1, 1);
+	/// Nothing may change the ids on the way
+	glDisable(GL_BLEND);
+	glDisable(GL_DITHER);
+	glDisable(GL_LIGHTING);
+	glDisable(GL_TEXTURE_2D);
+	glDisable(GL_ALPHA_TEST);
+	glDisable(GL_POLYGON_SMOOTH);
+	glDisable(GL_CULL_FACE);
+	glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glDepthMask(GL_TRUE);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	
+	/// Like gluPickMatrix: the pixel (GL's are from the bottom) fills the target
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadIdentity();
+	glTranslatef(viewport[2] - 2 * (x + 0.5f), viewport[3] - 2 * (viewport[3] - y - 0.5f), 0);
+	glScalef(viewport[2], viewport[3], 1);
+	glMultMatrixf(projection);
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+	gfx_rotatef(-angle.x, 1, 0, 0);
+	gfx_rotatef(-angle.y, 0, 1, 0);
+	
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+	if(buffers[0])
+		echo_glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glVertexPointer(3, GL_FLOAT, sizeof(stage_vertex), (buffers[0] ? (const char*)NULL : (const char*)tris)
+		+ offsetof(stage_vertex, x));
+	if(id_buffer)
+		echo_glBindBuffer(GL_ARRAY_BUFFER, id_buffer);
+	glColorPointer(4, GL_UNSIGNED_BYTE, 0, id_buffer ? NULL : ids);
+	glDrawArrays(GL_TRIANGLES, 0, num_tris);
+	if(buffers[0])
+		echo_glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	if(pick_pbo)
+	{
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, pick_pbo);
+		glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		echo_glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		if(echo_glext_has_sync())
+			pick_fence = echo_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		pick_pending = 1;
+	}
+	else
+	{
+		/// No pixel buffers: wait for it
+		unsigned char px[4];
+		glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, px);
+		picked = (int)(px[0] | (px[1] << 8) | (px[2] << 16)) - 1;
+	}
+	
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+	echo_glBindFramebuffer(GL_FRAMEBUFFER, bound);
+	glPopAttrib();
+	return(picked);
+}
+
+#endif
@@ -0,0 +1,165 @@
+// stage_mesh.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "echo_platform.h"
+#include "echo_math.h"
+#include "grid.h"
+#include "stage_view.h"
+
+#ifndef __ECHO_CLASS_STAGE_MESH__
+#define __ECHO_CLASS_STAGE_MESH__
+
+#ifndef ECHO_NDS
+/// A vertex of the stage mesh
+typedef struct
+{
+	float x, y, z;
+	/// Color; ignored in the outline pass
+	unsigned char r, g, b, a;
+	/// GL edge flag: does the outline draw the edge that starts here?
+	unsigned char edge;
+	unsigned char pad[3];
+} stage_vertex;
+
+/** @brief Every grid, hole, launcher and stair of a stage in two vertex buffers.
+ * 
+ * Each top-level grid owns a slice of the triangle buffer and of the line
+ * (launcher) buffer, big enough for anything the grid can resolve to (see
+ * grid::list_grids).  The slices are baked once; when the view is rebuilt
+ * only the slices of the grids whose way to their active grid changed (any
+ * grid on it, since each one's marker is baked) are baked again and
+ * patched into the buffers, so the whole stage is two draw calls per pass.
+ * The space a slice doesn't use is filled with degenerate triangles without
+ * edges.  Goals are drawn on their own (see draw_goals).
+ */
+class stage_mesh
+{
+	protected:
+		/// Number of slices (the view's size)
+		int size;
+		/// Where each slice starts in tris, and how many vertices it has room for
+		int* tri_start;
+		int* tri_cap;
+		/// Where each slice starts in lines, and how many vertices it has room for
+		int* line_start;
+		int* line_cap;
+		/// The grids each slice was baked for: its top-level grid, each grid on the way, and the active grid last
+		grid** chains;
+		/// Where each slice's chain starts in chains, how much room it has, and how long it was when baked (0 if never)
+		int* chain_start;
+		int* chain_cap;
+		int* chain_len;
+		/// Slices whose grid can resolve to more than one grid
+		int* dynamic;
+		int num_dynamic;
+		/// Slices of the grids that are goals, as of synced_version
+		int* goals;
+		int num_goals;
+		/// The vertices
+		stage_vertex* tris;
+		int num_tris;
+		stage_vertex* lines;
+		int num_lines;
+		/// Triangle and line buffer objects; 0 if they aren't uploaded
+		unsigned int buffers[2];
+		/// Display lists of the fill and the outline pass (MESH_PATH_LIST); 0 until drawn, or after a patch
+		unsigned int lists[2];
+		/// Slice + 1 of each triangle vertex as an RGBA color, for pick; NULL until the first pick
+		unsigned char* ids;
+		/// Buffer object of ids; 0 if it isn't uploaded
+		unsigned int id_buffer;
+		/// The 1x1 target pick draws into (framebuffer, color and depth textures); 0 until the first pick
+		unsigned int pick_fbo, pick_color, pick_depth;
+		/// Pixel buffer the id is read into (0 if they aren't usable), and the fence of the read
+		unsigned int pick_pbo;
+		void* pick_fence;
+		/// Is a read in flight?; the slice the last read found (-1 for none)
+		int pick_pending, picked;
+		/// The view version the slices are baked for
+		unsigned int synced_version;
+		/// Has any slice been baked yet?
+		int synced;
+		/// Deletes the arrays and the buffer objects
+		void delete_arrays();
+		/** Bakes the slice of the grid at that index of the view
+		 * @return Did the slice change?
+		 */
+		int bake(const stage_view* view, int index, vector3f angle);
+		/// Copies the slice at that index into the buffer objects
+		void patch(int index);
+		/// Deletes the display lists; they are compiled again when next drawn
+		void delete_lists();
+		/** Makes the ids and the target of pick, if they aren't made yet
+		 * @return Can it pick?  (not without framebuffer objects)
+		 */
+		int pick_init();
+		/// Deletes the target of pick
+		void delete_pick();
+		/// Reads the id of the last pick into picked
+		void pick_read();
+		/** Sends every vertex with glVertex (MESH_PATH_IMMEDIATE, and to compile the lists)
+		 * @param visible Which slices to send; NULL for all of them
+		 */
+		void draw_immediate(int outline, const unsigned char* visible);
+		/** Draws the visible slices of one buffer, with a call per run of them
+		 * @param mode GL_TRIANGLES or GL_LINES
+		 * @param start Where each slice starts (tri_start or line_start)
+		 * @param cap How many vertices each slice has (tri_cap or line_cap)
+		 * @param visible Which slices to draw; NULL for all of them
+		 */
+		void draw_runs(unsigned int mode, const int* start, const int* cap, const unsigned char* visible);
+	public:
+		/// Makes an empty mesh
+		stage_mesh();
+		/// Deletes the arrays and buffer objects
+		~stage_mesh();
+		/** Sizes the slices for the view's grids; nothing is baked until sync
+		 * @param view The stage's view (only its grids are used)
+		 */
+		void init(const stage_view* view);
+		/** Brings the slices up to date with the view (cheap if it hasn't been rebuilt)
+		 * @param view The stage's view, built for angle
+		 * @param angle Current camera angle
+		 */
+		void sync(const stage_view* view, vector3f angle);
+		/** Draws the stage; the display lists (MESH_PATH_LIST) hold all of it, so they aren't culled
+		 * @param outline Is this the outline pass?  (the colors are ignored)
+		 * @param visible Which slices are on the screen (see stage::cull); NULL for all of them
+		 */
+		void draw(int outline, const unsigned char* visible);
+		/** Draws the goals; only needed in the fill pass
+		 * @param view The stage's view, built for angle
+		 * @param angle Current camera angle
+		 * @param visible Which slices are on the screen; NULL for all of them
+		 */
+		void draw_goals(const stage_view* view, vector3f angle, const unsigned char* visible);
+		/** Draws the slice ids of the pixel into a 1x1 target (so the fill doesn't
+		 * grow with the stage), with the current projection and the camera angle,
+		 * and starts reading the id back; the reads are a frame or so behind.
+		 * @param x Window x-coordinate, from the left
+		 * @param y Window y-coordinate, from the top (like the mouse's)
+		 * @param angle Current camera angle
+		 * @return The slice the last read that came back found; -1 if none (or nothing came back yet)
+		 */
+		int pick(int x, int y, vector3f angle);
+};
+#endif
+
+#endif
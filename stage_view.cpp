@@ -0,0 +1,160 @@
+// stage_view.cpp
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+
+#include "echo_platform.h"
+#include "echo_debug.h"
+#include "echo_error.h"
+#include "grid.h"
+#include "grid_kind.h"
+#include "stage_view.h"
+
+/// Makes an empty view
+stage_view::stage_view()
+{
+	size = 0;
+	grids = active = NULL;
+	pos = NULL;
+	flags = NULL;
+	valid = 0;
+	version = 0;
+}
+/// Deletes the arrays, not the grids
+stage_view::~stage_view()
+{
+	delete_arrays();
+}
+/// Deletes the arrays
+void stage_view::delete_arrays()
+{
+	delete[] grids;
+	delete[] active;
+	delete[] pos;
+	delete[] flags;
+	grids = active = NULL;
+	pos = NULL;
+	flags = NULL;
+	size = 0;
+}
+/** Makes room for the grids and numbers them (see grid::set_stage_index); the view is invalid until built
+ * @param top_grids The stage's top-level grids
+ */
+void stage_view::init(std::vector<grid*>* top_grids)
+{
+	delete_arrays();
+	size = (int)top_grids->size();
+	grids = new grid*[size];
+	CHKPTR(grids);
+	active = new grid*[size];
+	CHKPTR(active);
+	pos = new vector3f*[size];
+	CHKPTR(pos);
+	flags = new unsigned char[size];
+	CHKPTR(flags);
+	int each = 0;
+	while(each < size)
+	{
+		grids[each] = (*top_grids)[each];
+		grids[each]->set_stage_index(each);
+		each++;
+	}
+	valid = 0;
+}
+/** Resolves every grid at that angle
+ * @param my_angle Current camera angle
+ */
+void stage_view::build(vector3f my_angle)
+{
+	int each = 0;
+	while(each < size)
+	{
+		grid* g = grids[each];
+		active[each] = g->resolve(my_angle);
+		grid_info_t* info = g->tag_get_info(my_angle);
+		pos[each] = info ? info->pos : NULL;
+		flags[each] = (g->should_draw() ? VIEW_DRAW : 0)
+				| (g->tag_should_land(my_angle) ? VIEW_LAND : 0)
+				| (g->is_goal(my_angle) ? VIEW_GOAL : 0);
+		each++;
+	}
+	angle = my_angle;
+	valid = 1;
+	version++;
+}
+/** Is the view up to date for that angle?
+ * @param my_angle Current camera angle
+ */
+int stage_view::is_for(vector3f my_angle) const
+{
+	return(valid && angle.x == my_angle.x && angle.y == my_angle.y && angle.z == my_angle.z);
+}
+/// Gets how many times the view has been built
+unsigned int stage_view::get_version() const
+{
+	return(version);
+}
+/// Forces a rebuild on the next use; the grids' goals changed
+void stage_view::invalidate()
+{
+	valid = 0;
+}
+/// Gets the number of grids in the view
+int stage_view::get_size() const
+{
+	return(size);
+}
+/** Gets the index of the grid in the view, or -1 if it isn't in the view
+ * @param g The grid
+ */
+int stage_view::index_of(grid* g) const
+{
+	const int index = g->get_stage_index();
+	return(index >= 0 && index < size && grids[index] == g ? index : -1);
+}
+/// Gets the top-level grid at that index
+grid* stage_view::get_grid(int index) const
+{
+	return(grids[index]);
+}
+/// Gets the grid the top-level grid at that index resolves to
+grid* stage_view::get_active(int index) const
+{
+	return(active[index]);
+}
+/// Gets the position of the grid at that index (NULL if it has none)
+vector3f* stage_view::get_pos(int index) const
+{
+	return(pos[index]);
+}
+/// Should the grid at that index be drawn?
+int stage_view::should_draw(int index) const
+{
+	return(flags[index] & VIEW_DRAW);
+}
+/// Can the character land on the grid at that index?
+int stage_view::should_land(int index) const
+{
+	return(flags[index] & VIEW_LAND);
+}
+/// Is the grid at that index a goal?
+int stage_view::is_goal(int index) const
+{
+	return(flags[index] & VIEW_GOAL);
+}
@@ -0,0 +1,105 @@
+// stage_view.h
+
+/*
+    This file is part of L-Echo.
+
+    L-Echo is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    L-Echo is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <vector>
+
+#include "grid.h"
+#include "echo_math.h"
+
+#ifndef __ECHO_CLASS_STAGE_VIEW__
+#define __ECHO_CLASS_STAGE_VIEW__
+
+/// Flag: the grid should be drawn
+#define VIEW_DRAW	1
+/// Flag: the character can land on the grid at the view's angle
+#define VIEW_LAND	2
+/// Flag: the grid is a goal at the view's angle
+#define VIEW_GOAL	4
+
+/** @brief Snapshot of a stage's top-level grids as they are at one camera angle.
+ * 
+ * Resolving an escgrid to its esc goes through a chain of virtual calls, and
+ * every pass over the stage in a frame (drawing, the outline, landing, the
+ * character) would do it again for the same angle.  The view does it once per
+ * angle and keeps the results in flat arrays, indexed like the stage's top-level
+ * grids (see grid::get_stage_index).  It is rebuilt when the angle changes,
+ * and has to be invalidated when a goal is toggled.
+ */
+class stage_view
+{
+	protected:
+		/// Number of grids in the view
+		int size;
+		/// The top-level grids
+		grid** grids;
+		/// The grid each top-level grid resolves to (see grid::resolve)
+		grid** active;
+		/// Position of each grid (NULL if it has none)
+		vector3f** pos;
+		/// VIEW_DRAW, VIEW_LAND and VIEW_GOAL of each grid
+		unsigned char* flags;
+		/// Are the arrays up to date for angle?
+		int valid;
+		/// The angle the arrays are for
+		vector3f angle;
+		/// Bumped by every build, so users can tell the arrays changed
+		unsigned int version;
+		/// Deletes the arrays
+		void delete_arrays();
+	public:
+		/// Makes an empty view
+		stage_view();
+		/// Deletes the arrays, not the grids
+		~stage_view();
+		/** Makes room for the grids and numbers them (see grid::set_stage_index); the view is invalid until built
+		 * @param top_grids The stage's top-level grids
+		 */
+		void init(std::vector<grid*>* top_grids);
+		/** Resolves every grid at that angle
+		 * @param my_angle Current camera angle
+		 */
+		void build(vector3f my_angle);
+		/** Is the view up to date for that angle?
+		 * @param my_angle Current camera angle
+		 */
+		int is_for(vector3f my_angle) const;
+		/// Gets how many times the view has been built
+		unsigned int get_version() const;
+		/// Forces a rebuild on the next use; the grids' goals changed
+		void invalidate();
+		/// Gets the number of grids in the view
+		int get_size() const;
+		/** Gets the index of the grid in the view, or -1 if it isn't in the view
+		 * @param g The grid
+		 */
+		int index_of(grid* g) const;
+		/// Gets the top-level grid at that index
+		grid* get_grid(int index) const;
+		/// Gets the grid the top-level grid at that index resolves to
+		grid* get_active(int index) const;
+		/// Gets the position of the grid at that index (NULL if it has none)
+		vector3f* get_pos(int index) const;
+		/// Should the grid at that index be drawn?
+		int should_draw(int index) const;
+		/// Can the character land on the grid at that index?
+		int should_land(int index) const;
+		/// Is the grid at that index a goal?
+		int is_goal(int index) const;
+};
+#endif
@@ -28,11 +28,13 @@
 /// Init info and neighbors to null and angle to 0
 stair::stair() : grid()
 {
+	kind = GRID_KIND_STAIR;
 	init(NULL, NULL, NULL, 0);
 }
 /// Init the stair with the info, neighbors, and angle
 stair::stair(grid_info_t* my_info, grid* my_prev, grid* my_next, float my_angle) : grid(0)
 {
+	kind = GRID_KIND_STAIR;
 	init(my_info, my_prev, my_next, my_angle);
 }
 /// Re-Init the stair with the info, neighbors, and angle
@@ -59,3 +61,8 @@ void stair::draw(vector3f angle)
 	
 	draw_goal(angle);
 }
+/// Gets the angle the stairs are turned by around the y-axis (degrees)
+float stair::get_rotation()
+{
+	return(angle);
+}
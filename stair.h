@@ -38,6 +38,8 @@ class stair : public grid
 		virtual void init_to_null();
 		/// Draws the stairs with angle given around the y-axis
 		virtual void draw(vector3f angle);
+		/// Gets the angle the stairs are turned by around the y-axis (degrees)
+		float get_rotation();
 };
 #endif
 
@@ -27,11 +27,13 @@
 /// Init an empty t_grid with no neighbors and info
 t_grid::t_grid() : grid()
 {
+	kind = GRID_KIND_T_GRID;
 	init(NULL, NULL, NULL, NULL);
 }
 /// Init a t_grid with the info and neighbors
 t_grid::t_grid(grid_info_t* my_info, grid* my_prev, grid* my_next, grid* my_next2) : grid()
 {
+	kind = GRID_KIND_T_GRID;
 	init(my_info, my_prev, my_next, my_next2);
 }
 /// Re-initializes the t_grid with the info and neighbors
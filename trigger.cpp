@@ -17,7 +17,6 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <set>
 #include "echo_platform.h"
 #include "echo_debug.h"
 
@@ -32,6 +31,7 @@ trigger::trigger(filter* filter)
 {
 	my_filter = filter;
 	target = NULL;
+	next = NULL;
 }
 /** Makes a new Trigger with the filter and target given
  * @param filter The new trigger's filter; WILL BE DELETED!!!!
@@ -41,6 +41,7 @@ trigger::trigger(filter* filter, grid* my_target)
 {
 	target = my_target;
 	my_filter = filter;
+	next = NULL;
 }
 /// Deletes the filter
 trigger::~trigger()
@@ -64,3 +65,15 @@ void trigger::set_target(grid* my_target)
 	target = my_target;
 }
 
+/// Gets the next trigger of the grid that has this one, or NULL if this is the last
+trigger* trigger::get_next()
+{
+	return(next);
+}
+/** Sets the next trigger of the grid that has this one; used by grid::add_trigger
+ * @param my_next The next trigger
+ */
+void trigger::set_next(trigger* my_next)
+{
+	next = my_next;
+}
@@ -17,9 +17,6 @@
     along with L-Echo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <set>
-
-
 #ifndef __ECHO_CLASS_TRIGGER__
 #define __ECHO_CLASS_TRIGGER__
 
@@ -38,6 +35,8 @@ class trigger
 		filter* my_filter;
 		/// Target grid
 		grid* target;
+		/// The next trigger of the grid that has this one (see grid::add_trigger)
+		trigger* next;
 	public:
 		/** Makes a new Trigger with the filter given, and a null target (MUST SET LATER!)
 		 * @param filter The new trigger's filter; WILL BE DELETED!!!!
@@ -59,9 +58,13 @@ class trigger
 		 * @param my_target The trigger's new target
 		 */
 		void set_target(grid* my_target);
+		/// Gets the next trigger of the grid that has this one, or NULL if this is the last
+		trigger* get_next();
+		/** Sets the next trigger of the grid that has this one; used by grid::add_trigger
+		 * @param my_next The next trigger
+		 */
+		void set_next(trigger* my_next);
 };
 
 #endif
 
-typedef std::set<trigger*> TRIGGER_SET;
-